@@ -7,6 +7,14 @@ AC_DEFUN([AX_LIBESEDB_CHECK_LOCAL],
   [dnl Check for internationalization functions in libesedb/libesedb_i18n.c
   AC_CHECK_FUNCS([bindtextdomain])
 
+  dnl Check for memory mapped file functions in libesedb/libesedb_io_handle.c
+  AC_CHECK_HEADERS([errno.h fcntl.h sys/mman.h sys/stat.h unistd.h])
+
+  AC_CHECK_FUNCS([close fstat mmap munmap open])
+
+  dnl Check for read-ahead functions in libesedb/libesedb_io_handle.c
+  AC_CHECK_FUNCS([madvise posix_fadvise])
+
   dnl Check if library should be build with verbose output
   AX_COMMON_CHECK_ENABLE_VERBOSE_OUTPUT
 
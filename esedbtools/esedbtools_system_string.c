@@ -119,3 +119,80 @@ int esedbtools_system_string_copy_from_64_bit_in_decimal(
 	return( 1 );
 }
 
+/* Copies a 64-bit value from a string of a decimal value
+ * Returns 1 if successful, 0 if the string does not contain a decimal value or -1 on error
+ */
+int esedbtools_system_string_copy_to_64_bit_in_decimal(
+     const system_character_t *string,
+     size_t string_size,
+     uint64_t *value_64bit,
+     libcerror_error_t **error )
+{
+	static char *function     = "esedbtools_system_string_copy_to_64_bit_in_decimal";
+	size_t string_index       = 0;
+	uint64_t safe_value_64bit = 0;
+	uint8_t character_value   = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_64bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value 64-bit.",
+		 function );
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string_index < string_size;
+	     string_index++ )
+	{
+		if( string[ string_index ] == 0 )
+		{
+			break;
+		}
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			return( 0 );
+		}
+		character_value = (uint8_t) ( string[ string_index ] - (system_character_t) '0' );
+
+		if( safe_value_64bit > ( ( UINT64_MAX - character_value ) / 10 ) )
+		{
+			return( 0 );
+		}
+		safe_value_64bit *= 10;
+		safe_value_64bit += character_value;
+	}
+	if( string_index == 0 )
+	{
+		return( 0 );
+	}
+	*value_64bit = safe_value_64bit;
+
+	return( 1 );
+}
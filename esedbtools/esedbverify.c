@@ -0,0 +1,345 @@
+/*
+ * Verifies the pages of an Extensible Storage Engine (ESE) Database (EDB) file
+ *
+ * Copyright (C) 2009-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedbtools_getopt.h"
+#include "esedbtools_libcerror.h"
+#include "esedbtools_libclocale.h"
+#include "esedbtools_libcnotify.h"
+#include "esedbtools_libesedb.h"
+#include "esedbtools_output.h"
+#include "esedbtools_signal.h"
+#include "esedbtools_unused.h"
+#include "verification_handle.h"
+
+/* The exit status if the pages were verified and corrupted pages were found
+ */
+#define ESEDBVERIFY_EXIT_CORRUPTED_PAGES	2
+
+verification_handle_t *esedbverify_verification_handle = NULL;
+int esedbverify_abort                                  = 0;
+
+/* Prints the executable usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use esedbverify to verify the pages of an Extensible Storage Engine (ESE)\n"
+	                 "Database File (EDB).\n\n" );
+
+	fprintf( stream, "Usage: esedbverify [ -j number_of_threads ] [ -hvV ] source\n\n" );
+
+	fprintf( stream, "\tsource: the source file\n\n" );
+
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-j:     specify the number of threads used to verify the pages,\n"
+	                 "\t        where 1 verifies the pages sequentially (default is %d)\n",
+	                 VERIFICATION_HANDLE_DEFAULT_NUMBER_OF_THREADS );
+	fprintf( stream, "\t-v:     verbose output to stderr\n" );
+	fprintf( stream, "\t-V:     print version\n\n" );
+
+	fprintf( stream, "The exit status is 0 if no corrupted pages were found, %d if corrupted\n"
+	                 "pages were found and 1 if the pages could not be verified or if\n"
+	                 "verification was aborted.\n",
+	                 ESEDBVERIFY_EXIT_CORRUPTED_PAGES );
+}
+
+/* Signal handler for esedbverify
+ */
+void esedbverify_signal_handler(
+      esedbtools_signal_t signal ESEDBTOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function   = "esedbverify_signal_handler";
+
+	ESEDBTOOLS_UNREFERENCED_PARAMETER( signal )
+
+	esedbverify_abort = 1;
+
+	if( esedbverify_verification_handle != NULL )
+	{
+		if( verification_handle_signal_abort(
+		     esedbverify_verification_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal verification handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* Force stdin to close otherwise any function reading it will remain blocked
+	 */
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+	if( _close(
+	     0 ) != 0 )
+#else
+	if( close(
+	     0 ) != 0 )
+#endif
+	{
+		libcnotify_printf(
+		 "%s: unable to close stdin.\n",
+		 function );
+	}
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	libesedb_error_t *error                      = NULL;
+	system_character_t *option_number_of_threads = NULL;
+	system_character_t *source                   = NULL;
+	char *program                                = "esedbverify";
+	system_integer_t option                      = 0;
+	uint32_t number_of_corrupted_pages           = 0;
+	int result                                   = 0;
+	int verbose                                  = 0;
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+             "esedbtools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+        if( esedbtools_output_initialize(
+             _IONBF,
+             &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	esedboutput_version_fprint(
+	 stdout,
+	 program );
+
+	while( ( option = esedbtools_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "hj:vV" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'h':
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'j':
+				option_number_of_threads = optarg;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				esedboutput_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+
+	libcnotify_verbose_set(
+	 verbose );
+	libesedb_notify_set_stream(
+	 stderr,
+	 NULL );
+	libesedb_notify_set_verbose(
+	 verbose );
+
+	if( verification_handle_initialize(
+	     &esedbverify_verification_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize verification handle.\n" );
+
+		goto on_error;
+	}
+	if( option_number_of_threads != NULL )
+	{
+		result = verification_handle_set_number_of_threads(
+		          esedbverify_verification_handle,
+		          option_number_of_threads,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of threads in verification handle.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of threads defaulting to: %d.\n",
+			 VERIFICATION_HANDLE_DEFAULT_NUMBER_OF_THREADS );
+		}
+	}
+	if( verification_handle_open(
+	     esedbverify_verification_handle,
+	     source,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open: %" PRIs_SYSTEM ".\n",
+		 source );
+
+		goto on_error;
+	}
+	result = verification_handle_verify_pages(
+	          esedbverify_verification_handle,
+	          &error );
+
+	if( result == -1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to verify pages.\n" );
+
+		goto on_error;
+	}
+	if( verification_handle_close(
+	     esedbverify_verification_handle,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close verification handle.\n" );
+
+		goto on_error;
+	}
+	number_of_corrupted_pages = esedbverify_verification_handle->number_of_corrupted_pages;
+
+	if( verification_handle_free(
+	     &esedbverify_verification_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free verification handle.\n" );
+
+		goto on_error;
+	}
+	if( result == 0 )
+	{
+		fprintf(
+		 stdout,
+		 "Verification aborted.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	if( number_of_corrupted_pages != 0 )
+	{
+		return( ESEDBVERIFY_EXIT_CORRUPTED_PAGES );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( esedbverify_verification_handle != NULL )
+	{
+		verification_handle_free(
+		 &esedbverify_verification_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -740,7 +740,7 @@ int export_handle_open(
 	if( libesedb_file_open(
 	     export_handle->input_file,
 	     filename,
-	     LIBESEDB_OPEN_READ,
+	     LIBESEDB_OPEN_READ | LIBESEDB_ACCESS_FLAG_READ_AHEAD,
 	     error ) != 1 )
 #endif
 	{
@@ -1378,11 +1378,25 @@ int export_handle_export_table(
 	     record_iterator < number_of_records;
 	     record_iterator++ )
 	{
-		if( libesedb_table_get_record(
-		     table,
-		     record_iterator,
-		     &record,
-		     error ) != 1 )
+		/* The record is reused for all records of the table
+		 */
+		if( record == NULL )
+		{
+			result = libesedb_table_get_record(
+			          table,
+			          record_iterator,
+			          &record,
+			          error );
+		}
+		else
+		{
+			result = libesedb_table_get_record_into(
+			          table,
+			          record_iterator,
+			          record,
+			          error );
+		}
+		if( result != 1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -1626,6 +1640,13 @@ int export_handle_export_table(
 
 			goto on_error;
 		}
+		if( export_handle->abort != 0 )
+		{
+			break;
+		}
+	}
+	if( record != NULL )
+	{
 		if( libesedb_record_free(
 		     &record,
 		     error ) != 1 )
@@ -1639,10 +1660,6 @@ int export_handle_export_table(
 
 			goto on_error;
 		}
-		if( export_handle->abort != 0 )
-		{
-			break;
-		}
 	}
 	if( file_stream_close(
 	     table_file_stream ) != 0 )
@@ -2515,7 +2532,7 @@ int export_handle_export_record_value(
 {
 	system_character_t *value_string    = NULL;
         libesedb_multi_value_t *multi_value = NULL;
-	uint8_t *binary_data                = NULL;
+	const uint8_t *binary_data          = NULL;
 	uint8_t *multi_value_data           = NULL;
 	uint8_t *value_data                 = NULL;
 	static char *function               = "export_handle_export_record_value";
@@ -2719,9 +2736,10 @@ int export_handle_export_record_value(
 				break;
 
 			case LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA:
-				result = libesedb_record_get_value_binary_data_size(
+				result = libesedb_record_get_value_binary_data_reference(
 					  record,
 					  record_value_entry,
+					  &binary_data,
 					  &binary_data_size,
 					  error );
 
@@ -2731,7 +2749,7 @@ int export_handle_export_record_value(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve size of binary data: %d (%" PRIu32 ").",
+					 "%s: unable to retrieve binary data: %d (%" PRIu32 ").",
 					 function,
 					 record_value_entry,
 					 column_identifier );
@@ -2751,48 +2769,12 @@ int export_handle_export_record_value(
 
 						goto on_error;
 					}
-					binary_data = (uint8_t *) memory_allocate(
-					                           sizeof( uint8_t ) * binary_data_size  );
-
-					if( binary_data == NULL )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_MEMORY,
-						 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-						 "%s: unable to create binary data.",
-						 function );
-
-						goto on_error;
-					}
-					result = libesedb_record_get_value_binary_data(
-					          record,
-					          record_value_entry,
-					          binary_data,
-					          binary_data_size,
-					          error );
-
-					if( result != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-						 "%s: unable to retrieve binary data: %d.",
-						 function,
-						 record_value_entry );
-
-						goto on_error;
-					}
+					/* The binary data is owned by the record
+					 */
 					export_binary_data(
 					 binary_data,
 					 binary_data_size,
 					 record_file_stream );
-
-					memory_free(
-					 binary_data );
-
-					binary_data = NULL;
 				}
 				break;
 
@@ -3061,11 +3043,6 @@ on_error:
 		 &multi_value,
 		 NULL );
 	}
-	if( binary_data != NULL )
-	{
-		memory_free(
-		 binary_data );
-	}
 	if( value_string != NULL )
 	{
 		memory_free(
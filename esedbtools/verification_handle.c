@@ -0,0 +1,527 @@
+/*
+ * Verification handle
+ *
+ * Copyright (C) 2009-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "esedbtools_libcerror.h"
+#include "esedbtools_libesedb.h"
+#include "esedbtools_system_string.h"
+#include "verification_handle.h"
+
+#define VERIFICATION_HANDLE_NOTIFY_STREAM	stdout
+
+/* Retrieve a description of the page status
+ */
+const char *verification_handle_get_page_status_description(
+             uint8_t page_status )
+{
+	switch( page_status )
+	{
+		case LIBESEDB_PAGE_STATUS_VALID:
+			return( "Valid" );
+
+		case LIBESEDB_PAGE_STATUS_EMPTY:
+			return( "Empty" );
+
+		case LIBESEDB_PAGE_STATUS_UNREADABLE:
+			return( "Unreadable" );
+
+		case LIBESEDB_PAGE_STATUS_INVALID_HEADER:
+			return( "Invalid page header" );
+
+		case LIBESEDB_PAGE_STATUS_CHECKSUM_MISMATCH:
+			return( "Checksum mismatch" );
+
+		case LIBESEDB_PAGE_STATUS_PAGE_NUMBER_MISMATCH:
+			return( "Page number mismatch" );
+
+		case LIBESEDB_PAGE_STATUS_INVALID_PAGE_TAGS:
+			return( "Invalid page tags" );
+
+		case LIBESEDB_PAGE_STATUS_NOT_VERIFIED:
+			return( "Not verified" );
+
+		default:
+			return( "Unknown" );
+	}
+}
+
+/* Creates a verification handle
+ * Make sure the value verification_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_initialize(
+     verification_handle_t **verification_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "verification_handle_initialize";
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *verification_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid verification handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*verification_handle = memory_allocate_structure(
+	                verification_handle_t );
+
+	if( *verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create verification handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *verification_handle,
+	     0,
+	     sizeof( verification_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear verification handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_file_initialize(
+	     &( ( *verification_handle )->input_file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize input file.",
+		 function );
+
+		goto on_error;
+	}
+	( *verification_handle )->number_of_threads = VERIFICATION_HANDLE_DEFAULT_NUMBER_OF_THREADS;
+	( *verification_handle )->notify_stream     = VERIFICATION_HANDLE_NOTIFY_STREAM;
+
+	return( 1 );
+
+on_error:
+	if( *verification_handle != NULL )
+	{
+		memory_free(
+		 *verification_handle );
+
+		*verification_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a verification handle
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_free(
+     verification_handle_t **verification_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "verification_handle_free";
+	int result            = 1;
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *verification_handle != NULL )
+	{
+		if( libesedb_file_free(
+		     &( ( *verification_handle )->input_file ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free input file.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *verification_handle );
+
+		*verification_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the verification handle to abort
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_signal_abort(
+     verification_handle_t *verification_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "verification_handle_signal_abort";
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	verification_handle->abort = 1;
+
+	if( verification_handle->input_file != NULL )
+	{
+		if( libesedb_file_signal_abort(
+		     verification_handle->input_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal input file to abort.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Sets the number of threads
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int verification_handle_set_number_of_threads(
+     verification_handle_t *verification_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "verification_handle_set_number_of_threads";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+	int result            = 0;
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	result = esedbtools_system_string_copy_to_64_bit_in_decimal(
+	          string,
+	          string_length + 1,
+	          &value_64bit,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to 64-bit value.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( ( value_64bit == 0 )
+		 || ( value_64bit > (uint64_t) INT_MAX ) )
+		{
+			result = 0;
+		}
+		else
+		{
+			verification_handle->number_of_threads = (int) value_64bit;
+		}
+	}
+	return( result );
+}
+
+/* Opens the verification handle
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_open(
+     verification_handle_t *verification_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "verification_handle_open";
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libesedb_file_open_wide(
+	     verification_handle->input_file,
+	     filename,
+	     LIBESEDB_OPEN_READ,
+	     error ) != 1 )
+#else
+	if( libesedb_file_open(
+	     verification_handle->input_file,
+	     filename,
+	     LIBESEDB_OPEN_READ,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input file.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Closes the verification handle
+ * Returns the 0 if succesful or -1 on error
+ */
+int verification_handle_close(
+     verification_handle_t *verification_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "verification_handle_close";
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_file_close(
+	     verification_handle->input_file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input file.",
+		 function );
+
+		return( -1 );
+	}
+	return( 0 );
+}
+
+/* Verifies the pages and prints the corrupted pages to a stream
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int verification_handle_verify_pages(
+     verification_handle_t *verification_handle,
+     libcerror_error_t **error )
+{
+	uint8_t *pages_status    = NULL;
+	static char *function    = "verification_handle_verify_pages";
+	uint32_t number_of_pages = 0;
+	uint32_t page_index      = 0;
+	int result               = 0;
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_file_get_number_of_pages(
+	     verification_handle->input_file,
+	     &number_of_pages,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of pages.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_pages > 0 )
+	{
+		pages_status = (uint8_t *) memory_allocate(
+		                            sizeof( uint8_t ) * number_of_pages );
+
+		if( pages_status == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create pages status.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	result = libesedb_file_verify_pages(
+	          verification_handle->input_file,
+	          verification_handle->number_of_threads,
+	          pages_status,
+	          (size_t) number_of_pages,
+	          &( verification_handle->number_of_corrupted_pages ),
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to verify pages.",
+		 function );
+
+		goto on_error;
+	}
+	fprintf(
+	 verification_handle->notify_stream,
+	 "Extensible Storage Engine Database page verification:\n" );
+
+	for( page_index = 0;
+	     page_index < number_of_pages;
+	     page_index++ )
+	{
+		if( ( pages_status[ page_index ] != LIBESEDB_PAGE_STATUS_VALID )
+		 && ( pages_status[ page_index ] != LIBESEDB_PAGE_STATUS_EMPTY )
+		 && ( pages_status[ page_index ] != LIBESEDB_PAGE_STATUS_NOT_VERIFIED ) )
+		{
+			fprintf(
+			 verification_handle->notify_stream,
+			 "\tPage: %" PRIu32 "\t\t\t: %s\n",
+			 page_index + 1,
+			 verification_handle_get_page_status_description(
+			  pages_status[ page_index ] ) );
+		}
+	}
+	fprintf(
+	 verification_handle->notify_stream,
+	 "\tNumber of pages\t\t\t: %" PRIu32 "\n",
+	 number_of_pages );
+
+	fprintf(
+	 verification_handle->notify_stream,
+	 "\tNumber of corrupted pages\t: %" PRIu32 "\n",
+	 verification_handle->number_of_corrupted_pages );
+
+	if( result == 0 )
+	{
+		fprintf(
+		 verification_handle->notify_stream,
+		 "\tVerification aborted, not all pages were verified\n" );
+	}
+	fprintf(
+	 verification_handle->notify_stream,
+	 "\n" );
+
+	if( pages_status != NULL )
+	{
+		memory_free(
+		 pages_status );
+	}
+	return( result );
+
+on_error:
+	if( pages_status != NULL )
+	{
+		memory_free(
+		 pages_status );
+	}
+	return( -1 );
+}
+
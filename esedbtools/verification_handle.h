@@ -0,0 +1,103 @@
+/*
+ * Verification handle
+ *
+ * Copyright (C) 2009-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _VERIFICATION_HANDLE_H )
+#define _VERIFICATION_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "esedbtools_libcerror.h"
+#include "esedbtools_libesedb.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The default number of threads used to verify the pages
+ */
+#define VERIFICATION_HANDLE_DEFAULT_NUMBER_OF_THREADS	4
+
+typedef struct verification_handle verification_handle_t;
+
+struct verification_handle
+{
+	/* The libesedb input file
+	 */
+	libesedb_file_t *input_file;
+
+	/* The number of threads used to verify the pages
+	 */
+	int number_of_threads;
+
+	/* The number of corrupted pages
+	 */
+	uint32_t number_of_corrupted_pages;
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+const char *verification_handle_get_page_status_description(
+             uint8_t page_status );
+
+int verification_handle_initialize(
+     verification_handle_t **verification_handle,
+     libcerror_error_t **error );
+
+int verification_handle_free(
+     verification_handle_t **verification_handle,
+     libcerror_error_t **error );
+
+int verification_handle_signal_abort(
+     verification_handle_t *verification_handle,
+     libcerror_error_t **error );
+
+int verification_handle_set_number_of_threads(
+     verification_handle_t *verification_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int verification_handle_open(
+     verification_handle_t *verification_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int verification_handle_close(
+     verification_handle_t *verification_handle,
+     libcerror_error_t **error );
+
+int verification_handle_verify_pages(
+     verification_handle_t *verification_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _VERIFICATION_HANDLE_H ) */
+
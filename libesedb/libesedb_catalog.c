@@ -929,9 +929,10 @@ int libesedb_catalog_read(
 	}
 	catalog_page_tree = NULL;
 
-	if( libfcache_cache_initialize(
+	if( libesedb_io_handle_create_cache(
+	     io_handle,
+	     LIBESEDB_CACHE_TYPE_TREE_VALUES,
 	     &catalog_values_cache,
-	     LIBESEDB_MAXIMUM_CACHE_ENTRIES_TREE_VALUES,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1228,7 +1229,9 @@ int libesedb_catalog_read(
 				break;
 		}
 	}
-	if( libfcache_cache_free(
+	if( libesedb_io_handle_free_cache(
+	     io_handle,
+	     LIBESEDB_CACHE_TYPE_TREE_VALUES,
 	     &catalog_values_cache,
 	     error ) != 1 )
 	{
@@ -1265,7 +1268,9 @@ on_error:
 	}
 	if( catalog_values_cache != NULL )
 	{
-		libfcache_cache_free(
+		libesedb_io_handle_free_cache(
+		 io_handle,
+		 LIBESEDB_CACHE_TYPE_TREE_VALUES,
 		 &catalog_values_cache,
 		 NULL );
 	}
@@ -157,6 +157,11 @@ int libesedb_catalog_definition_free(
 			memory_free(
 			 ( *catalog_definition )->default_value );
 		}
+		if( ( *catalog_definition )->key_field_identifiers != NULL )
+		{
+			memory_free(
+			 ( *catalog_definition )->key_field_identifiers );
+		}
 		memory_free(
 		 *catalog_definition );
 
@@ -1000,33 +1005,75 @@ int libesedb_catalog_definition_read(
 #endif
 					break;
 
-#if defined( HAVE_DEBUG_OUTPUT )
 				case 132:
-					if( libcnotify_verbose != 0 )
+					/* The MSB signifies that the variable size data type is empty
+					 */
+					if( ( variable_size_data_type_size & 0x8000 ) == 0 )
 					{
-						/* The MSB signifies that the variable size data type is empty
-						 */
-						if( ( variable_size_data_type_size & 0x8000 ) == 0 )
+						catalog_definition->key_field_identifiers_size = (size_t) ( variable_size_data_type_size - previous_variable_size_data_type_size );
+
+						catalog_definition->key_field_identifiers = (uint8_t *) memory_allocate(
+						                                             sizeof( uint8_t ) * catalog_definition->key_field_identifiers_size );
+
+						if( catalog_definition->key_field_identifiers == NULL )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_MEMORY,
+							 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+							 "%s: unable to create key field identifiers.",
+							 function );
+
+							catalog_definition->key_field_identifiers_size = 0;
+
+							return( -1 );
+						}
+						if( memory_copy(
+						     catalog_definition->key_field_identifiers,
+						     &( variable_size_data_type_value_data[ previous_variable_size_data_type_size ] ),
+						     catalog_definition->key_field_identifiers_size ) == NULL )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_MEMORY,
+							 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+							 "%s: unable to set key field identifiers.",
+							 function );
+
+							memory_free(
+							 catalog_definition->key_field_identifiers );
+
+							catalog_definition->key_field_identifiers      = NULL;
+							catalog_definition->key_field_identifiers_size = 0;
+
+							return( -1 );
+						}
+#if defined( HAVE_DEBUG_OUTPUT )
+						if( libcnotify_verbose != 0 )
 						{
 							libcnotify_printf(
 							 "%s: (%03" PRIu8 ") KeyFldIDs:\n",
 							 function,
 							 data_type_number );
 							libcnotify_print_data(
-							 &( variable_size_data_type_value_data[ previous_variable_size_data_type_size ] ),
-							 variable_size_data_type_size - previous_variable_size_data_type_size,
+							 catalog_definition->key_field_identifiers,
+							 catalog_definition->key_field_identifiers_size,
 							 0 );
 						}
-						else
-						{
-							libcnotify_printf(
-							 "%s: (%03" PRIu8 ") KeyFldIDs\t\t\t\t\t: <NULL>\n",
-							 function,
-							 data_type_number );
-						}
+#endif
+					}
+#if defined( HAVE_DEBUG_OUTPUT )
+					else if( libcnotify_verbose != 0 )
+					{
+						libcnotify_printf(
+						 "%s: (%03" PRIu8 ") KeyFldIDs\t\t\t\t\t: <NULL>\n",
+						 function,
+						 data_type_number );
 					}
+#endif
 					break;
 
+#if defined( HAVE_DEBUG_OUTPUT )
 				case 133:
 					if( libcnotify_verbose != 0 )
 					{
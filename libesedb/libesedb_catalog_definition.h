@@ -99,6 +99,14 @@ struct libesedb_catalog_definition
 	/* The default value size
 	 */
 	size_t default_value_size;
+
+	/* The key field identifiers (KeyFldIDs)
+	 */
+	uint8_t *key_field_identifiers;
+
+	/* The key field identifiers size
+	 */
+	size_t key_field_identifiers_size;
 };
 
 int libesedb_catalog_definition_initialize(
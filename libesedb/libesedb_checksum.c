@@ -24,8 +24,21 @@
 #include <types.h>
 
 #include "libesedb_checksum.h"
+#include "libesedb_definitions.h"
 #include "libesedb_libcerror.h"
 
+#if defined( HAVE_LIBESEDB_CHECKSUM_SSE2 )
+#include <emmintrin.h>
+#endif
+
+#if defined( HAVE_LIBESEDB_CHECKSUM_AVX2 )
+#include <immintrin.h>
+#endif
+
+#if defined( HAVE_LIBESEDB_CHECKSUM_NEON )
+#include <arm_neon.h>
+#endif
+
 /* The largest primary (or scalar) available
  * supported by a single load and store instruction
  */
@@ -52,8 +65,498 @@ const uint8_t libesedb_checksum_ecc32_include_lookup_table[ 256 ] = {
 	0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0
 };
 
+/* Retrieves the fastest checksum kernel supported by the CPU
+ * Returns a LIBESEDB_CHECKSUM_KERNEL value
+ */
+int libesedb_checksum_get_kernel(
+     void )
+{
+#if defined( HAVE_LIBESEDB_CHECKSUM_AVX2 )
+	if( libesedb_checksum_kernel_is_supported(
+	     LIBESEDB_CHECKSUM_KERNEL_AVX2 ) != 0 )
+	{
+		return( LIBESEDB_CHECKSUM_KERNEL_AVX2 );
+	}
+#endif
+#if defined( HAVE_LIBESEDB_CHECKSUM_SSE2 )
+	return( LIBESEDB_CHECKSUM_KERNEL_SSE2 );
+
+#elif defined( HAVE_LIBESEDB_CHECKSUM_NEON )
+	return( LIBESEDB_CHECKSUM_KERNEL_NEON );
+
+#else
+	return( LIBESEDB_CHECKSUM_KERNEL_SCALAR );
+
+#endif
+}
+
+/* Determines if a checksum kernel is supported by the build and the CPU
+ * Returns 1 if supported or 0 if not
+ */
+int libesedb_checksum_kernel_is_supported(
+     int kernel )
+{
+	switch( kernel )
+	{
+		case LIBESEDB_CHECKSUM_KERNEL_SCALAR:
+			return( 1 );
+
+#if defined( HAVE_LIBESEDB_CHECKSUM_SSE2 )
+		case LIBESEDB_CHECKSUM_KERNEL_SSE2:
+			return( 1 );
+#endif
+
+#if defined( HAVE_LIBESEDB_CHECKSUM_AVX2 )
+		case LIBESEDB_CHECKSUM_KERNEL_AVX2:
+			__builtin_cpu_init();
+
+			if( __builtin_cpu_supports( "avx2" ) )
+			{
+				return( 1 );
+			}
+			return( 0 );
+#endif
+
+#if defined( HAVE_LIBESEDB_CHECKSUM_NEON )
+		case LIBESEDB_CHECKSUM_KERNEL_NEON:
+			return( 1 );
+#endif
+
+		default:
+			break;
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_LIBESEDB_CHECKSUM_SSE2 )
+
+/* Calculates the ECC-32 bitmasks and vertical XOR of 16-byte blocks using SSE2
+ * The blocks are processed 4 at a time, the 32-bit values of the 4 blocks are
+ * transposed so that every lane contains the XOR of a single block
+ * The bitmask is updated for every processed block and the vertical XOR values
+ * of the processed blocks are added to the 4 values in xor32_vertical_values
+ * Returns the number of blocks processed
+ */
+size_t libesedb_checksum_calculate_ecc32_blocks_sse2(
+        const uint8_t *buffer,
+        size_t number_of_blocks,
+        uint32_t *bitmask,
+        uint32_t *ecc32_value,
+        uint32_t *xor32_vertical_values )
+{
+	uint32_t values_32bit[ 4 ];
+
+	__m128i bitmask_decrement = _mm_set1_epi32( (int) ( 4 * 0x007fff80UL ) );
+	__m128i bitmask_vector    = _mm_setzero_si128();
+	__m128i block1            = _mm_setzero_si128();
+	__m128i block2            = _mm_setzero_si128();
+	__m128i block3            = _mm_setzero_si128();
+	__m128i block4            = _mm_setzero_si128();
+	__m128i ecc32_vector      = _mm_setzero_si128();
+	__m128i parity_vector     = _mm_setzero_si128();
+	__m128i vertical_vector   = _mm_setzero_si128();
+	__m128i xor_vector1       = _mm_setzero_si128();
+	__m128i xor_vector2       = _mm_setzero_si128();
+	size_t block_index        = 0;
+	uint32_t block_bitmask    = *bitmask;
+
+	bitmask_vector = _mm_set_epi32(
+	                  (int) ( block_bitmask - (uint32_t) ( 3 * 0x007fff80UL ) ),
+	                  (int) ( block_bitmask - (uint32_t) ( 2 * 0x007fff80UL ) ),
+	                  (int) ( block_bitmask - (uint32_t) 0x007fff80UL ),
+	                  (int) block_bitmask );
+
+	while( ( number_of_blocks - block_index ) >= 4 )
+	{
+		block1 = _mm_loadu_si128( (const __m128i *) buffer );
+		block2 = _mm_loadu_si128( (const __m128i *) &( buffer[ 16 ] ) );
+		block3 = _mm_loadu_si128( (const __m128i *) &( buffer[ 32 ] ) );
+		block4 = _mm_loadu_si128( (const __m128i *) &( buffer[ 48 ] ) );
+
+		vertical_vector = _mm_xor_si128(
+		                   vertical_vector,
+		                   _mm_xor_si128(
+		                    _mm_xor_si128( block1, block2 ),
+		                    _mm_xor_si128( block3, block4 ) ) );
+
+		/* Fold the 4 32-bit values of every block into a lane
+		 */
+		xor_vector1 = _mm_xor_si128(
+		               _mm_unpacklo_epi32( block1, block2 ),
+		               _mm_unpackhi_epi32( block1, block2 ) );
+		xor_vector2 = _mm_xor_si128(
+		               _mm_unpacklo_epi32( block3, block4 ),
+		               _mm_unpackhi_epi32( block3, block4 ) );
+
+		parity_vector = _mm_xor_si128(
+		                 _mm_unpacklo_epi64( xor_vector1, xor_vector2 ),
+		                 _mm_unpackhi_epi64( xor_vector1, xor_vector2 ) );
+
+		parity_vector = _mm_xor_si128( parity_vector, _mm_srli_epi32( parity_vector, 16 ) );
+		parity_vector = _mm_xor_si128( parity_vector, _mm_srli_epi32( parity_vector, 8 ) );
+		parity_vector = _mm_xor_si128( parity_vector, _mm_srli_epi32( parity_vector, 4 ) );
+		parity_vector = _mm_xor_si128( parity_vector, _mm_srli_epi32( parity_vector, 2 ) );
+		parity_vector = _mm_xor_si128( parity_vector, _mm_srli_epi32( parity_vector, 1 ) );
+
+		/* The bitmask is only included if the parity of the block is odd
+		 */
+		parity_vector = _mm_sub_epi32(
+		                 _mm_setzero_si128(),
+		                 _mm_and_si128( parity_vector, _mm_set1_epi32( 1 ) ) );
+
+		ecc32_vector = _mm_xor_si128(
+		                ecc32_vector,
+		                _mm_and_si128( parity_vector, bitmask_vector ) );
+
+		bitmask_vector = _mm_sub_epi32( bitmask_vector, bitmask_decrement );
+
+		buffer      += 64;
+		block_index += 4;
+	}
+	_mm_storeu_si128( (__m128i *) values_32bit, ecc32_vector );
+
+	*ecc32_value ^= values_32bit[ 0 ] ^ values_32bit[ 1 ] ^ values_32bit[ 2 ] ^ values_32bit[ 3 ];
+
+	_mm_storeu_si128( (__m128i *) values_32bit, vertical_vector );
+
+	xor32_vertical_values[ 0 ] ^= values_32bit[ 0 ];
+	xor32_vertical_values[ 1 ] ^= values_32bit[ 1 ];
+	xor32_vertical_values[ 2 ] ^= values_32bit[ 2 ];
+	xor32_vertical_values[ 3 ] ^= values_32bit[ 3 ];
+
+	*bitmask = block_bitmask - ( (uint32_t) block_index * (uint32_t) 0x007fff80UL );
+
+	return( block_index );
+}
+
+/* Calculates the little-endian XOR-32 of the 64-byte blocks of a buffer using SSE2
+ * The XOR-32 of the processed bytes is added to xor32_value
+ * Returns the number of bytes processed
+ */
+size_t libesedb_checksum_calculate_xor32_sse2(
+        const uint8_t *buffer,
+        size_t size,
+        uint32_t *xor32_value )
+{
+	uint32_t values_32bit[ 4 ];
+
+	__m128i xor_vector1 = _mm_setzero_si128();
+	__m128i xor_vector2 = _mm_setzero_si128();
+	__m128i xor_vector3 = _mm_setzero_si128();
+	__m128i xor_vector4 = _mm_setzero_si128();
+	size_t buffer_index = 0;
+
+	while( ( size - buffer_index ) >= 64 )
+	{
+		xor_vector1 = _mm_xor_si128( xor_vector1, _mm_loadu_si128( (const __m128i *) &( buffer[ buffer_index ] ) ) );
+		xor_vector2 = _mm_xor_si128( xor_vector2, _mm_loadu_si128( (const __m128i *) &( buffer[ buffer_index + 16 ] ) ) );
+		xor_vector3 = _mm_xor_si128( xor_vector3, _mm_loadu_si128( (const __m128i *) &( buffer[ buffer_index + 32 ] ) ) );
+		xor_vector4 = _mm_xor_si128( xor_vector4, _mm_loadu_si128( (const __m128i *) &( buffer[ buffer_index + 48 ] ) ) );
+
+		buffer_index += 64;
+	}
+	xor_vector1 = _mm_xor_si128(
+	               _mm_xor_si128( xor_vector1, xor_vector2 ),
+	               _mm_xor_si128( xor_vector3, xor_vector4 ) );
+
+	_mm_storeu_si128( (__m128i *) values_32bit, xor_vector1 );
+
+	*xor32_value ^= values_32bit[ 0 ] ^ values_32bit[ 1 ] ^ values_32bit[ 2 ] ^ values_32bit[ 3 ];
+
+	return( buffer_index );
+}
+
+#endif /* defined( HAVE_LIBESEDB_CHECKSUM_SSE2 ) */
+
+#if defined( HAVE_LIBESEDB_CHECKSUM_AVX2 )
+
+/* Calculates the ECC-32 bitmasks and vertical XOR of 16-byte blocks using AVX2
+ * The blocks are processed 8 at a time, the lower 128-bit lanes contain the blocks
+ * with an even index and the upper 128-bit lanes the blocks with an odd index
+ * The bitmask is updated for every processed block and the vertical XOR values
+ * of the processed blocks are added to the 4 values in xor32_vertical_values
+ * Returns the number of blocks processed
+ */
+LIBESEDB_CHECKSUM_ATTRIBUTE_AVX2 \
+size_t libesedb_checksum_calculate_ecc32_blocks_avx2(
+        const uint8_t *buffer,
+        size_t number_of_blocks,
+        uint32_t *bitmask,
+        uint32_t *ecc32_value,
+        uint32_t *xor32_vertical_values )
+{
+	uint32_t values_32bit[ 8 ];
+
+	__m256i bitmask_decrement = _mm256_set1_epi32( (int) ( 8 * 0x007fff80UL ) );
+	__m256i bitmask_vector    = _mm256_setzero_si256();
+	__m256i blocks1           = _mm256_setzero_si256();
+	__m256i blocks2           = _mm256_setzero_si256();
+	__m256i blocks3           = _mm256_setzero_si256();
+	__m256i blocks4           = _mm256_setzero_si256();
+	__m256i ecc32_vector      = _mm256_setzero_si256();
+	__m256i parity_vector     = _mm256_setzero_si256();
+	__m256i vertical_vector   = _mm256_setzero_si256();
+	__m256i xor_vector1       = _mm256_setzero_si256();
+	__m256i xor_vector2       = _mm256_setzero_si256();
+	size_t block_index        = 0;
+	uint32_t block_bitmask    = *bitmask;
+
+	bitmask_vector = _mm256_setr_epi32(
+	                  (int) block_bitmask,
+	                  (int) ( block_bitmask - (uint32_t) ( 2 * 0x007fff80UL ) ),
+	                  (int) ( block_bitmask - (uint32_t) ( 4 * 0x007fff80UL ) ),
+	                  (int) ( block_bitmask - (uint32_t) ( 6 * 0x007fff80UL ) ),
+	                  (int) ( block_bitmask - (uint32_t) 0x007fff80UL ),
+	                  (int) ( block_bitmask - (uint32_t) ( 3 * 0x007fff80UL ) ),
+	                  (int) ( block_bitmask - (uint32_t) ( 5 * 0x007fff80UL ) ),
+	                  (int) ( block_bitmask - (uint32_t) ( 7 * 0x007fff80UL ) ) );
+
+	while( ( number_of_blocks - block_index ) >= 8 )
+	{
+		blocks1 = _mm256_loadu_si256( (const __m256i *) buffer );
+		blocks2 = _mm256_loadu_si256( (const __m256i *) &( buffer[ 32 ] ) );
+		blocks3 = _mm256_loadu_si256( (const __m256i *) &( buffer[ 64 ] ) );
+		blocks4 = _mm256_loadu_si256( (const __m256i *) &( buffer[ 96 ] ) );
+
+		vertical_vector = _mm256_xor_si256(
+		                   vertical_vector,
+		                   _mm256_xor_si256(
+		                    _mm256_xor_si256( blocks1, blocks2 ),
+		                    _mm256_xor_si256( blocks3, blocks4 ) ) );
+
+		/* Fold the 4 32-bit values of every block into a lane
+		 */
+		xor_vector1 = _mm256_xor_si256(
+		               _mm256_unpacklo_epi32( blocks1, blocks2 ),
+		               _mm256_unpackhi_epi32( blocks1, blocks2 ) );
+		xor_vector2 = _mm256_xor_si256(
+		               _mm256_unpacklo_epi32( blocks3, blocks4 ),
+		               _mm256_unpackhi_epi32( blocks3, blocks4 ) );
+
+		parity_vector = _mm256_xor_si256(
+		                 _mm256_unpacklo_epi64( xor_vector1, xor_vector2 ),
+		                 _mm256_unpackhi_epi64( xor_vector1, xor_vector2 ) );
+
+		parity_vector = _mm256_xor_si256( parity_vector, _mm256_srli_epi32( parity_vector, 16 ) );
+		parity_vector = _mm256_xor_si256( parity_vector, _mm256_srli_epi32( parity_vector, 8 ) );
+		parity_vector = _mm256_xor_si256( parity_vector, _mm256_srli_epi32( parity_vector, 4 ) );
+		parity_vector = _mm256_xor_si256( parity_vector, _mm256_srli_epi32( parity_vector, 2 ) );
+		parity_vector = _mm256_xor_si256( parity_vector, _mm256_srli_epi32( parity_vector, 1 ) );
+
+		/* The bitmask is only included if the parity of the block is odd
+		 */
+		parity_vector = _mm256_sub_epi32(
+		                 _mm256_setzero_si256(),
+		                 _mm256_and_si256( parity_vector, _mm256_set1_epi32( 1 ) ) );
+
+		ecc32_vector = _mm256_xor_si256(
+		                ecc32_vector,
+		                _mm256_and_si256( parity_vector, bitmask_vector ) );
+
+		bitmask_vector = _mm256_sub_epi32( bitmask_vector, bitmask_decrement );
+
+		buffer      += 128;
+		block_index += 8;
+	}
+	_mm256_storeu_si256( (__m256i *) values_32bit, ecc32_vector );
+
+	*ecc32_value ^= values_32bit[ 0 ] ^ values_32bit[ 1 ] ^ values_32bit[ 2 ] ^ values_32bit[ 3 ]
+	              ^ values_32bit[ 4 ] ^ values_32bit[ 5 ] ^ values_32bit[ 6 ] ^ values_32bit[ 7 ];
+
+	_mm256_storeu_si256( (__m256i *) values_32bit, vertical_vector );
+
+	xor32_vertical_values[ 0 ] ^= values_32bit[ 0 ] ^ values_32bit[ 4 ];
+	xor32_vertical_values[ 1 ] ^= values_32bit[ 1 ] ^ values_32bit[ 5 ];
+	xor32_vertical_values[ 2 ] ^= values_32bit[ 2 ] ^ values_32bit[ 6 ];
+	xor32_vertical_values[ 3 ] ^= values_32bit[ 3 ] ^ values_32bit[ 7 ];
+
+	*bitmask = block_bitmask - ( (uint32_t) block_index * (uint32_t) 0x007fff80UL );
+
+	return( block_index );
+}
+
+/* Calculates the little-endian XOR-32 of the 128-byte blocks of a buffer using AVX2
+ * The XOR-32 of the processed bytes is added to xor32_value
+ * Returns the number of bytes processed
+ */
+LIBESEDB_CHECKSUM_ATTRIBUTE_AVX2 \
+size_t libesedb_checksum_calculate_xor32_avx2(
+        const uint8_t *buffer,
+        size_t size,
+        uint32_t *xor32_value )
+{
+	uint32_t values_32bit[ 8 ];
+
+	__m256i xor_vector1 = _mm256_setzero_si256();
+	__m256i xor_vector2 = _mm256_setzero_si256();
+	__m256i xor_vector3 = _mm256_setzero_si256();
+	__m256i xor_vector4 = _mm256_setzero_si256();
+	size_t buffer_index = 0;
+
+	while( ( size - buffer_index ) >= 128 )
+	{
+		xor_vector1 = _mm256_xor_si256( xor_vector1, _mm256_loadu_si256( (const __m256i *) &( buffer[ buffer_index ] ) ) );
+		xor_vector2 = _mm256_xor_si256( xor_vector2, _mm256_loadu_si256( (const __m256i *) &( buffer[ buffer_index + 32 ] ) ) );
+		xor_vector3 = _mm256_xor_si256( xor_vector3, _mm256_loadu_si256( (const __m256i *) &( buffer[ buffer_index + 64 ] ) ) );
+		xor_vector4 = _mm256_xor_si256( xor_vector4, _mm256_loadu_si256( (const __m256i *) &( buffer[ buffer_index + 96 ] ) ) );
+
+		buffer_index += 128;
+	}
+	xor_vector1 = _mm256_xor_si256(
+	               _mm256_xor_si256( xor_vector1, xor_vector2 ),
+	               _mm256_xor_si256( xor_vector3, xor_vector4 ) );
+
+	_mm256_storeu_si256( (__m256i *) values_32bit, xor_vector1 );
+
+	*xor32_value ^= values_32bit[ 0 ] ^ values_32bit[ 1 ] ^ values_32bit[ 2 ] ^ values_32bit[ 3 ]
+	              ^ values_32bit[ 4 ] ^ values_32bit[ 5 ] ^ values_32bit[ 6 ] ^ values_32bit[ 7 ];
+
+	return( buffer_index );
+}
+
+#endif /* defined( HAVE_LIBESEDB_CHECKSUM_AVX2 ) */
+
+#if defined( HAVE_LIBESEDB_CHECKSUM_NEON )
+
+/* Calculates the ECC-32 bitmasks and vertical XOR of 16-byte blocks using NEON
+ * The blocks are processed 4 at a time, the 32-bit values of the 4 blocks are
+ * de-interleaved so that every lane contains the XOR of a single block
+ * The bitmask is updated for every processed block and the vertical XOR values
+ * of the processed blocks are added to the 4 values in xor32_vertical_values
+ * Returns the number of blocks processed
+ */
+size_t libesedb_checksum_calculate_ecc32_blocks_neon(
+        const uint8_t *buffer,
+        size_t number_of_blocks,
+        uint32_t *bitmask,
+        uint32_t *ecc32_value,
+        uint32_t *xor32_vertical_values )
+{
+	uint32_t values_32bit[ 4 ];
+
+	uint32x4x2_t unzipped_vectors;
+	uint32x4_t bitmask_decrement = vdupq_n_u32( (uint32_t) ( 4 * 0x007fff80UL ) );
+	uint32x4_t bitmask_vector    = vdupq_n_u32( 0 );
+	uint32x4_t block1            = vdupq_n_u32( 0 );
+	uint32x4_t block2            = vdupq_n_u32( 0 );
+	uint32x4_t block3            = vdupq_n_u32( 0 );
+	uint32x4_t block4            = vdupq_n_u32( 0 );
+	uint32x4_t ecc32_vector      = vdupq_n_u32( 0 );
+	uint32x4_t parity_vector     = vdupq_n_u32( 0 );
+	uint32x4_t vertical_vector   = vdupq_n_u32( 0 );
+	uint32x4_t xor_vector1       = vdupq_n_u32( 0 );
+	uint32x4_t xor_vector2       = vdupq_n_u32( 0 );
+	size_t block_index           = 0;
+	uint32_t block_bitmask       = *bitmask;
+
+	values_32bit[ 0 ] = block_bitmask;
+	values_32bit[ 1 ] = block_bitmask - (uint32_t) 0x007fff80UL;
+	values_32bit[ 2 ] = block_bitmask - (uint32_t) ( 2 * 0x007fff80UL );
+	values_32bit[ 3 ] = block_bitmask - (uint32_t) ( 3 * 0x007fff80UL );
+
+	bitmask_vector = vld1q_u32( values_32bit );
+
+	while( ( number_of_blocks - block_index ) >= 4 )
+	{
+		block1 = vreinterpretq_u32_u8( vld1q_u8( buffer ) );
+		block2 = vreinterpretq_u32_u8( vld1q_u8( &( buffer[ 16 ] ) ) );
+		block3 = vreinterpretq_u32_u8( vld1q_u8( &( buffer[ 32 ] ) ) );
+		block4 = vreinterpretq_u32_u8( vld1q_u8( &( buffer[ 48 ] ) ) );
+
+		vertical_vector = veorq_u32(
+		                   vertical_vector,
+		                   veorq_u32(
+		                    veorq_u32( block1, block2 ),
+		                    veorq_u32( block3, block4 ) ) );
+
+		/* Fold the 4 32-bit values of every block into a lane
+		 */
+		unzipped_vectors = vuzpq_u32( block1, block2 );
+		xor_vector1      = veorq_u32( unzipped_vectors.val[ 0 ], unzipped_vectors.val[ 1 ] );
+
+		unzipped_vectors = vuzpq_u32( block3, block4 );
+		xor_vector2      = veorq_u32( unzipped_vectors.val[ 0 ], unzipped_vectors.val[ 1 ] );
+
+		unzipped_vectors = vuzpq_u32( xor_vector1, xor_vector2 );
+		parity_vector    = veorq_u32( unzipped_vectors.val[ 0 ], unzipped_vectors.val[ 1 ] );
+
+		parity_vector = veorq_u32( parity_vector, vshrq_n_u32( parity_vector, 16 ) );
+		parity_vector = veorq_u32( parity_vector, vshrq_n_u32( parity_vector, 8 ) );
+		parity_vector = veorq_u32( parity_vector, vshrq_n_u32( parity_vector, 4 ) );
+		parity_vector = veorq_u32( parity_vector, vshrq_n_u32( parity_vector, 2 ) );
+		parity_vector = veorq_u32( parity_vector, vshrq_n_u32( parity_vector, 1 ) );
+
+		/* The bitmask is only included if the parity of the block is odd
+		 */
+		parity_vector = vtstq_u32( parity_vector, vdupq_n_u32( 1 ) );
+
+		ecc32_vector = veorq_u32(
+		                ecc32_vector,
+		                vandq_u32( parity_vector, bitmask_vector ) );
+
+		bitmask_vector = vsubq_u32( bitmask_vector, bitmask_decrement );
+
+		buffer      += 64;
+		block_index += 4;
+	}
+	vst1q_u32( values_32bit, ecc32_vector );
+
+	*ecc32_value ^= values_32bit[ 0 ] ^ values_32bit[ 1 ] ^ values_32bit[ 2 ] ^ values_32bit[ 3 ];
+
+	vst1q_u32( values_32bit, vertical_vector );
+
+	xor32_vertical_values[ 0 ] ^= values_32bit[ 0 ];
+	xor32_vertical_values[ 1 ] ^= values_32bit[ 1 ];
+	xor32_vertical_values[ 2 ] ^= values_32bit[ 2 ];
+	xor32_vertical_values[ 3 ] ^= values_32bit[ 3 ];
+
+	*bitmask = block_bitmask - ( (uint32_t) block_index * (uint32_t) 0x007fff80UL );
+
+	return( block_index );
+}
+
+/* Calculates the little-endian XOR-32 of the 64-byte blocks of a buffer using NEON
+ * The XOR-32 of the processed bytes is added to xor32_value
+ * Returns the number of bytes processed
+ */
+size_t libesedb_checksum_calculate_xor32_neon(
+        const uint8_t *buffer,
+        size_t size,
+        uint32_t *xor32_value )
+{
+	uint32_t values_32bit[ 4 ];
+
+	uint32x4_t xor_vector1 = vdupq_n_u32( 0 );
+	uint32x4_t xor_vector2 = vdupq_n_u32( 0 );
+	uint32x4_t xor_vector3 = vdupq_n_u32( 0 );
+	uint32x4_t xor_vector4 = vdupq_n_u32( 0 );
+	size_t buffer_index    = 0;
+
+	while( ( size - buffer_index ) >= 64 )
+	{
+		xor_vector1 = veorq_u32( xor_vector1, vreinterpretq_u32_u8( vld1q_u8( &( buffer[ buffer_index ] ) ) ) );
+		xor_vector2 = veorq_u32( xor_vector2, vreinterpretq_u32_u8( vld1q_u8( &( buffer[ buffer_index + 16 ] ) ) ) );
+		xor_vector3 = veorq_u32( xor_vector3, vreinterpretq_u32_u8( vld1q_u8( &( buffer[ buffer_index + 32 ] ) ) ) );
+		xor_vector4 = veorq_u32( xor_vector4, vreinterpretq_u32_u8( vld1q_u8( &( buffer[ buffer_index + 48 ] ) ) ) );
+
+		buffer_index += 64;
+	}
+	xor_vector1 = veorq_u32(
+	               veorq_u32( xor_vector1, xor_vector2 ),
+	               veorq_u32( xor_vector3, xor_vector4 ) );
+
+	vst1q_u32( values_32bit, xor_vector1 );
+
+	*xor32_value ^= values_32bit[ 0 ] ^ values_32bit[ 1 ] ^ values_32bit[ 2 ] ^ values_32bit[ 3 ];
+
+	return( buffer_index );
+}
+
+#endif /* defined( HAVE_LIBESEDB_CHECKSUM_NEON ) */
+
 /* Calculates the little-endian ECC-32 and XOR-32 of a buffer
  * It uses the initial value to calculate a new XOR-32
+ * The fastest checksum kernel supported by the CPU is used
  * Returns 1 if successful or -1 on error
  */
 int libesedb_checksum_calculate_little_endian_ecc32(
@@ -65,20 +568,65 @@ int libesedb_checksum_calculate_little_endian_ecc32(
      uint32_t initial_value,
      libcerror_error_t **error )
 {
-	static char *function          = "libesedb_checksum_calculate_little_endian_ecc32";
-	size_t buffer_iterator         = 0;
-	size_t buffer_alignment        = 0;
-	uint32_t bitmask               = 0;
-	uint32_t bit_iterator          = 0;
-	uint32_t final_bitmask         = 0;
-	uint32_t value_32bit           = 0;
-	uint32_t xor32_value           = 0;
-	uint32_t xor32_vertical_first  = 0;
-	uint32_t xor32_vertical_second = 0;
-	uint32_t xor32_vertical_third  = 0;
-	uint32_t xor32_vertical_fourth = 0;
-	uint8_t mask_table_index       = 0;
+	return( libesedb_checksum_calculate_little_endian_ecc32_with_kernel(
+	         libesedb_checksum_get_kernel(),
+	         ecc_checksum_value,
+	         xor_checksum_value,
+	         buffer,
+	         size,
+	         offset,
+	         initial_value,
+	         error ) );
+}
 
+/* Calculates the little-endian ECC-32 and XOR-32 of a buffer using a specific kernel
+ * It uses the initial value to calculate a new XOR-32
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_checksum_calculate_little_endian_ecc32_with_kernel(
+     int kernel,
+     uint32_t *ecc_checksum_value,
+     uint32_t *xor_checksum_value,
+     const uint8_t *buffer,
+     size_t size,
+     size_t offset,
+     uint32_t initial_value,
+     libcerror_error_t **error )
+{
+	uint32_t xor32_vertical_values[ 4 ]  = { 0, 0, 0, 0 };
+
+	static char *function                = "libesedb_checksum_calculate_little_endian_ecc32_with_kernel";
+	size_t buffer_iterator               = 0;
+	size_t buffer_alignment              = 0;
+	size_t number_of_blocks              = 0;
+	uint64_t value_64bit_first_second    = 0;
+	uint64_t value_64bit_third_fourth    = 0;
+	uint64_t xor64_vertical_first_second = 0;
+	uint64_t xor64_vertical_third_fourth = 0;
+	uint32_t bitmask                     = 0;
+	uint32_t bit_iterator                = 0;
+	uint32_t ecc32_value                 = 0;
+	uint32_t final_bitmask               = 0;
+	uint32_t value_32bit                 = 0;
+	uint32_t xor32_value                 = 0;
+	uint32_t xor32_vertical_first        = 0;
+	uint32_t xor32_vertical_second       = 0;
+	uint32_t xor32_vertical_third        = 0;
+	uint32_t xor32_vertical_fourth       = 0;
+	uint8_t mask_table_index             = 0;
+
+	if( libesedb_checksum_kernel_is_supported(
+	     kernel ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported kernel.",
+		 function );
+
+		return( -1 );
+	}
 	if( ecc_checksum_value == NULL )
 	{
 		libcerror_error_set(
@@ -147,15 +695,95 @@ int libesedb_checksum_calculate_little_endian_ecc32(
 
 		return( -1 );
 	}
-	*ecc_checksum_value = 0;
-	*xor_checksum_value = initial_value;
-	bitmask             = 0xff800000UL;
-	buffer             += offset;
-
-	for( buffer_iterator = offset;
-	     buffer_iterator < size;
-	     buffer_iterator += 4 )
+	bitmask          = 0xff800000UL;
+	buffer          += offset;
+	buffer_iterator  = offset;
+
+	while( buffer_iterator < size )
 	{
+		/* Process 16-byte blocks as two 64-bit values, where the lower and upper
+		 * 32-bit of the first value correspond with the first and second vertical
+		 * XOR and the second value with the third and fourth vertical XOR
+		 */
+		if( ( buffer_alignment == 0 )
+		 && ( ( size - buffer_iterator ) >= 16 ) )
+		{
+			number_of_blocks = ( size - buffer_iterator ) / 16;
+
+			switch( kernel )
+			{
+#if defined( HAVE_LIBESEDB_CHECKSUM_SSE2 )
+				case LIBESEDB_CHECKSUM_KERNEL_SSE2:
+					number_of_blocks = libesedb_checksum_calculate_ecc32_blocks_sse2(
+					                    buffer,
+					                    number_of_blocks,
+					                    &bitmask,
+					                    &ecc32_value,
+					                    xor32_vertical_values );
+					break;
+#endif
+#if defined( HAVE_LIBESEDB_CHECKSUM_AVX2 )
+				case LIBESEDB_CHECKSUM_KERNEL_AVX2:
+					number_of_blocks = libesedb_checksum_calculate_ecc32_blocks_avx2(
+					                    buffer,
+					                    number_of_blocks,
+					                    &bitmask,
+					                    &ecc32_value,
+					                    xor32_vertical_values );
+					break;
+#endif
+#if defined( HAVE_LIBESEDB_CHECKSUM_NEON )
+				case LIBESEDB_CHECKSUM_KERNEL_NEON:
+					number_of_blocks = libesedb_checksum_calculate_ecc32_blocks_neon(
+					                    buffer,
+					                    number_of_blocks,
+					                    &bitmask,
+					                    &ecc32_value,
+					                    xor32_vertical_values );
+					break;
+#endif
+				default:
+					number_of_blocks = 0;
+					break;
+			}
+			/* The blocks not processed by the kernel are processed below
+			 */
+			if( number_of_blocks > 0 )
+			{
+				buffer          += number_of_blocks * 16;
+				buffer_iterator += number_of_blocks * 16;
+
+				continue;
+			}
+			byte_stream_copy_to_uint64_little_endian(
+			 buffer,
+			 value_64bit_first_second );
+
+			byte_stream_copy_to_uint64_little_endian(
+			 &( buffer[ 8 ] ),
+			 value_64bit_third_fourth );
+
+			xor64_vertical_first_second ^= value_64bit_first_second;
+			xor64_vertical_third_fourth ^= value_64bit_third_fourth;
+
+			value_64bit_first_second ^= value_64bit_third_fourth;
+
+			xor32_value  = (uint32_t) value_64bit_first_second;
+			xor32_value ^= (uint32_t) ( value_64bit_first_second >> 32 );
+			xor32_value ^= xor32_value >> 16;
+			xor32_value ^= xor32_value >> 8;
+
+			/* The bitmask is only included if the parity of the block is odd
+			 */
+			ecc32_value ^= bitmask & ( 0 - (uint32_t) libesedb_checksum_ecc32_include_lookup_table[ xor32_value & 0xff ] );
+
+			bitmask         -= 0x007fff80UL;
+			buffer          += 16;
+			buffer_iterator += 16;
+			xor32_value      = 0;
+
+			continue;
+		}
 		byte_stream_copy_to_uint32_little_endian(
 		 buffer,
 		 value_32bit );
@@ -178,6 +806,7 @@ int libesedb_checksum_calculate_little_endian_ecc32(
 		}
 		xor32_value      ^= value_32bit;
 		buffer           += 4;
+		buffer_iterator  += 4;
 		buffer_alignment += 4;
 
 		if( buffer_alignment >= 16 )
@@ -192,7 +821,7 @@ int libesedb_checksum_calculate_little_endian_ecc32(
 
 			if( libesedb_checksum_ecc32_include_lookup_table[ mask_table_index ] != 0 )
 			{
-				*ecc_checksum_value ^= bitmask;
+				ecc32_value ^= bitmask;
 			}
 			bitmask         -= 0x007fff80UL;
 			buffer_alignment = 0;
@@ -211,9 +840,14 @@ int libesedb_checksum_calculate_little_endian_ecc32(
 
 		if( libesedb_checksum_ecc32_include_lookup_table[ mask_table_index ] != 0 )
 		{
-			*ecc_checksum_value ^= bitmask;
+			ecc32_value ^= bitmask;
 		}
 	}
+	xor32_vertical_first  ^= (uint32_t) xor64_vertical_first_second ^ xor32_vertical_values[ 0 ];
+	xor32_vertical_second ^= (uint32_t) ( xor64_vertical_first_second >> 32 ) ^ xor32_vertical_values[ 1 ];
+	xor32_vertical_third  ^= (uint32_t) xor64_vertical_third_fourth ^ xor32_vertical_values[ 2 ];
+	xor32_vertical_fourth ^= (uint32_t) ( xor64_vertical_third_fourth >> 32 ) ^ xor32_vertical_values[ 3 ];
+
 	/* Determine the checksum part of the combination of
 	 * the first and second vertical XOR
 	 */
@@ -230,7 +864,7 @@ int libesedb_checksum_calculate_little_endian_ecc32(
 
 	if( libesedb_checksum_ecc32_include_lookup_table[ mask_table_index ] != 0 )
 	{
-		*ecc_checksum_value ^= 0x00400000UL;
+		ecc32_value ^= 0x00400000UL;
 	}
 	/* Determine the checksum part of the combination of
 	 * the first and third vertical XOR
@@ -248,7 +882,7 @@ int libesedb_checksum_calculate_little_endian_ecc32(
 
 	if( libesedb_checksum_ecc32_include_lookup_table[ mask_table_index ] != 0 )
 	{
-		*ecc_checksum_value ^= 0x00200000UL;
+		ecc32_value ^= 0x00200000UL;
 	}
 	/* Determine the checksum part of the combination of
 	 * the second and fourth vertical XOR
@@ -266,7 +900,7 @@ int libesedb_checksum_calculate_little_endian_ecc32(
 
 	if( libesedb_checksum_ecc32_include_lookup_table[ mask_table_index ] != 0 )
 	{
-		*ecc_checksum_value ^= 0x00000020UL;
+		ecc32_value ^= 0x00000020UL;
 	}
 	/* Determine the checksum part of the combination of
 	 * the third and fourth vertical XOR
@@ -284,7 +918,7 @@ int libesedb_checksum_calculate_little_endian_ecc32(
 
 	if( libesedb_checksum_ecc32_include_lookup_table[ mask_table_index ] != 0 )
 	{
-		*ecc_checksum_value ^= 0x00000040UL;
+		ecc32_value ^= 0x00000040UL;
 	}
 	/* Determine the XOR-32
 	 */
@@ -312,16 +946,19 @@ int libesedb_checksum_calculate_little_endian_ecc32(
 	 */
 	if( size < 8192 )
 	{
-		*ecc_checksum_value &= 0xffffffffUL ^ (uint32_t) ( size << 19 );
+		ecc32_value &= 0xffffffffUL ^ (uint32_t) ( size << 19 );
 	}
-	*ecc_checksum_value ^= ( *ecc_checksum_value ^ final_bitmask ) & 0x001f001fUL;
-	*xor_checksum_value ^= xor32_value;
+	ecc32_value ^= ( ecc32_value ^ final_bitmask ) & 0x001f001fUL;
+
+	*ecc_checksum_value = ecc32_value;
+	*xor_checksum_value = initial_value ^ xor32_value;
 
 	return( 1 );
 }
 
 /* Calculates the little-endian XOR-32 of a buffer
  * It uses the initial value to calculate a new XOR-32
+ * The fastest checksum kernel supported by the CPU is used
  * Returns 1 if successful or -1 on error
  */
 int libesedb_checksum_calculate_little_endian_xor32(
@@ -330,11 +967,33 @@ int libesedb_checksum_calculate_little_endian_xor32(
      size_t size,
      uint32_t initial_value,
      libcerror_error_t **error )
+{
+	return( libesedb_checksum_calculate_little_endian_xor32_with_kernel(
+	         libesedb_checksum_get_kernel(),
+	         checksum_value,
+	         buffer,
+	         size,
+	         initial_value,
+	         error ) );
+}
+
+/* Calculates the little-endian XOR-32 of a buffer using a specific kernel
+ * It uses the initial value to calculate a new XOR-32
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_checksum_calculate_little_endian_xor32_with_kernel(
+     int kernel,
+     uint32_t *checksum_value,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     libcerror_error_t **error )
 {
 	libesedb_aligned_t *aligned_buffer_iterator = NULL;
 	uint8_t *buffer_iterator                    = NULL;
-	static char *function                       = "libesedb_checksum_calculate_little_endian_xor32";
+	static char *function                       = "libesedb_checksum_calculate_little_endian_xor32_with_kernel";
 	libesedb_aligned_t value_aligned            = 0;
+	size_t number_of_bytes                      = 0;
 	uint32_t value_32bit                        = 0;
 	uint8_t alignment_count                     = 0;
 	uint8_t alignment_size                      = 0;
@@ -342,6 +1001,18 @@ int libesedb_checksum_calculate_little_endian_xor32(
 	uint8_t byte_order                          = 0;
 	uint8_t byte_size                           = 0;
 
+	if( libesedb_checksum_kernel_is_supported(
+	     kernel ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported kernel.",
+		 function );
+
+		return( -1 );
+	}
 	if( checksum_value == NULL )
 	{
 		libcerror_error_set(
@@ -379,6 +1050,41 @@ int libesedb_checksum_calculate_little_endian_xor32(
 
 	buffer_iterator = (uint8_t *) buffer;
 
+	/* The kernel processes whole blocks, the remaining bytes are processed below
+	 */
+	switch( kernel )
+	{
+#if defined( HAVE_LIBESEDB_CHECKSUM_SSE2 )
+		case LIBESEDB_CHECKSUM_KERNEL_SSE2:
+			number_of_bytes = libesedb_checksum_calculate_xor32_sse2(
+			                   buffer_iterator,
+			                   size,
+			                   checksum_value );
+			break;
+#endif
+#if defined( HAVE_LIBESEDB_CHECKSUM_AVX2 )
+		case LIBESEDB_CHECKSUM_KERNEL_AVX2:
+			number_of_bytes = libesedb_checksum_calculate_xor32_avx2(
+			                   buffer_iterator,
+			                   size,
+			                   checksum_value );
+			break;
+#endif
+#if defined( HAVE_LIBESEDB_CHECKSUM_NEON )
+		case LIBESEDB_CHECKSUM_KERNEL_NEON:
+			number_of_bytes = libesedb_checksum_calculate_xor32_neon(
+			                   buffer_iterator,
+			                   size,
+			                   checksum_value );
+			break;
+#endif
+		default:
+			number_of_bytes = 0;
+			break;
+	}
+	buffer_iterator += number_of_bytes;
+	size            -= number_of_bytes;
+
 	/* Only optimize when there is the alignment is a multitude of 32-bit
 	 * and for buffers larger than the alignment
 	 */
@@ -436,8 +1142,19 @@ int libesedb_checksum_calculate_little_endian_xor32(
 		{
 			byte_order = _BYTE_STREAM_ENDIAN_LITTLE;
 		}
-		/* Determine the aligned XOR value
+		/* Determine the aligned XOR value, 4 aligned values at a time
 		 */
+		while( size > ( 4 * sizeof( libesedb_aligned_t ) ) )
+		{
+			value_aligned ^= aligned_buffer_iterator[ 0 ]
+			               ^ aligned_buffer_iterator[ 1 ]
+			               ^ aligned_buffer_iterator[ 2 ]
+			               ^ aligned_buffer_iterator[ 3 ];
+
+			aligned_buffer_iterator += 4;
+
+			size -= 4 * sizeof( libesedb_aligned_t );
+		}
 		while( size > sizeof( libesedb_aligned_t ) )
 		{
 			value_aligned ^= *aligned_buffer_iterator;
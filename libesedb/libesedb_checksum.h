@@ -27,10 +27,86 @@
 
 #include "libesedb_libcerror.h"
 
+/* SSE2 is part of every x86-64 CPU, AVX2 is detected at run-time
+ */
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || ( defined( __i386__ ) && defined( __SSE2__ ) ) )
+#define HAVE_LIBESEDB_CHECKSUM_SSE2
+
+#if defined( __clang__ ) || ( __GNUC__ > 4 ) || ( ( __GNUC__ == 4 ) && ( __GNUC_MINOR__ >= 9 ) )
+#define HAVE_LIBESEDB_CHECKSUM_AVX2
+#define LIBESEDB_CHECKSUM_ATTRIBUTE_AVX2	__attribute__ ((__target__ ("avx2")))
+#endif
+
+#elif defined( _MSC_VER ) && ( defined( _M_X64 ) || ( defined( _M_IX86_FP ) && ( _M_IX86_FP >= 2 ) ) )
+#define HAVE_LIBESEDB_CHECKSUM_SSE2
+#endif
+
+/* The NEON kernels assume the lanes are stored in little-endian
+ */
+#if ( defined( __ARM_NEON ) || defined( __ARM_NEON__ ) ) && defined( __BYTE_ORDER__ ) && ( __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ )
+#define HAVE_LIBESEDB_CHECKSUM_NEON
+#endif
+
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+int libesedb_checksum_get_kernel(
+     void );
+
+int libesedb_checksum_kernel_is_supported(
+     int kernel );
+
+#if defined( HAVE_LIBESEDB_CHECKSUM_SSE2 )
+
+size_t libesedb_checksum_calculate_ecc32_blocks_sse2(
+        const uint8_t *buffer,
+        size_t number_of_blocks,
+        uint32_t *bitmask,
+        uint32_t *ecc32_value,
+        uint32_t *xor32_vertical_values );
+
+size_t libesedb_checksum_calculate_xor32_sse2(
+        const uint8_t *buffer,
+        size_t size,
+        uint32_t *xor32_value );
+
+#endif /* defined( HAVE_LIBESEDB_CHECKSUM_SSE2 ) */
+
+#if defined( HAVE_LIBESEDB_CHECKSUM_AVX2 )
+
+LIBESEDB_CHECKSUM_ATTRIBUTE_AVX2 \
+size_t libesedb_checksum_calculate_ecc32_blocks_avx2(
+        const uint8_t *buffer,
+        size_t number_of_blocks,
+        uint32_t *bitmask,
+        uint32_t *ecc32_value,
+        uint32_t *xor32_vertical_values );
+
+LIBESEDB_CHECKSUM_ATTRIBUTE_AVX2 \
+size_t libesedb_checksum_calculate_xor32_avx2(
+        const uint8_t *buffer,
+        size_t size,
+        uint32_t *xor32_value );
+
+#endif /* defined( HAVE_LIBESEDB_CHECKSUM_AVX2 ) */
+
+#if defined( HAVE_LIBESEDB_CHECKSUM_NEON )
+
+size_t libesedb_checksum_calculate_ecc32_blocks_neon(
+        const uint8_t *buffer,
+        size_t number_of_blocks,
+        uint32_t *bitmask,
+        uint32_t *ecc32_value,
+        uint32_t *xor32_vertical_values );
+
+size_t libesedb_checksum_calculate_xor32_neon(
+        const uint8_t *buffer,
+        size_t size,
+        uint32_t *xor32_value );
+
+#endif /* defined( HAVE_LIBESEDB_CHECKSUM_NEON ) */
+
 int libesedb_checksum_calculate_little_endian_ecc32(
      uint32_t *ecc_checksum_value,
      uint32_t *xor_checksum_value,
@@ -40,6 +116,16 @@ int libesedb_checksum_calculate_little_endian_ecc32(
      uint32_t initial_value,
      libcerror_error_t **error );
 
+int libesedb_checksum_calculate_little_endian_ecc32_with_kernel(
+     int kernel,
+     uint32_t *ecc_checksum_value,
+     uint32_t *xor_checksum_value,
+     const uint8_t *buffer,
+     size_t size,
+     size_t offset,
+     uint32_t initial_value,
+     libcerror_error_t **error );
+
 int libesedb_checksum_calculate_little_endian_xor32(
      uint32_t *checksum_value,
      const uint8_t *buffer,
@@ -47,6 +133,14 @@ int libesedb_checksum_calculate_little_endian_xor32(
      uint32_t initial_value,
      libcerror_error_t **error );
 
+int libesedb_checksum_calculate_little_endian_xor32_with_kernel(
+     int kernel,
+     uint32_t *checksum_value,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,417 @@
+/*
+ * Column projection functions
+ *
+ * Copyright (C) 2009-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libesedb_catalog_definition.h"
+#include "libesedb_column_projection.h"
+#include "libesedb_libcdata.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_table_definition.h"
+
+/* Creates a column projection
+ * Make sure the value column_projection is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_column_projection_initialize(
+     libesedb_column_projection_t **column_projection,
+     libesedb_table_definition_t *table_definition,
+     const uint32_t *column_identifiers,
+     int number_of_column_identifiers,
+     libcerror_error_t **error )
+{
+	static char *function       = "libesedb_column_projection_initialize";
+	int column_identifier_index = 0;
+	int column_index            = 0;
+	int insert_index            = 0;
+	int move_index              = 0;
+	int result                  = 0;
+
+	if( column_projection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column projection.",
+		 function );
+
+		return( -1 );
+	}
+	if( *column_projection != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid column projection value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_identifiers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column identifiers.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_column_identifiers <= 0 )
+	 || ( (size_t) number_of_column_identifiers > (size_t) ( SSIZE_MAX / sizeof( int ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of column identifiers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*column_projection = memory_allocate_structure(
+	                      libesedb_column_projection_t );
+
+	if( *column_projection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create column projection.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *column_projection,
+	     0,
+	     sizeof( libesedb_column_projection_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear column projection.",
+		 function );
+
+		memory_free(
+		 *column_projection );
+
+		*column_projection = NULL;
+
+		return( -1 );
+	}
+	( *column_projection )->column_indexes = (int *) memory_allocate(
+	                                                  sizeof( int ) * number_of_column_identifiers );
+
+	if( ( *column_projection )->column_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create column indexes.",
+		 function );
+
+		goto on_error;
+	}
+	/* The column indexes are stored in ascending order, which is the order
+	 * of the columns in the record data, duplicate column identifiers are ignored
+	 */
+	for( column_identifier_index = 0;
+	     column_identifier_index < number_of_column_identifiers;
+	     column_identifier_index++ )
+	{
+		result = libesedb_table_definition_get_column_index_by_identifier(
+		          table_definition,
+		          column_identifiers[ column_identifier_index ],
+		          &column_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column index of column identifier: %" PRIu32 ".",
+			 function,
+			 column_identifiers[ column_identifier_index ] );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported column identifier: %" PRIu32 " - no such column.",
+			 function,
+			 column_identifiers[ column_identifier_index ] );
+
+			goto on_error;
+		}
+		insert_index = ( *column_projection )->number_of_column_indexes;
+
+		while( ( insert_index > 0 )
+		    && ( ( *column_projection )->column_indexes[ insert_index - 1 ] > column_index ) )
+		{
+			insert_index--;
+		}
+		if( ( insert_index > 0 )
+		 && ( ( *column_projection )->column_indexes[ insert_index - 1 ] == column_index ) )
+		{
+			continue;
+		}
+		for( move_index = ( *column_projection )->number_of_column_indexes;
+		     move_index > insert_index;
+		     move_index-- )
+		{
+			( *column_projection )->column_indexes[ move_index ] = ( *column_projection )->column_indexes[ move_index - 1 ];
+		}
+		( *column_projection )->column_indexes[ insert_index ] = column_index;
+
+		( *column_projection )->number_of_column_indexes += 1;
+	}
+	return( 1 );
+
+on_error:
+	if( *column_projection != NULL )
+	{
+		if( ( *column_projection )->column_indexes != NULL )
+		{
+			memory_free(
+			 ( *column_projection )->column_indexes );
+		}
+		memory_free(
+		 *column_projection );
+
+		*column_projection = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a column projection
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_column_projection_free(
+     libesedb_column_projection_t **column_projection,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_column_projection_free";
+
+	if( column_projection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column projection.",
+		 function );
+
+		return( -1 );
+	}
+	if( *column_projection != NULL )
+	{
+		if( ( *column_projection )->column_indexes != NULL )
+		{
+			memory_free(
+			 ( *column_projection )->column_indexes );
+		}
+		memory_free(
+		 *column_projection );
+
+		*column_projection = NULL;
+	}
+	return( 1 );
+}
+
+/* Clones a column projection
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_column_projection_clone(
+     libesedb_column_projection_t **destination_column_projection,
+     libesedb_column_projection_t *source_column_projection,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_column_projection_clone";
+
+	if( destination_column_projection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination column projection.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_column_projection != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination column projection value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_column_projection == NULL )
+	{
+		return( 1 );
+	}
+	*destination_column_projection = memory_allocate_structure(
+	                                  libesedb_column_projection_t );
+
+	if( *destination_column_projection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create destination column projection.",
+		 function );
+
+		goto on_error;
+	}
+	( *destination_column_projection )->column_indexes           = NULL;
+	( *destination_column_projection )->number_of_column_indexes = 0;
+
+	if( source_column_projection->number_of_column_indexes > 0 )
+	{
+		( *destination_column_projection )->column_indexes = (int *) memory_allocate(
+		                                                              sizeof( int ) * source_column_projection->number_of_column_indexes );
+
+		if( ( *destination_column_projection )->column_indexes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create destination column indexes.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     ( *destination_column_projection )->column_indexes,
+		     source_column_projection->column_indexes,
+		     sizeof( int ) * source_column_projection->number_of_column_indexes ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy column indexes.",
+			 function );
+
+			goto on_error;
+		}
+		( *destination_column_projection )->number_of_column_indexes = source_column_projection->number_of_column_indexes;
+	}
+	return( 1 );
+
+on_error:
+	if( *destination_column_projection != NULL )
+	{
+		if( ( *destination_column_projection )->column_indexes != NULL )
+		{
+			memory_free(
+			 ( *destination_column_projection )->column_indexes );
+		}
+		memory_free(
+		 *destination_column_projection );
+
+		*destination_column_projection = NULL;
+	}
+	return( -1 );
+}
+
+/* Retrieves the column index of a specific value entry
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_column_projection_get_column_index(
+     libesedb_column_projection_t *column_projection,
+     int value_entry,
+     int *column_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_column_projection_get_column_index";
+
+	if( column_projection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column projection.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_entry < 0 )
+	 || ( value_entry >= column_projection->number_of_column_indexes ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value entry value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column index.",
+		 function );
+
+		return( -1 );
+	}
+	*column_index = column_projection->column_indexes[ value_entry ];
+
+	return( 1 );
+}
+
@@ -0,0 +1,77 @@
+/*
+ * Column projection functions
+ *
+ * Copyright (C) 2009-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_COLUMN_PROJECTION_H )
+#define _LIBESEDB_COLUMN_PROJECTION_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_libcerror.h"
+#include "libesedb_table_definition.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libesedb_column_projection libesedb_column_projection_t;
+
+struct libesedb_column_projection
+{
+	/* The column indexes
+	 * The index of a column is the index of its catalog definition in the template
+	 * table column list followed by the table column list, in ascending order
+	 */
+	int *column_indexes;
+
+	/* The number of column indexes
+	 */
+	int number_of_column_indexes;
+};
+
+int libesedb_column_projection_initialize(
+     libesedb_column_projection_t **column_projection,
+     libesedb_table_definition_t *table_definition,
+     const uint32_t *column_identifiers,
+     int number_of_column_identifiers,
+     libcerror_error_t **error );
+
+int libesedb_column_projection_free(
+     libesedb_column_projection_t **column_projection,
+     libcerror_error_t **error );
+
+int libesedb_column_projection_clone(
+     libesedb_column_projection_t **destination_column_projection,
+     libesedb_column_projection_t *source_column_projection,
+     libcerror_error_t **error );
+
+int libesedb_column_projection_get_column_index(
+     libesedb_column_projection_t *column_projection,
+     int value_entry,
+     int *column_index,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_COLUMN_PROJECTION_H ) */
+
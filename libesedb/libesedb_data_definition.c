@@ -280,9 +280,9 @@ int libesedb_data_definition_read_data(
 
 		return( -1 );
 	}
-	data_offset = data_definition->data_offset - page_value->offset;
+	data_offset = data_definition->data_offset - page_value->data_offset;
 
-	if( ( data_definition->data_offset < page_value->offset )
+	if( ( data_definition->data_offset < page_value->data_offset )
 	 || ( data_offset > page_value->size ) )
 	{
 		libcerror_error_set(
@@ -302,6 +302,16 @@ int libesedb_data_definition_read_data(
 
 /* Reads the record
  * Uses the definition data in the catalog definitions
+ * The record data is copied and the location of the data of every column is
+ * stored in the data type definitions, the values themselves are read on demand
+ * by libesedb_data_definition_read_record_value
+ * If a column projection is provided only the data type definitions of the
+ * projected columns are stored and the columns after the last projected column
+ * are not read
+ * The tagged data types are looked up by identifier, hence the tagged data types
+ * of columns that are not projected are not read
+ * The record data copy and data type definitions are reused if they were
+ * allocated by a previous read and are large enough
  * Returns 1 if successful or -1 on error
  */
 int libesedb_data_definition_read_record(
@@ -312,52 +322,49 @@ int libesedb_data_definition_read_record(
      libfcache_cache_t *pages_cache,
      libesedb_table_definition_t *table_definition,
      libesedb_table_definition_t *template_table_definition,
+     libesedb_column_projection_t *column_projection,
      libcdata_array_t *values_array,
+     uint8_t **record_data_copy,
+     size_t *record_data_copy_size,
+     size_t *record_data_copy_allocated_size,
+     libesedb_data_type_definition_t **data_type_definitions,
+     int *number_of_allocated_data_type_definitions,
      uint8_t *record_flags,
      libcerror_error_t **error )
 {
-	libcdata_list_element_t *column_catalog_definition_list_element = NULL;
-	libesedb_catalog_definition_t *column_catalog_definition        = NULL;
-	libesedb_page_t *page                                           = NULL;
-	libesedb_page_value_t *page_value                               = NULL;
-	libfvalue_data_handle_t *value_data_handle                      = NULL;
-	libfvalue_value_t *record_value                                 = NULL;
-	uint8_t *record_data                                            = NULL;
-	uint8_t *tagged_data_type_offset_data                           = NULL;
-	static char *function                                           = "libesedb_data_definition_read_record";
-	off64_t element_data_offset                                     = 0;
-	size_t record_data_size                                         = 0;
-	size_t remaining_definition_data_size                           = 0;
-	uint16_t data_offset                                            = 0;
-	uint16_t fixed_size_data_type_value_offset                      = 0;
-	uint16_t masked_previous_tagged_data_type_offset                = 0;
-	uint16_t masked_tagged_data_type_offset                         = 0;
-	uint16_t previous_tagged_data_type_offset                       = 0;
-	uint16_t previous_variable_size_data_type_size                  = 0;
-	uint16_t tagged_data_type_offset_data_size                      = 0;
-	uint16_t tagged_data_type_identifier                            = 0;
-	uint16_t tagged_data_type_offset                                = 0;
-	uint16_t tagged_data_type_offset_bitmask                        = 0x3fff;
-	uint16_t tagged_data_type_size                                  = 0;
-	uint16_t tagged_data_types_offset                               = 0;
-	uint16_t tagged_data_type_value_offset                          = 0;
-	uint16_t variable_size_data_type_offset                         = 0;
-	uint16_t variable_size_data_type_size                           = 0;
-	uint16_t variable_size_data_type_value_offset                   = 0;
-	uint16_t variable_size_data_types_offset                        = 0;
-	uint8_t current_variable_size_data_type                         = 0;
-	uint8_t last_fixed_size_data_type                               = 0;
-	uint8_t last_variable_size_data_type                            = 0;
-	uint8_t number_of_variable_size_data_types                      = 0;
-	uint8_t record_value_type                                       = 0;
-	uint8_t tagged_data_types_format                                = LIBESEDB_TAGGED_DATA_TYPES_FORMAT_INDEX;
-	int column_catalog_definition_index                             = 0;
-	int encoding                                                    = 0;
-	int number_of_column_catalog_definitions                        = 0;
-	int number_of_table_column_catalog_definitions                  = 0;
-	int number_of_template_table_column_catalog_definitions         = 0;
-	int record_value_codepage                                       = 0;
-	int result                                                      = 0;
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_data_type_definition_t *data_type_definition    = NULL;
+	libesedb_page_t *page                                    = NULL;
+	libesedb_page_value_t *page_value                        = NULL;
+	uint8_t *record_data                                     = NULL;
+	void *reallocation                                       = NULL;
+	static char *function                                    = "libesedb_data_definition_read_record";
+	off64_t element_data_offset                              = 0;
+	size_t record_data_size                                  = 0;
+	size_t remaining_definition_data_size                    = 0;
+	uint16_t data_offset                                     = 0;
+	uint16_t fixed_size_data_type_value_offset               = 0;
+	uint16_t previous_variable_size_data_type_size           = 0;
+	uint16_t tagged_data_type_identifier                     = 0;
+	uint16_t tagged_data_type_size                           = 0;
+	uint16_t tagged_data_types_offset                        = 0;
+	uint16_t tagged_data_type_value_offset                   = 0;
+	uint16_t variable_size_data_type_offset                  = 0;
+	uint16_t variable_size_data_type_size                    = 0;
+	uint16_t variable_size_data_type_value_offset            = 0;
+	uint16_t variable_size_data_types_offset                 = 0;
+	uint8_t current_variable_size_data_type                  = 0;
+	uint8_t last_fixed_size_data_type                        = 0;
+	uint8_t last_variable_size_data_type                     = 0;
+	uint8_t number_of_variable_size_data_types               = 0;
+	uint8_t tagged_data_types_format                         = LIBESEDB_TAGGED_DATA_TYPES_FORMAT_INDEX;
+	int column_catalog_definition_index                      = 0;
+	int number_of_column_catalog_definitions                 = 0;
+	int number_of_data_type_definitions                      = 0;
+	int projected_value_entry                                = 0;
+	int result                                               = 0;
+	int tagged_data_type_index                               = 0;
+	int number_of_template_table_column_catalog_definitions  = 0;
 
 	if( data_definition == NULL )
 	{
@@ -426,6 +433,61 @@ int libesedb_data_definition_read_record(
 
 		return( -1 );
 	}
+	if( record_data_copy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record data copy.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_data_copy_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record data copy size.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_data_copy_allocated_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record data copy allocated size.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_type_definitions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data type definitions.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_allocated_data_type_definitions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of allocated data type definitions.",
+		 function );
+
+		return( -1 );
+	}
 	if( record_flags == NULL )
 	{
 		libcerror_error_set(
@@ -508,9 +570,9 @@ int libesedb_data_definition_read_record(
 
 		goto on_error;
 	}
-	data_offset = data_definition->data_offset - page_value->offset;
+	data_offset = data_definition->data_offset - page_value->data_offset;
 
-	if( ( data_definition->data_offset < page_value->offset )
+	if( ( data_definition->data_offset < page_value->data_offset )
 	 || ( data_offset > page_value->size ) )
 	{
 		libcerror_error_set(
@@ -536,16 +598,52 @@ int libesedb_data_definition_read_record(
 
 		goto on_error;
 	}
+	/* The page value data can be reused by the page pool hence the record keeps
+	 * its own copy of the record data
+	 */
+	if( ( *record_data_copy == NULL )
+	 || ( *record_data_copy_allocated_size < record_data_size ) )
+	{
+		reallocation = memory_reallocate(
+		                *record_data_copy,
+		                sizeof( uint8_t ) * record_data_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize record data copy.",
+			 function );
+
+			goto on_error;
+		}
+		*record_data_copy                = (uint8_t *) reallocation;
+		*record_data_copy_allocated_size = record_data_size;
+	}
+	if( memory_copy(
+	     *record_data_copy,
+	     record_data,
+	     record_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy record data.",
+		 function );
+
+		goto on_error;
+	}
+	*record_data_copy_size = record_data_size;
+	record_data            = *record_data_copy;
+
 	if( ( io_handle->format_version == 0x620 )
 	 && ( io_handle->format_revision <= 2 ) )
 	{
 		tagged_data_types_format = LIBESEDB_TAGGED_DATA_TYPES_FORMAT_LINEAR;
 	}
-	if( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
-	 && ( io_handle->page_size >= 16384 ) )
-	{
-		tagged_data_type_offset_bitmask = 0x7fff;
-	}
 	last_fixed_size_data_type    = ( (esedb_data_definition_header_t *) record_data )->last_fixed_size_data_type;
 	last_variable_size_data_type = ( (esedb_data_definition_header_t *) record_data )->last_variable_size_data_type;
 
@@ -572,44 +670,27 @@ int libesedb_data_definition_read_record(
 		 variable_size_data_types_offset );
 	}
 #endif
-	if( ( template_table_definition != NULL )
-	 && ( template_table_definition->column_catalog_definition_list != NULL ) )
-	{
-		if( libcdata_list_get_number_of_elements(
-		     template_table_definition->column_catalog_definition_list,
-		     &number_of_template_table_column_catalog_definitions,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of template table column catalog definitions.",
-			 function );
+	/* The column catalog definitions array contains the columns of the template table
+	 * followed by the columns of the table
+	 */
+	number_of_column_catalog_definitions                = table_definition->number_of_column_catalog_definitions;
+	number_of_template_table_column_catalog_definitions = table_definition->number_of_template_table_column_catalog_definitions;
 
-			goto on_error;
-		}
-	}
-	if( libcdata_list_get_number_of_elements(
-	     table_definition->column_catalog_definition_list,
-	     &number_of_table_column_catalog_definitions,
-	     error ) != 1 )
+	if( ( number_of_column_catalog_definitions > 0 )
+	 && ( table_definition->column_catalog_definitions_array == NULL ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of table column catalog definitions.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table definition - missing column catalog definitions array.",
 		 function );
 
 		goto on_error;
 	}
-	number_of_column_catalog_definitions = number_of_table_column_catalog_definitions;
-
-	if( ( template_table_definition != NULL )
-	 && ( template_table_definition->column_catalog_definition_list != NULL ) )
+	if( template_table_definition != NULL )
 	{
-		if( number_of_table_column_catalog_definitions > number_of_template_table_column_catalog_definitions )
+		if( ( number_of_column_catalog_definitions - number_of_template_table_column_catalog_definitions ) > number_of_template_table_column_catalog_definitions )
 		{
 			libcerror_error_set(
 			 error,
@@ -620,11 +701,18 @@ int libesedb_data_definition_read_record(
 
 			goto on_error;
 		}
-		number_of_column_catalog_definitions += number_of_template_table_column_catalog_definitions;
+	}
+	if( column_projection != NULL )
+	{
+		number_of_data_type_definitions = column_projection->number_of_column_indexes;
+	}
+	else
+	{
+		number_of_data_type_definitions = number_of_column_catalog_definitions;
 	}
 	if( libcdata_array_resize(
 	     values_array,
-	     number_of_column_catalog_definitions,
+	     number_of_data_type_definitions,
 	     (int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_value_free,
 	     error ) != 1 )
 	{
@@ -637,35 +725,47 @@ int libesedb_data_definition_read_record(
 
 		goto on_error;
 	}
-	if( last_variable_size_data_type > 127 )
-	{
-		number_of_variable_size_data_types = last_variable_size_data_type - 127;
-	}
-	if( ( template_table_definition != NULL )
-	 && ( template_table_definition->column_catalog_definition_list != NULL ) )
-	{
-		result = libcdata_list_get_first_element(
-		          template_table_definition->column_catalog_definition_list,
-		          &column_catalog_definition_list_element,
-		          error );
-	}
-	else
+	if( number_of_data_type_definitions > 0 )
 	{
-		result = libcdata_list_get_first_element(
-		          table_definition->column_catalog_definition_list,
-		          &column_catalog_definition_list_element,
-		          error );
+		if( ( *data_type_definitions == NULL )
+		 || ( *number_of_allocated_data_type_definitions < number_of_data_type_definitions ) )
+		{
+			reallocation = memory_reallocate(
+			                *data_type_definitions,
+			                sizeof( libesedb_data_type_definition_t ) * number_of_data_type_definitions );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize data type definitions.",
+				 function );
+
+				goto on_error;
+			}
+			*data_type_definitions                     = (libesedb_data_type_definition_t *) reallocation;
+			*number_of_allocated_data_type_definitions = number_of_data_type_definitions;
+		}
+		if( memory_set(
+		     *data_type_definitions,
+		     0,
+		     sizeof( libesedb_data_type_definition_t ) * number_of_data_type_definitions ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear data type definitions.",
+			 function );
+
+			goto on_error;
+		}
 	}
-	if( result != 1 )
+	if( last_variable_size_data_type > 127 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve first column catalog definition list element.",
-		 function );
-
-		goto on_error;
+		number_of_variable_size_data_types = last_variable_size_data_type - 127;
 	}
 	fixed_size_data_type_value_offset    = (uint16_t) sizeof( esedb_data_definition_header_t );
 	current_variable_size_data_type      = 127;
@@ -676,21 +776,13 @@ int libesedb_data_definition_read_record(
 	     column_catalog_definition_index < number_of_column_catalog_definitions;
 	     column_catalog_definition_index++ )
 	{
-		if( libcdata_list_element_get_value(
-		     column_catalog_definition_list_element,
-		     (intptr_t **) &column_catalog_definition,
-		     error ) != 1 )
+		if( ( column_projection != NULL )
+		 && ( projected_value_entry >= column_projection->number_of_column_indexes ) )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve column catalog definition from list element: %d.",
-			 function,
-			 column_catalog_definition_index );
-
-			goto on_error;
+			break;
 		}
+		column_catalog_definition = table_definition->column_catalog_definitions_array[ column_catalog_definition_index ];
+
 		if( column_catalog_definition == NULL )
 		{
 			libcerror_error_set(
@@ -709,7 +801,7 @@ int libesedb_data_definition_read_record(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-			 "%s: unsupported column catalog definition type: %" PRIu16 " for list element: %d.",
+			 "%s: unsupported column catalog definition type: %" PRIu16 " for column: %d.",
 			 function,
 			 column_catalog_definition->type,
 			 column_catalog_definition_index );
@@ -717,7 +809,6 @@ int libesedb_data_definition_read_record(
 			goto on_error;
 		}
 		if( ( template_table_definition != NULL )
-		 && ( template_table_definition->column_catalog_definition_list != NULL )
 		 && ( column_catalog_definition_index == number_of_template_table_column_catalog_definitions ) )
 		{
 			if( column_catalog_definition->identifier != 256 )
@@ -752,124 +843,21 @@ int libesedb_data_definition_read_record(
 			  column_catalog_definition->column_type ) );
 		}
 #endif
-/* TODO refactor to value type */
-
-		switch( column_catalog_definition->column_type )
-		{
-			case LIBESEDB_COLUMN_TYPE_NULL:
-				/* JET_coltypNil seems to be able to contain data */
-				record_value_type = LIBFVALUE_VALUE_TYPE_BINARY_DATA;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_BOOLEAN:
-				record_value_type = LIBFVALUE_VALUE_TYPE_BOOLEAN;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
-				record_value_type = LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_8BIT;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
-				record_value_type = LIBFVALUE_VALUE_TYPE_INTEGER_16BIT;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
-				record_value_type = LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_16BIT;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
-				record_value_type = LIBFVALUE_VALUE_TYPE_INTEGER_32BIT;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
-				record_value_type = LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_32BIT;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_CURRENCY:
-			case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
-				record_value_type = LIBFVALUE_VALUE_TYPE_INTEGER_64BIT;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
-				record_value_type = LIBFVALUE_VALUE_TYPE_FLOATING_POINT_32BIT;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
-				record_value_type = LIBFVALUE_VALUE_TYPE_FLOATING_POINT_64BIT;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_DATE_TIME:
-				record_value_type = LIBFVALUE_VALUE_TYPE_FILETIME;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_GUID:
-				record_value_type = LIBFVALUE_VALUE_TYPE_GUID;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_BINARY_DATA:
-			case LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA:
-				record_value_type = LIBFVALUE_VALUE_TYPE_BINARY_DATA;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_TEXT:
-			case LIBESEDB_COLUMN_TYPE_LARGE_TEXT:
-				record_value_type = LIBFVALUE_VALUE_TYPE_STRING_BYTE_STREAM;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_SUPER_LARGE_VALUE:
-/* TODO handle this value type */
-				record_value_type = LIBFVALUE_VALUE_TYPE_UNDEFINED;
-				break;
-
-			default:
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-				 "%s: unsupported column type: %" PRIu32 ".",
-				 function,
-				 column_catalog_definition->column_type );
-
-				goto on_error;
-		}
-		if( libfvalue_data_handle_initialize(
-		     &value_data_handle,
-		     (int (*)(libfvalue_data_handle_t *, const uint8_t *, size_t, int, uint32_t, libcerror_error_t **)) &libesedb_value_data_handle_read_value_entries,
-		     error ) != 1 )
+		if( column_projection == NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create value data handle.",
-			 function );
-
-			goto on_error;
+			data_type_definition = &( ( *data_type_definitions )[ column_catalog_definition_index ] );
 		}
-		if( ( column_catalog_definition->column_type == LIBESEDB_COLUMN_TYPE_TEXT )
-		 || ( column_catalog_definition->column_type == LIBESEDB_COLUMN_TYPE_LARGE_TEXT ) )
+		else if( column_projection->column_indexes[ projected_value_entry ] == column_catalog_definition_index )
 		{
-			record_value_codepage = (int) column_catalog_definition->codepage;
+			data_type_definition = &( ( *data_type_definitions )[ projected_value_entry ] );
 
-			/* If the codepage is not set use the default codepage
-			 */
-			if( record_value_codepage == 0 )
-			{
-				record_value_codepage = io_handle->ascii_codepage;
-			}
-			/* Codepage 1200 in the ESE database format is not strict UTF-16 little endian
-			 * it can be used for ASCII strings as well. This could be SCSU.
-			 */
-			if( record_value_codepage == 1200 )
-			{
-				record_value_codepage = LIBFVALUE_CODEPAGE_1200_MIXED;
-			}
-			encoding = record_value_codepage;
+			projected_value_entry++;
 		}
 		else
 		{
-			encoding = LIBFVALUE_ENDIAN_LITTLE;
+			data_type_definition = NULL;
 		}
+
 		if( column_catalog_definition->identifier <= 127 )
 		{
 			if( column_catalog_definition->identifier <= last_fixed_size_data_type )
@@ -888,23 +876,6 @@ int libesedb_data_definition_read_record(
 					 0 );
 				}
 #endif
-				if( libfvalue_data_handle_set_data(
-				     value_data_handle,
-				     &( record_data[ fixed_size_data_type_value_offset ] ),
-				     column_catalog_definition->size,
-				     encoding,
-				     LIBFVALUE_VALUE_DATA_FLAG_MANAGED,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-					 "%s: unable to set data in fixed size data type definition.",
-					 function );
-
-					goto on_error;
-				}
 				if( column_catalog_definition->size > (uint32_t) UINT16_MAX )
 				{
 					libcerror_error_set(
@@ -916,6 +887,13 @@ int libesedb_data_definition_read_record(
 
 					goto on_error;
 				}
+				if( data_type_definition != NULL )
+				{
+					data_type_definition->data_offset = fixed_size_data_type_value_offset;
+					data_type_definition->data_size   = (uint16_t) column_catalog_definition->size;
+					data_type_definition->has_data    = 1;
+				}
+
 				fixed_size_data_type_value_offset += (uint16_t) column_catalog_definition->size;
 			}
 		}
@@ -961,23 +939,13 @@ int libesedb_data_definition_read_record(
 							 0 );
 						}
 #endif
-						if( libfvalue_data_handle_set_data(
-						     value_data_handle,
-						     &( record_data[ variable_size_data_type_value_offset ] ),
-						     variable_size_data_type_size - previous_variable_size_data_type_size,
-						     encoding,
-						     LIBFVALUE_VALUE_DATA_FLAG_MANAGED,
-						     error ) != 1 )
+						if( data_type_definition != NULL )
 						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-							 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-							 "%s: unable to set data in variable size data type definition.",
-							 function );
-
-							goto on_error;
+							data_type_definition->data_offset = variable_size_data_type_value_offset;
+							data_type_definition->data_size   = variable_size_data_type_size - previous_variable_size_data_type_size;
+							data_type_definition->has_data    = 1;
 						}
+
 						variable_size_data_type_value_offset += variable_size_data_type_size - previous_variable_size_data_type_size;
 						previous_variable_size_data_type_size = variable_size_data_type_size;
 					}
@@ -1067,20 +1035,11 @@ int libesedb_data_definition_read_record(
 							 "\n" );
 						}
 #endif
-						if( libfvalue_data_handle_set_data_flags(
-						     value_data_handle,
-						     (uint32_t) record_data[ tagged_data_type_value_offset ],
-						     error ) != 1 )
+						if( data_type_definition != NULL )
 						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-							 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-							 "%s: unable to set tagged data type flags in tagged data type definition.",
-							 function );
-
-							goto on_error;
+							data_type_definition->data_flags = record_data[ tagged_data_type_value_offset ];
 						}
+
 						tagged_data_type_value_offset  += 1;
 						tagged_data_type_size           = ( tagged_data_type_size & 0x5fff ) - 1;
 						remaining_definition_data_size -= 1;
@@ -1141,23 +1100,13 @@ int libesedb_data_definition_read_record(
 
 							goto on_error;
 						}
-						if( libfvalue_data_handle_set_data(
-						     value_data_handle,
-						     &( record_data[ tagged_data_type_value_offset ] ),
-						     tagged_data_type_size,
-						     encoding,
-						     LIBFVALUE_VALUE_DATA_FLAG_MANAGED,
-						     error ) != 1 )
+						if( data_type_definition != NULL )
 						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-							 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-							 "%s: unable to set data in tagged data type definition.",
-							 function );
-
-							goto on_error;
+							data_type_definition->data_offset = tagged_data_type_value_offset;
+							data_type_definition->data_size   = tagged_data_type_size;
+							data_type_definition->has_data    = 1;
 						}
+
 						remaining_definition_data_size -= tagged_data_type_size;
 					}
 					if( remaining_definition_data_size > 0 )
@@ -1193,342 +1142,683 @@ int libesedb_data_definition_read_record(
 			{
 				if( tagged_data_types_offset == 0 )
 				{
-					tagged_data_types_offset       = variable_size_data_type_value_offset;
-					tagged_data_type_offset_data   = &( record_data[ tagged_data_types_offset ] );
-					remaining_definition_data_size = record_data_size - (size_t) tagged_data_types_offset;
-
-					if( remaining_definition_data_size > 0 )
-					{
-						byte_stream_copy_to_uint16_little_endian(
-						 tagged_data_type_offset_data,
-						 tagged_data_type_identifier );
-
-						tagged_data_type_offset_data += 2;
-
-						byte_stream_copy_to_uint16_little_endian(
-						 tagged_data_type_offset_data,
-						 tagged_data_type_offset );
-
-						tagged_data_type_offset_data += 2;
-
-						if( tagged_data_type_offset == 0 )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-							 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-							 "%s: invalid tagged data type offset value out of bounds.",
-							 function );
-
-							goto on_error;
-						}
-						tagged_data_type_offset_data_size = ( tagged_data_type_offset & 0x3fff ) - 4;
-
-						remaining_definition_data_size -= 4;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-						if( libcnotify_verbose != 0 )
-						{
-							libcnotify_printf(
-							 "%s: tagged data type offset data size\t\t: %" PRIu16 "\n",
-							 function,
-							 tagged_data_type_offset_data_size );
-							libcnotify_printf(
-							 "%s: tagged data type offset data:\n",
-							 function );
-							libcnotify_print_data(
-							 tagged_data_type_offset_data,
-							 tagged_data_type_offset_data_size + 4,
-							 0 );
-						}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
-					}
+					tagged_data_types_offset = variable_size_data_type_value_offset;
 				}
-				if( ( remaining_definition_data_size > 0 )
-				 && ( column_catalog_definition->identifier == tagged_data_type_identifier ) )
+				/* The tagged data type offsets are sorted by identifier hence the tagged data types
+				 * of the columns that are not projected do not need to be read
+				 */
+				if( data_type_definition != NULL )
 				{
-#if defined( HAVE_DEBUG_OUTPUT )
-					if( libcnotify_verbose != 0 )
-					{
-						libcnotify_printf(
-						 "%s: (%03" PRIu16 ") tagged data type identifier\t\t: %" PRIu16 "\n",
-						 function,
-						 column_catalog_definition->identifier,
-						 tagged_data_type_identifier );
-
-						libcnotify_printf(
-						 "%s: (%03" PRIu16 ") tagged data type offset\t\t: 0x%04" PRIx16 " (%" PRIu16 ")\n",
-						 function,
-						 column_catalog_definition->identifier,
-						 tagged_data_type_offset,
-						 tagged_data_type_offset & tagged_data_type_offset_bitmask );
-					}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
-
-					previous_tagged_data_type_offset = tagged_data_type_offset;
-
-					if( tagged_data_type_offset_data_size > 0 )
-					{
-						byte_stream_copy_to_uint16_little_endian(
-						 tagged_data_type_offset_data,
-						 tagged_data_type_identifier );
-
-						tagged_data_type_offset_data += 2;
-
-						byte_stream_copy_to_uint16_little_endian(
-						 tagged_data_type_offset_data,
-						 tagged_data_type_offset );
-
-						tagged_data_type_offset_data += 2;
-
-						tagged_data_type_offset_data_size -= 4;
-						remaining_definition_data_size    -= 4;
-					}
-					masked_previous_tagged_data_type_offset = previous_tagged_data_type_offset & tagged_data_type_offset_bitmask;
-					masked_tagged_data_type_offset          = tagged_data_type_offset & tagged_data_type_offset_bitmask;
-
-					if( masked_previous_tagged_data_type_offset > masked_tagged_data_type_offset )
+					result = libesedb_data_definition_get_tagged_data_type_by_identifier(
+					          io_handle,
+					          record_data,
+					          record_data_size,
+					          tagged_data_types_offset,
+					          column_catalog_definition->identifier,
+					          &tagged_data_type_index,
+					          data_type_definition,
+					          error );
+
+					if( result == -1 )
 					{
 						libcerror_error_set(
 						 error,
-						 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-						 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-						 "%s: invalid tagged data type offset value exceeds next tagged data type offset.",
-						 function );
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+						 "%s: unable to retrieve tagged data type: %" PRIu32 ".",
+						 function,
+						 column_catalog_definition->identifier );
 
 						goto on_error;
 					}
-					if( masked_tagged_data_type_offset > masked_previous_tagged_data_type_offset )
-					{
-						tagged_data_type_size = masked_tagged_data_type_offset - masked_previous_tagged_data_type_offset;
-					}
-					else
-					{
-						tagged_data_type_size = (uint16_t) remaining_definition_data_size;
-					}
+				}
+			}
+		}
+	}
 #if defined( HAVE_DEBUG_OUTPUT )
-					if( libcnotify_verbose != 0 )
-					{
-						libcnotify_printf(
-						 "%s: (%03" PRIu16 ") tagged data type size\t\t: %" PRIu16 "\n",
-						 function,
-						 column_catalog_definition->identifier,
-						 tagged_data_type_size );
-					}
+	if( libcnotify_verbose != 0 )
+	{
+		if( fixed_size_data_type_value_offset < variable_size_data_types_offset )
+		{
+			libcnotify_printf(
+			 "%s: fixed size data types trailing data:\n",
+			 function );
+			libcnotify_print_data(
+			 &( record_data[ fixed_size_data_type_value_offset ] ),
+			 variable_size_data_types_offset - fixed_size_data_type_value_offset,
+			 0 );
+		}
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *data_type_definitions != NULL )
+	{
+		memory_free(
+		 *data_type_definitions );
+
+		*data_type_definitions = NULL;
+	}
+	*number_of_allocated_data_type_definitions = 0;
+
+	if( *record_data_copy != NULL )
+	{
+		memory_free(
+		 *record_data_copy );
+
+		*record_data_copy = NULL;
+	}
+	*record_data_copy_size           = 0;
+	*record_data_copy_allocated_size = 0;
+
+	return( -1 );
+}
+
+/* Retrieves the tagged data type of a specific column identifier
+ * The tagged data type offsets are stored sorted by identifier and are searched
+ * with a binary search, tagged_data_type_index contains the index of the first
+ * tagged data type offset to search and is set to the index after the tagged data type
+ * This allows the columns to be searched in order without reading the same
+ * tagged data type offsets more than once
+ * Returns 1 if successful, 0 if no such tagged data type or -1 on error
+ */
+int libesedb_data_definition_get_tagged_data_type_by_identifier(
+     libesedb_io_handle_t *io_handle,
+     const uint8_t *record_data,
+     size_t record_data_size,
+     uint16_t tagged_data_types_offset,
+     uint32_t identifier,
+     int *tagged_data_type_index,
+     libesedb_data_type_definition_t *data_type_definition,
+     libcerror_error_t **error )
+{
+	const uint8_t *tagged_data_type_offset_data = NULL;
+	static char *function                       = "libesedb_data_definition_get_tagged_data_type_by_identifier";
+	size_t tagged_data_types_size               = 0;
+	uint16_t next_tagged_data_type_offset       = 0;
+	uint16_t tagged_data_type_identifier        = 0;
+	uint16_t tagged_data_type_offset            = 0;
+	uint16_t tagged_data_type_offset_bitmask    = 0x3fff;
+	uint16_t tagged_data_type_size              = 0;
+	uint16_t tagged_data_type_value_offset      = 0;
+	int lower_index                             = 0;
+	int middle_index                            = 0;
+	int number_of_tagged_data_types             = 0;
+	int upper_index                             = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record data.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid record data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( tagged_data_type_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tagged data type index.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_type_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data type definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) tagged_data_types_offset >= record_data_size )
+	{
+		return( 0 );
+	}
+	tagged_data_types_size = record_data_size - (size_t) tagged_data_types_offset;
+
+	if( tagged_data_types_size < 4 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid tagged data types size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
+	 && ( io_handle->page_size >= 16384 ) )
+	{
+		tagged_data_type_offset_bitmask = 0x7fff;
+	}
+	tagged_data_type_offset_data = &( record_data[ tagged_data_types_offset ] );
+
+	/* The data of the first tagged data type directly follows the tagged data type offsets
+	 */
+	byte_stream_copy_to_uint16_little_endian(
+	 &( tagged_data_type_offset_data[ 2 ] ),
+	 tagged_data_type_offset );
+
+	tagged_data_type_offset &= tagged_data_type_offset_bitmask;
+
+	if( ( tagged_data_type_offset < 4 )
+	 || ( (size_t) tagged_data_type_offset > tagged_data_types_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid tagged data type offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_tagged_data_types = (int) ( tagged_data_type_offset / 4 );
+
+	lower_index = *tagged_data_type_index;
+	upper_index = number_of_tagged_data_types;
+
+	if( lower_index < 0 )
+	{
+		lower_index = 0;
+	}
+	/* The tagged data type at the lower index is checked first since
+	 * the columns are commonly retrieved in order of identifier
+	 */
+	if( lower_index < upper_index )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 &( tagged_data_type_offset_data[ lower_index * 4 ] ),
+		 tagged_data_type_identifier );
+
+		if( (uint32_t) tagged_data_type_identifier == identifier )
+		{
+			upper_index = lower_index + 1;
+		}
+	}
+	while( lower_index < upper_index )
+	{
+		middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 &( tagged_data_type_offset_data[ middle_index * 4 ] ),
+		 tagged_data_type_identifier );
+
+		if( (uint32_t) tagged_data_type_identifier < identifier )
+		{
+			lower_index = middle_index + 1;
+		}
+		else if( (uint32_t) tagged_data_type_identifier > identifier )
+		{
+			upper_index = middle_index;
+		}
+		else
+		{
+			break;
+		}
+	}
+	if( lower_index >= upper_index )
+	{
+		*tagged_data_type_index = lower_index;
+
+		return( 0 );
+	}
+	*tagged_data_type_index = middle_index + 1;
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( tagged_data_type_offset_data[ ( middle_index * 4 ) + 2 ] ),
+	 tagged_data_type_offset );
+
+	if( ( middle_index + 1 ) < number_of_tagged_data_types )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 &( tagged_data_type_offset_data[ ( middle_index * 4 ) + 6 ] ),
+		 next_tagged_data_type_offset );
+
+		next_tagged_data_type_offset &= tagged_data_type_offset_bitmask;
+	}
+	else
+	{
+		next_tagged_data_type_offset = (uint16_t) tagged_data_types_size;
+	}
+	if( ( next_tagged_data_type_offset < ( tagged_data_type_offset & tagged_data_type_offset_bitmask ) )
+	 || ( (size_t) next_tagged_data_type_offset > tagged_data_types_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid tagged data type offset value exceeds next tagged data type offset.",
+		 function );
+
+		return( -1 );
+	}
+	tagged_data_type_size         = next_tagged_data_type_offset - ( tagged_data_type_offset & tagged_data_type_offset_bitmask );
+	tagged_data_type_value_offset = tagged_data_types_offset + ( tagged_data_type_offset & tagged_data_type_offset_bitmask );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: (%03" PRIu32 ") tagged data type offset\t\t: 0x%04" PRIx16 " (%" PRIu16 ")\n",
+		 function,
+		 identifier,
+		 tagged_data_type_offset,
+		 tagged_data_type_offset & tagged_data_type_offset_bitmask );
+
+		libcnotify_printf(
+		 "%s: (%03" PRIu32 ") tagged data type size\t\t: %" PRIu16 "\n",
+		 function,
+		 identifier,
+		 tagged_data_type_size );
+	}
 #endif
-					tagged_data_type_value_offset = tagged_data_types_offset + masked_previous_tagged_data_type_offset;
+	if( tagged_data_type_size > 0 )
+	{
+		if( ( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
+		  &&  ( io_handle->page_size >= 16384 ) )
+		 || ( ( tagged_data_type_offset & 0x4000 ) != 0 ) )
+		{
+			data_type_definition->data_flags = record_data[ tagged_data_type_value_offset ];
+
+			tagged_data_type_value_offset += 1;
+			tagged_data_type_size         -= 1;
+		}
+	}
+	if( tagged_data_type_size > 0 )
+	{
+		data_type_definition->data_offset = tagged_data_type_value_offset;
+		data_type_definition->data_size   = tagged_data_type_size;
+		data_type_definition->has_data    = 1;
+	}
+	return( 1 );
+}
+
+/* Retrieves the encoding of a record value
+ * Text values use the codepage of the column or the default codepage,
+ * other values are stored in little-endian
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_data_definition_get_record_value_encoding(
+     libesedb_io_handle_t *io_handle,
+     libesedb_catalog_definition_t *column_catalog_definition,
+     int *encoding,
+     libcerror_error_t **error )
+{
+	static char *function     = "libesedb_data_definition_get_record_value_encoding";
+	int record_value_codepage = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( encoding == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid encoding.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( column_catalog_definition->column_type == LIBESEDB_COLUMN_TYPE_TEXT )
+	 || ( column_catalog_definition->column_type == LIBESEDB_COLUMN_TYPE_LARGE_TEXT ) )
+	{
+		record_value_codepage = (int) column_catalog_definition->codepage;
+
+		/* If the codepage is not set use the default codepage
+		 */
+		if( record_value_codepage == 0 )
+		{
+			record_value_codepage = io_handle->ascii_codepage;
+		}
+		/* Codepage 1200 in the ESE database format is not strict UTF-16 little endian
+		 * it can be used for ASCII strings as well. This could be SCSU.
+		 */
+		if( record_value_codepage == 1200 )
+		{
+			record_value_codepage = LIBFVALUE_CODEPAGE_1200_MIXED;
+		}
+		*encoding = record_value_codepage;
+	}
+	else
+	{
+		*encoding = LIBFVALUE_ENDIAN_LITTLE;
+	}
+	return( 1 );
+}
+
+/* Reads a record value
+ * The data of the record value references the record data
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_data_definition_read_record_value(
+     libesedb_io_handle_t *io_handle,
+     libesedb_catalog_definition_t *column_catalog_definition,
+     libesedb_data_type_definition_t *data_type_definition,
+     const uint8_t *record_data,
+     size_t record_data_size,
+     libfvalue_value_t **record_value,
+     libcerror_error_t **error )
+{
+	libfvalue_data_handle_t *value_data_handle = NULL;
+	static char *function                      = "libesedb_data_definition_read_record_value";
+	uint8_t record_value_type                  = 0;
+	int encoding                               = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_type_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data type definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record data.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid record data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record value.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_value != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record value value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_type_definition->has_data != 0 )
+	 && ( ( (size_t) data_type_definition->data_offset > record_data_size )
+	  ||  ( (size_t) data_type_definition->data_size > ( record_data_size - data_type_definition->data_offset ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data type definition - data value out of bounds.",
+		 function );
 
-					if( tagged_data_type_size > 0 )
-					{
-						if( tagged_data_type_size > remaining_definition_data_size )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-							 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-							 "%s: invalid tagged data type size value exceeds remaining data size.",
-							 function );
+		return( -1 );
+	}
+/* TODO refactor to value type */
 
-							goto on_error;
-						}
-						remaining_definition_data_size -= tagged_data_type_size;
+	switch( column_catalog_definition->column_type )
+	{
+		case LIBESEDB_COLUMN_TYPE_NULL:
+			/* JET_coltypNil seems to be able to contain data */
+			record_value_type = LIBFVALUE_VALUE_TYPE_BINARY_DATA;
+			break;
 
-						if( ( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
-						  &&  ( io_handle->page_size >= 16384 ) )
-						 || ( ( previous_tagged_data_type_offset & 0x4000 ) != 0 ) )
-						{
-							if( tagged_data_type_value_offset >= record_data_size )
-							{
-								libcerror_error_set(
-								 error,
-								 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-								 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-								 "%s: invalid tagged data type offset value out of bounds.",
-								 function );
-
-								goto on_error;
-							}
-							if( libfvalue_data_handle_set_data_flags(
-							     value_data_handle,
-							     (uint32_t) record_data[ tagged_data_type_value_offset ],
-							     error ) != 1 )
-							{
-								libcerror_error_set(
-								 error,
-								 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-								 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-								 "%s: unable to set tagged data type flags in tagged data type definition.",
-								 function );
-
-								goto on_error;
-							}
-							tagged_data_type_value_offset += 1;
-							tagged_data_type_size         -= 1;
-						}
-#if defined( HAVE_DEBUG_OUTPUT )
-						if( libcnotify_verbose != 0 )
-						{
-							libcnotify_printf(
-							 "%s: (%03" PRIu16 ") tagged data type:\n",
-							 function,
-							 column_catalog_definition->identifier );
+		case LIBESEDB_COLUMN_TYPE_BOOLEAN:
+			record_value_type = LIBFVALUE_VALUE_TYPE_BOOLEAN;
+			break;
 
-							if( tagged_data_type_value_offset < record_data_size )
-							{
-								libcnotify_print_data(
-								 &( record_data[ tagged_data_type_value_offset ] ),
-								 tagged_data_type_size,
-								 0 );
-							}
-							else
-							{
-								libcnotify_printf(
-								 "<NULL>\n\n" );
-							}
-						}
-#endif
-					}
-#if defined( HAVE_DEBUG_OUTPUT )
-					/* TODO are zero size tagged data type values handled correctly?
-					 */
-					else if( libcnotify_verbose != 0 )
-					{
-						libcnotify_printf(
-						 "%s: (%03" PRIu32 ") tagged data type\t\t\t: <NULL>\n",
-						 function,
-						 column_catalog_definition->identifier );
-					}
-#endif
-					if( tagged_data_type_size > 0 )
-					{
-						if( tagged_data_type_value_offset >= record_data_size )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-							 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-							 "%s: invalid tagged data type offset value out of bounds.",
-							 function );
+		case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
+			record_value_type = LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_8BIT;
+			break;
 
-							goto on_error;
-						}
-						if( libfvalue_data_handle_set_data(
-						     value_data_handle,
-						     &( record_data[ tagged_data_type_value_offset ] ),
-						     tagged_data_type_size,
-						     encoding,
-						     LIBFVALUE_VALUE_DATA_FLAG_MANAGED,
-						     error ) != 1 )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-							 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-							 "%s: unable to set data in tagged data type definition.",
-							 function );
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+			record_value_type = LIBFVALUE_VALUE_TYPE_INTEGER_16BIT;
+			break;
 
-							goto on_error;
-						}
-					}
-				}
-			}
-		}
-		if( libfvalue_value_type_initialize_with_data_handle(
-		     &record_value,
-		     record_value_type,
-		     value_data_handle,
-		     LIBFVALUE_VALUE_FLAG_DATA_HANDLE_MANAGED,
-		     error ) != 1 )
-		{
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
+			record_value_type = LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_16BIT;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
+			record_value_type = LIBFVALUE_VALUE_TYPE_INTEGER_32BIT;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
+			record_value_type = LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_32BIT;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_CURRENCY:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
+			record_value_type = LIBFVALUE_VALUE_TYPE_INTEGER_64BIT;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
+			record_value_type = LIBFVALUE_VALUE_TYPE_FLOATING_POINT_32BIT;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
+			record_value_type = LIBFVALUE_VALUE_TYPE_FLOATING_POINT_64BIT;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_DATE_TIME:
+			record_value_type = LIBFVALUE_VALUE_TYPE_FILETIME;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_GUID:
+			record_value_type = LIBFVALUE_VALUE_TYPE_GUID;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_BINARY_DATA:
+		case LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA:
+			record_value_type = LIBFVALUE_VALUE_TYPE_BINARY_DATA;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_TEXT:
+		case LIBESEDB_COLUMN_TYPE_LARGE_TEXT:
+			record_value_type = LIBFVALUE_VALUE_TYPE_STRING_BYTE_STREAM;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_SUPER_LARGE_VALUE:
+/* TODO handle this value type */
+			record_value_type = LIBFVALUE_VALUE_TYPE_UNDEFINED;
+			break;
+
+		default:
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create record value.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported column type: %" PRIu32 ".",
+			 function,
+			 column_catalog_definition->column_type );
 
 			goto on_error;
-		}
-		value_data_handle = NULL;
+	}
+	if( libesedb_data_definition_get_record_value_encoding(
+	     io_handle,
+	     column_catalog_definition,
+	     &encoding,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record value encoding.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvalue_data_handle_initialize(
+	     &value_data_handle,
+	     (int (*)(libfvalue_data_handle_t *, const uint8_t *, size_t, int, uint32_t, libcerror_error_t **)) &libesedb_value_data_handle_read_value_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create value data handle.",
+		 function );
 
-		if( libcdata_array_set_entry_by_index(
-		     values_array,
-		     column_catalog_definition_index,
-		     (intptr_t *) record_value,
+		goto on_error;
+	}
+	if( data_type_definition->data_flags != 0 )
+	{
+		if( libfvalue_data_handle_set_data_flags(
+		     value_data_handle,
+		     (uint32_t) data_type_definition->data_flags,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-			 "%s: unable to set data type definition: %d.",
-			 function,
-			 column_catalog_definition_index );
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set tagged data type flags in value data handle.",
+			 function );
 
 			goto on_error;
 		}
-		record_value = NULL;
-
-		if( libcdata_list_element_get_next_element(
-		     column_catalog_definition_list_element,
-		     &column_catalog_definition_list_element,
+	}
+	/* The record data is owned by the record and outlives the record value
+	 * hence the data is not copied
+	 */
+	if( data_type_definition->has_data != 0 )
+	{
+		if( libfvalue_data_handle_set_data(
+		     value_data_handle,
+		     &( record_data[ data_type_definition->data_offset ] ),
+		     (size_t) data_type_definition->data_size,
+		     encoding,
+		     LIBFVALUE_VALUE_DATA_FLAG_NON_MANAGED,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve next column catalog definition list element.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set data in value data handle.",
 			 function );
 
 			goto on_error;
 		}
-		if( ( column_catalog_definition_list_element == NULL )
-		 && ( template_table_definition != NULL )
-		 && ( template_table_definition->column_catalog_definition_list != NULL ) )
-		{
-			if( libcdata_list_get_first_element(
-			     table_definition->column_catalog_definition_list,
-			     &column_catalog_definition_list_element,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve first column catalog definition list element.",
-				 function );
-
-				goto on_error;
-			}
-		}
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( libfvalue_value_type_initialize_with_data_handle(
+	     record_value,
+	     record_value_type,
+	     value_data_handle,
+	     LIBFVALUE_VALUE_FLAG_DATA_HANDLE_MANAGED,
+	     error ) != 1 )
 	{
-		if( fixed_size_data_type_value_offset < variable_size_data_types_offset )
-		{
-			libcnotify_printf(
-			 "%s: fixed size data types trailing data:\n",
-			 function );
-			libcnotify_print_data(
-			 &( record_data[ fixed_size_data_type_value_offset ] ),
-			 variable_size_data_types_offset - fixed_size_data_type_value_offset,
-			 0 );
-		}
-		libcnotify_printf(
-		 "\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record value.",
+		 function );
+
+		goto on_error;
 	}
-#endif
 	return( 1 );
 
 on_error:
-	if( record_value != NULL )
-	{
-		libfvalue_value_free(
-		 &record_value,
-		 NULL );
-	}
 	if( value_data_handle != NULL )
 	{
 		libfvalue_data_handle_free(
@@ -1538,6 +1828,153 @@ on_error:
 	return( -1 );
 }
 
+/* Refills a record value with the data of another record
+ * The record value and its data handle are reused, the cached value instances
+ * and value entries of the previous data are cleared
+ * The data of the record value references the record data
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_data_definition_refill_record_value(
+     libesedb_io_handle_t *io_handle,
+     libesedb_catalog_definition_t *column_catalog_definition,
+     libesedb_data_type_definition_t *data_type_definition,
+     const uint8_t *record_data,
+     size_t record_data_size,
+     libfvalue_value_t *record_value,
+     libcerror_error_t **error )
+{
+	libfvalue_data_handle_t *value_data_handle = NULL;
+	static char *function                      = "libesedb_data_definition_refill_record_value";
+	int encoding                               = 0;
+
+	if( data_type_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data type definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record data.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid record data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_type_definition->has_data != 0 )
+	 && ( ( (size_t) data_type_definition->data_offset > record_data_size )
+	  ||  ( (size_t) data_type_definition->data_size > ( record_data_size - data_type_definition->data_offset ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data type definition - data value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_data_definition_get_record_value_encoding(
+	     io_handle,
+	     column_catalog_definition,
+	     &encoding,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record value encoding.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvalue_value_clear(
+	     record_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear record value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvalue_value_get_data_handle(
+	     record_value,
+	     &value_data_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value data handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* The data flags are set before the data since they determine
+	 * how the value entries are read from the data
+	 */
+	if( libfvalue_data_handle_set_data_flags(
+	     value_data_handle,
+	     (uint32_t) data_type_definition->data_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set tagged data type flags in value data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_type_definition->has_data != 0 )
+	{
+		if( libfvalue_value_set_data(
+		     record_value,
+		     &( record_data[ data_type_definition->data_offset ] ),
+		     (size_t) data_type_definition->data_size,
+		     encoding,
+		     LIBFVALUE_VALUE_DATA_FLAG_NON_MANAGED,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set data in record value.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
 /* Reads the long value
  * Returns 1 if successful or -1 on error
  */
@@ -1639,9 +2076,9 @@ int libesedb_data_definition_read_long_value(
 
 		return( -1 );
 	}
-	data_offset = data_definition->data_offset - page_value->offset;
+	data_offset = data_definition->data_offset - page_value->data_offset;
 
-	if( ( data_definition->data_offset < page_value->offset )
+	if( ( data_definition->data_offset < page_value->data_offset )
 	 || ( data_offset > page_value->size ) )
 	{
 		libcerror_error_set(
@@ -1832,9 +2269,9 @@ int libesedb_data_definition_read_long_value_segment(
 
 		return( -1 );
 	}
-	data_offset = data_definition->data_offset - page_value->offset;
+	data_offset = data_definition->data_offset - page_value->data_offset;
 
-	if( ( data_definition->data_offset < page_value->offset )
+	if( ( data_definition->data_offset < page_value->data_offset )
 	 || ( data_offset > page_value->size ) )
 	{
 		libcerror_error_set(
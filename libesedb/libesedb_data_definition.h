@@ -25,12 +25,15 @@
 #include <common.h>
 #include <types.h>
 
+#include "libesedb_catalog_definition.h"
+#include "libesedb_column_projection.h"
 #include "libesedb_io_handle.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcdata.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
+#include "libesedb_libfvalue.h"
 #include "libesedb_table_definition.h"
 
 #if defined( __cplusplus )
@@ -38,6 +41,7 @@ extern "C" {
 #endif
 
 typedef struct libesedb_data_definition libesedb_data_definition_t;
+typedef struct libesedb_data_type_definition libesedb_data_type_definition_t;
 
 struct libesedb_data_definition
 {
@@ -62,6 +66,25 @@ struct libesedb_data_definition
 	uint16_t data_size;
 };
 
+struct libesedb_data_type_definition
+{
+	/* The data offset relative to the start of the record data
+	 */
+	uint16_t data_offset;
+
+	/* The data size
+	 */
+	uint16_t data_size;
+
+	/* The (tagged data type) data flags
+	 */
+	uint8_t data_flags;
+
+	/* Value to indicate the record contains data of the data type
+	 */
+	uint8_t has_data;
+};
+
 int libesedb_data_definition_initialize(
      libesedb_data_definition_t **data_definition,
      libcerror_error_t **error );
@@ -88,10 +111,50 @@ int libesedb_data_definition_read_record(
      libfcache_cache_t *pages_cache,
      libesedb_table_definition_t *table_definition,
      libesedb_table_definition_t *template_table_definition,
+     libesedb_column_projection_t *column_projection,
      libcdata_array_t *values_array,
+     uint8_t **record_data_copy,
+     size_t *record_data_copy_size,
+     size_t *record_data_copy_allocated_size,
+     libesedb_data_type_definition_t **data_type_definitions,
+     int *number_of_allocated_data_type_definitions,
      uint8_t *record_flags,
      libcerror_error_t **error );
 
+int libesedb_data_definition_get_tagged_data_type_by_identifier(
+     libesedb_io_handle_t *io_handle,
+     const uint8_t *record_data,
+     size_t record_data_size,
+     uint16_t tagged_data_types_offset,
+     uint32_t identifier,
+     int *tagged_data_type_index,
+     libesedb_data_type_definition_t *data_type_definition,
+     libcerror_error_t **error );
+
+int libesedb_data_definition_get_record_value_encoding(
+     libesedb_io_handle_t *io_handle,
+     libesedb_catalog_definition_t *column_catalog_definition,
+     int *encoding,
+     libcerror_error_t **error );
+
+int libesedb_data_definition_read_record_value(
+     libesedb_io_handle_t *io_handle,
+     libesedb_catalog_definition_t *column_catalog_definition,
+     libesedb_data_type_definition_t *data_type_definition,
+     const uint8_t *record_data,
+     size_t record_data_size,
+     libfvalue_value_t **record_value,
+     libcerror_error_t **error );
+
+int libesedb_data_definition_refill_record_value(
+     libesedb_io_handle_t *io_handle,
+     libesedb_catalog_definition_t *column_catalog_definition,
+     libesedb_data_type_definition_t *data_type_definition,
+     const uint8_t *record_data,
+     size_t record_data_size,
+     libfvalue_value_t *record_value,
+     libcerror_error_t **error );
+
 int libesedb_data_definition_read_long_value(
      libesedb_data_definition_t *data_definition,
      libbfio_handle_t *file_io_handle,
@@ -211,9 +211,10 @@ int libesedb_database_read(
 	}
 	database_page_tree = NULL;
 
-	if( libfcache_cache_initialize(
+	if( libesedb_io_handle_create_cache(
+	     io_handle,
+	     LIBESEDB_CACHE_TYPE_TREE_VALUES,
 	     &database_values_cache,
-	     LIBESEDB_MAXIMUM_CACHE_ENTRIES_TREE_VALUES,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -322,7 +323,9 @@ int libesedb_database_read(
 		}
 #endif
 	}
-	if( libfcache_cache_free(
+	if( libesedb_io_handle_free_cache(
+	     io_handle,
+	     LIBESEDB_CACHE_TYPE_TREE_VALUES,
 	     &database_values_cache,
 	     error ) != 1 )
 	{
@@ -353,7 +356,9 @@ int libesedb_database_read(
 on_error:
 	if( database_values_cache != NULL )
 	{
-		libfcache_cache_free(
+		libesedb_io_handle_free_cache(
+		 io_handle,
+		 LIBESEDB_CACHE_TYPE_TREE_VALUES,
 		 &database_values_cache,
 		 NULL );
 	}
@@ -252,6 +252,11 @@ int libesedb_file_signal_abort(
 }
 
 /* Opens a file
+ * If LIBESEDB_ACCESS_FLAG_MEMORY_MAPPED is set and the system supports it the pages
+ * are referenced directly in a memory mapping of the file instead of being copied
+ * If the file cannot be mapped the pages are read from the file instead
+ * If LIBESEDB_ACCESS_FLAG_READ_AHEAD is set a separate file descriptor is opened
+ * to pass read-ahead hints for sequential page reads to the operating system
  * Returns 1 if successful or -1 on error
  */
 int libesedb_file_open(
@@ -359,6 +364,53 @@ int libesedb_file_open(
 
 		goto on_error;
 	}
+	if( ( access_flags & LIBESEDB_ACCESS_FLAG_MEMORY_MAPPED ) != 0 )
+	{
+		/* Fall back to reading the pages if the file cannot be mapped
+		 */
+		if( libesedb_io_handle_map_file(
+		     internal_file->io_handle,
+		     filename,
+		     error ) == -1 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( ( libcnotify_verbose != 0 )
+			 && ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+	}
+	/* A memory mapped file receives its read-ahead hints through the mapping
+	 */
+	if( ( ( access_flags & LIBESEDB_ACCESS_FLAG_READ_AHEAD ) != 0 )
+	 && ( internal_file->io_handle->mapped_data == NULL ) )
+	{
+		/* Read-ahead is only a hint, continue without it if the file cannot be opened
+		 */
+		if( libesedb_io_handle_open_read_ahead(
+		     internal_file->io_handle,
+		     filename,
+		     error ) == -1 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( ( libcnotify_verbose != 0 )
+			 && ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+	}
 	if( libesedb_file_open_file_io_handle(
 	     file,
 	     file_io_handle,
@@ -380,6 +432,15 @@ int libesedb_file_open(
 	return( 1 );
 
 on_error:
+	if( internal_file->io_handle != NULL )
+	{
+		libesedb_io_handle_unmap_file(
+		 internal_file->io_handle,
+		 NULL );
+		libesedb_io_handle_close_read_ahead(
+		 internal_file->io_handle,
+		 NULL );
+	}
 	if( file_io_handle != NULL )
 	{
 		libbfio_handle_free(
@@ -392,6 +453,7 @@ on_error:
 #if defined( HAVE_WIDE_CHARACTER_TYPE )
 
 /* Opens a file
+ * LIBESEDB_ACCESS_FLAG_MEMORY_MAPPED and LIBESEDB_ACCESS_FLAG_READ_AHEAD are not supported and are ignored
  * Returns 1 if successful or -1 on error
  */
 int libesedb_file_open_wide(
@@ -841,11 +903,12 @@ int libesedb_file_open_read(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error )
 {
-	static char *function = "libesedb_file_open_read";
-	off64_t file_offset   = 0;
-	size64_t file_size    = 0;
-	int result            = 0;
-	int segment_index     = 0;
+	static char *function               = "libesedb_file_open_read";
+	off64_t file_offset                 = 0;
+	size64_t file_size                  = 0;
+	int maximum_number_of_cache_entries = 0;
+	int result                          = 0;
+	int segment_index                   = 0;
 
 	if( internal_file == NULL )
 	{
@@ -1137,9 +1200,24 @@ int libesedb_file_open_read(
 
 		goto on_error;
 	}
+	if( libesedb_io_handle_get_maximum_number_of_cache_entries(
+	     internal_file->io_handle,
+	     LIBESEDB_CACHE_TYPE_PAGES,
+	     &maximum_number_of_cache_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve maximum number of cache entries.",
+		 function );
+
+		goto on_error;
+	}
 	if( libfcache_cache_initialize(
 	     &( internal_file->pages_cache ),
-	     LIBESEDB_MAXIMUM_CACHE_ENTRIES_PAGES,
+	     maximum_number_of_cache_entries,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1534,6 +1612,500 @@ int libesedb_file_get_page_size(
 	return( 1 );
 }
 
+/* Retrieves the number of pages
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_get_number_of_pages(
+     libesedb_file_t *file,
+     uint32_t *number_of_pages,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_get_number_of_pages";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_pages == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of pages.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_pages = internal_file->io_handle->last_page_number;
+
+	return( 1 );
+}
+
+/* Verifies all the pages of the file
+ * The pages are read independent of the pages cache and the checksum policy
+ * A number of threads of 0 or 1 verifies the pages in the calling thread, if
+ * multi-threading is supported a larger value is the maximum number of threads
+ * If pages_status is not NULL the status of page number N is stored at index N - 1,
+ * where the status is one of the LIBESEDB_PAGE_STATUS values
+ * If verification is aborted the remaining pages have the not verified status
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int libesedb_file_verify_pages(
+     libesedb_file_t *file,
+     int number_of_threads,
+     uint8_t *pages_status,
+     size_t pages_status_size,
+     uint32_t *number_of_corrupted_pages,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_verify_pages";
+	int result                              = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_io_handle_verify_pages(
+	          internal_file->io_handle,
+	          internal_file->file_io_handle,
+	          number_of_threads,
+	          pages_status,
+	          pages_status_size,
+	          number_of_corrupted_pages,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to verify pages.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the memory budget of the caches
+ * A memory budget of 0 represents the default cache sizes
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_get_memory_budget(
+     libesedb_file_t *file,
+     size64_t *memory_budget,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_get_memory_budget";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_budget == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory budget.",
+		 function );
+
+		return( -1 );
+	}
+	*memory_budget = internal_file->io_handle->memory_budget;
+
+	return( 1 );
+}
+
+/* Sets the memory budget of the caches
+ * The memory budget is the approximate maximum number of bytes used by all the caches
+ * of the file together. Half of it is used by the pages: a quarter of that by the pages
+ * cache, which contains the recently read pages, and the remainder by the ghost pages
+ * queue and the hot pages, which contain the pages that are read more than once.
+ * The other half is shared equally by the tree values caches, which are created per
+ * table, index and catalog. The tree values caches are resized when a tree values
+ * cache is created or freed, for example when a table is freed. Every cache has at
+ * least 1 entry, hence with a large number of open tables and indexes the budget
+ * can be exceeded by 1 entry per cache
+ * The memory budget can only be set when the file is not open
+ * A memory budget of 0 represents the default cache sizes
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_set_memory_budget(
+     libesedb_file_t *file,
+     size64_t memory_budget,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_set_memory_budget";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file->io_handle->memory_budget = memory_budget;
+
+	return( 1 );
+}
+
+/* Retrieves the checksum policy
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_get_checksum_policy(
+     libesedb_file_t *file,
+     int *checksum_policy,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_get_checksum_policy";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( checksum_policy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum policy.",
+		 function );
+
+		return( -1 );
+	}
+	*checksum_policy = internal_file->io_handle->checksum_policy;
+
+	return( 1 );
+}
+
+/* Sets the checksum policy
+ * The checksum policy applies to pages that are read afterwards, pages that are
+ * in the pages cache are not verified again
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_set_checksum_policy(
+     libesedb_file_t *file,
+     int checksum_policy,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_set_checksum_policy";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( checksum_policy != LIBESEDB_CHECKSUM_POLICY_DISABLED )
+	 && ( checksum_policy != LIBESEDB_CHECKSUM_POLICY_VERIFY_ON_READ )
+	 && ( checksum_policy != LIBESEDB_CHECKSUM_POLICY_VERIFY_ON_FIRST_READ )
+	 && ( checksum_policy != LIBESEDB_CHECKSUM_POLICY_VERIFY_IN_BACKGROUND ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported checksum policy.",
+		 function );
+
+		return( -1 );
+	}
+	/* The pages that are queued to be verified in the background are verified
+	 * before the checksum policy is changed
+	 */
+	if( libesedb_io_handle_join_checksum_verification(
+	     internal_file->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join checksum verification.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file->io_handle->checksum_policy = checksum_policy;
+
+	return( 1 );
+}
+
+/* Sets the checksum mismatch callback
+ * The callback is called once for every page of which the checksum does not match,
+ * when the checksums are verified in the background the callback is called from
+ * the background thread
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_set_checksum_mismatch_callback(
+     libesedb_file_t *file,
+     void (*callback_function)(
+            uint32_t page_number,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_set_checksum_mismatch_callback";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* The callback cannot be changed while it can be called by the background thread
+	 */
+	if( libesedb_io_handle_join_checksum_verification(
+	     internal_file->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join checksum verification.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file->io_handle->checksum_mismatch_callback      = callback_function;
+	internal_file->io_handle->checksum_mismatch_callback_data = callback_data;
+
+	return( 1 );
+}
+
+/* Retrieves the number of page checksum mismatches
+ * Waits until the pages that are queued to be verified in the background have been verified
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_get_number_of_checksum_mismatches(
+     libesedb_file_t *file,
+     uint32_t *number_of_checksum_mismatches,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_get_number_of_checksum_mismatches";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_checksum_mismatches == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of checksum mismatches.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_io_handle_join_checksum_verification(
+	     internal_file->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join checksum verification.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_checksum_mismatches = internal_file->io_handle->number_of_checksum_mismatches;
+
+	return( 1 );
+}
+
 /* Retrieves the number of tables
  * Returns 1 if successful or -1 on error
  */
@@ -1705,6 +2277,8 @@ int libesedb_file_get_table(
 	     internal_file->io_handle,
 	     table_definition,
 	     template_table_definition,
+	     internal_file->pages_vector,
+	     internal_file->pages_cache,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1837,6 +2411,8 @@ int libesedb_file_get_table_by_utf8_name(
 		     internal_file->io_handle,
 		     table_definition,
 		     template_table_definition,
+		     internal_file->pages_vector,
+		     internal_file->pages_cache,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -1970,6 +2546,8 @@ int libesedb_file_get_table_by_utf16_name(
 		     internal_file->io_handle,
 		     table_definition,
 		     template_table_definition,
+		     internal_file->pages_vector,
+		     internal_file->pages_cache,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
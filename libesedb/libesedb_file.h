@@ -58,11 +58,11 @@ struct libesedb_internal_file
 	 */
 	uint8_t file_io_handle_opened_in_library;
 
-	/* The pages vector
+	/* The pages vector, shared by the catalogs, tables, indexes and long values
 	 */
 	libfdata_vector_t *pages_vector;
 
-	/* The pages cache
+	/* The pages cache, shared by the catalogs, tables, indexes and long values
 	 */
 	libfcache_cache_t *pages_cache;
 
@@ -155,6 +155,60 @@ int libesedb_file_get_page_size(
      uint32_t *page_size,
      libcerror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_file_get_number_of_pages(
+     libesedb_file_t *file,
+     uint32_t *number_of_pages,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_file_verify_pages(
+     libesedb_file_t *file,
+     int number_of_threads,
+     uint8_t *pages_status,
+     size_t pages_status_size,
+     uint32_t *number_of_corrupted_pages,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_file_get_memory_budget(
+     libesedb_file_t *file,
+     size64_t *memory_budget,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_file_set_memory_budget(
+     libesedb_file_t *file,
+     size64_t memory_budget,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_file_get_checksum_policy(
+     libesedb_file_t *file,
+     int *checksum_policy,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_file_set_checksum_policy(
+     libesedb_file_t *file,
+     int checksum_policy,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_file_set_checksum_mismatch_callback(
+     libesedb_file_t *file,
+     void (*callback_function)(
+            uint32_t page_number,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_file_get_number_of_checksum_mismatches(
+     libesedb_file_t *file,
+     uint32_t *number_of_checksum_mismatches,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_file_get_number_of_tables(
      libesedb_file_t *file,
@@ -0,0 +1,735 @@
+/*
+ * Hot pages functions
+ *
+ * Copyright (C) 2009-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libesedb_hot_pages.h"
+#include "libesedb_libcerror.h"
+
+/* Creates hot pages
+ * Make sure the value hot_pages is referencing, is set to NULL
+ * The ghost pages are only tracked up to the last page number
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_hot_pages_initialize(
+     libesedb_hot_pages_t **hot_pages,
+     size_t page_size,
+     uint32_t last_page_number,
+     int maximum_number_of_pages,
+     int maximum_number_of_ghost_pages,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_hot_pages_initialize";
+	int bucket_index      = 0;
+
+	if( hot_pages == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hot pages.",
+		 function );
+
+		return( -1 );
+	}
+	if( *hot_pages != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid hot pages value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page_size == 0 )
+	 || ( page_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_pages <= 0 )
+	 || ( (size_t) maximum_number_of_pages > ( (size_t) SSIZE_MAX / sizeof( libesedb_hot_page_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of pages value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_ghost_pages <= 0 )
+	 || ( (size_t) maximum_number_of_ghost_pages > ( (size_t) SSIZE_MAX / sizeof( uint32_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of ghost pages value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*hot_pages = memory_allocate_structure(
+	              libesedb_hot_pages_t );
+
+	if( *hot_pages == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hot pages.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *hot_pages,
+	     0,
+	     sizeof( libesedb_hot_pages_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hot pages.",
+		 function );
+
+		memory_free(
+		 *hot_pages );
+
+		*hot_pages = NULL;
+
+		return( -1 );
+	}
+	/* The page data of the hot pages is allocated when the hot page is first used
+	 */
+	( *hot_pages )->pages = (libesedb_hot_page_t *) memory_allocate(
+	                                                 sizeof( libesedb_hot_page_t ) * maximum_number_of_pages );
+
+	if( ( *hot_pages )->pages == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create pages.",
+		 function );
+
+		goto on_error;
+	}
+	( *hot_pages )->buckets = (int *) memory_allocate(
+	                                   sizeof( int ) * maximum_number_of_pages );
+
+	if( ( *hot_pages )->buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets.",
+		 function );
+
+		goto on_error;
+	}
+	for( bucket_index = 0;
+	     bucket_index < maximum_number_of_pages;
+	     bucket_index++ )
+	{
+		( *hot_pages )->buckets[ bucket_index ] = -1;
+	}
+	( *hot_pages )->ghost_page_numbers = (uint32_t *) memory_allocate(
+	                                                   sizeof( uint32_t ) * maximum_number_of_ghost_pages );
+
+	if( ( *hot_pages )->ghost_page_numbers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create ghost page numbers.",
+		 function );
+
+		goto on_error;
+	}
+	( *hot_pages )->ghost_pages_bitmap_size = (size_t) ( last_page_number / 8 ) + 1;
+
+	( *hot_pages )->ghost_pages_bitmap = (uint8_t *) memory_allocate(
+	                                                  sizeof( uint8_t ) * ( *hot_pages )->ghost_pages_bitmap_size );
+
+	if( ( *hot_pages )->ghost_pages_bitmap == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create ghost pages bitmap.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *hot_pages )->ghost_pages_bitmap,
+	     0,
+	     sizeof( uint8_t ) * ( *hot_pages )->ghost_pages_bitmap_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear ghost pages bitmap.",
+		 function );
+
+		goto on_error;
+	}
+	( *hot_pages )->page_size                     = page_size;
+	( *hot_pages )->maximum_number_of_pages       = maximum_number_of_pages;
+	( *hot_pages )->number_of_buckets             = maximum_number_of_pages;
+	( *hot_pages )->most_recently_used_index      = -1;
+	( *hot_pages )->least_recently_used_index     = -1;
+	( *hot_pages )->maximum_number_of_ghost_pages = maximum_number_of_ghost_pages;
+
+	return( 1 );
+
+on_error:
+	if( *hot_pages != NULL )
+	{
+		if( ( *hot_pages )->ghost_pages_bitmap != NULL )
+		{
+			memory_free(
+			 ( *hot_pages )->ghost_pages_bitmap );
+		}
+		if( ( *hot_pages )->ghost_page_numbers != NULL )
+		{
+			memory_free(
+			 ( *hot_pages )->ghost_page_numbers );
+		}
+		if( ( *hot_pages )->buckets != NULL )
+		{
+			memory_free(
+			 ( *hot_pages )->buckets );
+		}
+		if( ( *hot_pages )->pages != NULL )
+		{
+			memory_free(
+			 ( *hot_pages )->pages );
+		}
+		memory_free(
+		 *hot_pages );
+
+		*hot_pages = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees hot pages
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_hot_pages_free(
+     libesedb_hot_pages_t **hot_pages,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_hot_pages_free";
+	int page_index        = 0;
+
+	if( hot_pages == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hot pages.",
+		 function );
+
+		return( -1 );
+	}
+	if( *hot_pages != NULL )
+	{
+		for( page_index = 0;
+		     page_index < ( *hot_pages )->number_of_pages;
+		     page_index++ )
+		{
+			if( ( *hot_pages )->pages[ page_index ].data != NULL )
+			{
+				memory_free(
+				 ( *hot_pages )->pages[ page_index ].data );
+			}
+		}
+		memory_free(
+		 ( *hot_pages )->ghost_pages_bitmap );
+
+		memory_free(
+		 ( *hot_pages )->ghost_page_numbers );
+
+		memory_free(
+		 ( *hot_pages )->buckets );
+
+		memory_free(
+		 ( *hot_pages )->pages );
+
+		memory_free(
+		 *hot_pages );
+
+		*hot_pages = NULL;
+	}
+	return( 1 );
+}
+
+/* Retrieves the index of the hot page of a specific page number
+ * Returns 1 if successful, 0 if no such hot page or -1 on error
+ */
+int libesedb_hot_pages_get_index_by_page_number(
+     libesedb_hot_pages_t *hot_pages,
+     uint32_t page_number,
+     int *page_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_hot_pages_get_index_by_page_number";
+	int safe_page_index   = 0;
+
+	if( hot_pages == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hot pages.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_number == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page index.",
+		 function );
+
+		return( -1 );
+	}
+	safe_page_index = hot_pages->buckets[ page_number % (uint32_t) hot_pages->number_of_buckets ];
+
+	while( safe_page_index != -1 )
+	{
+		if( hot_pages->pages[ safe_page_index ].page_number == page_number )
+		{
+			*page_index = safe_page_index;
+
+			return( 1 );
+		}
+		safe_page_index = hot_pages->pages[ safe_page_index ].next_in_bucket_index;
+	}
+	return( 0 );
+}
+
+/* Retrieves the page data of a specific hot page
+ * The hot page becomes the most recently used hot page
+ * Returns 1 if successful, 0 if no such hot page or -1 on error
+ */
+int libesedb_hot_pages_get_page_data(
+     libesedb_hot_pages_t *hot_pages,
+     uint32_t page_number,
+     const uint8_t **page_data,
+     size_t *page_data_size,
+     libcerror_error_t **error )
+{
+	libesedb_hot_page_t *hot_page = NULL;
+	static char *function         = "libesedb_hot_pages_get_page_data";
+	int page_index                = 0;
+	int result                    = 0;
+
+	if( page_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page data.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page data size.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_hot_pages_get_index_by_page_number(
+	          hot_pages,
+	          page_number,
+	          &page_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve index of hot page: %" PRIu32 ".",
+		 function,
+		 page_number );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	hot_page = &( hot_pages->pages[ page_index ] );
+
+	/* Move the hot page to the front of the most recently used list
+	 */
+	if( hot_pages->most_recently_used_index != page_index )
+	{
+		hot_pages->pages[ hot_page->previous_index ].next_index = hot_page->next_index;
+
+		if( hot_page->next_index != -1 )
+		{
+			hot_pages->pages[ hot_page->next_index ].previous_index = hot_page->previous_index;
+		}
+		else
+		{
+			hot_pages->least_recently_used_index = hot_page->previous_index;
+		}
+		hot_page->previous_index = -1;
+		hot_page->next_index     = hot_pages->most_recently_used_index;
+
+		hot_pages->pages[ hot_pages->most_recently_used_index ].previous_index = page_index;
+
+		hot_pages->most_recently_used_index = page_index;
+	}
+	*page_data      = hot_page->data;
+	*page_data_size = hot_pages->page_size;
+
+	return( 1 );
+}
+
+/* Sets the page data of a specific hot page
+ * If the maximum number of hot pages is reached the least recently used hot page is replaced
+ * The hot page becomes the most recently used hot page
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_hot_pages_set_page_data(
+     libesedb_hot_pages_t *hot_pages,
+     uint32_t page_number,
+     const uint8_t *page_data,
+     size_t page_data_size,
+     libcerror_error_t **error )
+{
+	libesedb_hot_page_t *hot_page = NULL;
+	static char *function         = "libesedb_hot_pages_set_page_data";
+	int *bucket_page_index        = NULL;
+	int page_index                = 0;
+	int result                    = 0;
+
+	if( page_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page data.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_hot_pages_get_index_by_page_number(
+	          hot_pages,
+	          page_number,
+	          &page_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve index of hot page: %" PRIu32 ".",
+		 function,
+		 page_number );
+
+		return( -1 );
+	}
+	if( page_data_size != hot_pages->page_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( result == 0 )
+	{
+		if( hot_pages->number_of_pages < hot_pages->maximum_number_of_pages )
+		{
+			page_index = hot_pages->number_of_pages;
+			hot_page   = &( hot_pages->pages[ page_index ] );
+
+			hot_page->data = (uint8_t *) memory_allocate(
+			                              sizeof( uint8_t ) * hot_pages->page_size );
+
+			if( hot_page->data == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create hot page data.",
+				 function );
+
+				return( -1 );
+			}
+			hot_pages->number_of_pages += 1;
+		}
+		else
+		{
+			/* Replace the least recently used hot page
+			 */
+			page_index = hot_pages->least_recently_used_index;
+			hot_page   = &( hot_pages->pages[ page_index ] );
+
+			bucket_page_index = &( hot_pages->buckets[ hot_page->page_number % (uint32_t) hot_pages->number_of_buckets ] );
+
+			while( *bucket_page_index != page_index )
+			{
+				bucket_page_index = &( hot_pages->pages[ *bucket_page_index ].next_in_bucket_index );
+			}
+			*bucket_page_index = hot_page->next_in_bucket_index;
+
+			hot_pages->least_recently_used_index = hot_page->previous_index;
+
+			if( hot_page->previous_index != -1 )
+			{
+				hot_pages->pages[ hot_page->previous_index ].next_index = -1;
+			}
+			else
+			{
+				hot_pages->most_recently_used_index = -1;
+			}
+		}
+		hot_page->page_number = page_number;
+
+		bucket_page_index = &( hot_pages->buckets[ page_number % (uint32_t) hot_pages->number_of_buckets ] );
+
+		hot_page->next_in_bucket_index = *bucket_page_index;
+		*bucket_page_index             = page_index;
+
+		hot_page->previous_index = -1;
+		hot_page->next_index     = hot_pages->most_recently_used_index;
+
+		if( hot_pages->most_recently_used_index != -1 )
+		{
+			hot_pages->pages[ hot_pages->most_recently_used_index ].previous_index = page_index;
+		}
+		else
+		{
+			hot_pages->least_recently_used_index = page_index;
+		}
+		hot_pages->most_recently_used_index = page_index;
+	}
+	else
+	{
+		hot_page = &( hot_pages->pages[ page_index ] );
+	}
+	if( memory_copy(
+	     hot_page->data,
+	     page_data,
+	     page_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy page data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a page number to the ghost pages queue
+ * If the maximum number of ghost pages is reached the oldest ghost page is replaced
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_hot_pages_append_ghost_page(
+     libesedb_hot_pages_t *hot_pages,
+     uint32_t page_number,
+     libcerror_error_t **error )
+{
+	static char *function      = "libesedb_hot_pages_append_ghost_page";
+	uint32_t ghost_page_number = 0;
+
+	if( hot_pages == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hot pages.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page_number == 0 )
+	 || ( (size_t) ( page_number / 8 ) >= hot_pages->ghost_pages_bitmap_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( hot_pages->number_of_ghost_pages < hot_pages->maximum_number_of_ghost_pages )
+	{
+		hot_pages->number_of_ghost_pages += 1;
+	}
+	else
+	{
+		ghost_page_number = hot_pages->ghost_page_numbers[ hot_pages->ghost_page_index ];
+
+		hot_pages->ghost_pages_bitmap[ ghost_page_number / 8 ] &= (uint8_t) ~( 1 << ( ghost_page_number % 8 ) );
+	}
+	hot_pages->ghost_page_numbers[ hot_pages->ghost_page_index ] = page_number;
+
+	hot_pages->ghost_pages_bitmap[ page_number / 8 ] |= (uint8_t) ( 1 << ( page_number % 8 ) );
+
+	hot_pages->ghost_page_index += 1;
+
+	if( hot_pages->ghost_page_index >= hot_pages->maximum_number_of_ghost_pages )
+	{
+		hot_pages->ghost_page_index = 0;
+	}
+	return( 1 );
+}
+
+/* Admits a page that was read from the file
+ * A page that is read again while its page number is in the ghost pages queue
+ * is stored as a hot page, otherwise its page number is appended to the ghost
+ * pages queue. A page number remains in the ghost pages queue after the page
+ * is stored as a hot page, hence every page number is in the queue only once
+ * Pages beyond the last page number are not admitted
+ * Returns 1 if the page was stored as a hot page, 0 if not or -1 on error
+ */
+int libesedb_hot_pages_admit_page(
+     libesedb_hot_pages_t *hot_pages,
+     uint32_t page_number,
+     const uint8_t *page_data,
+     size_t page_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_hot_pages_admit_page";
+
+	if( hot_pages == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hot pages.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page_number == 0 )
+	 || ( (size_t) ( page_number / 8 ) >= hot_pages->ghost_pages_bitmap_size ) )
+	{
+		return( 0 );
+	}
+	if( ( hot_pages->ghost_pages_bitmap[ page_number / 8 ] & ( 1 << ( page_number % 8 ) ) ) == 0 )
+	{
+		if( libesedb_hot_pages_append_ghost_page(
+		     hot_pages,
+		     page_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append ghost page: %" PRIu32 ".",
+			 function,
+			 page_number );
+
+			return( -1 );
+		}
+		return( 0 );
+	}
+	if( libesedb_hot_pages_set_page_data(
+	     hot_pages,
+	     page_number,
+	     page_data,
+	     page_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set data of hot page: %" PRIu32 ".",
+		 function,
+		 page_number );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
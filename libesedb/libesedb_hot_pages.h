@@ -0,0 +1,177 @@
+/*
+ * Hot pages functions
+ *
+ * Copyright (C) 2009-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_HOT_PAGES_H )
+#define _LIBESEDB_HOT_PAGES_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libesedb_hot_page libesedb_hot_page_t;
+
+struct libesedb_hot_page
+{
+	/* The page number
+	 */
+	uint32_t page_number;
+
+	/* The page data
+	 */
+	uint8_t *data;
+
+	/* The index of the more recently used hot page, -1 if none
+	 */
+	int previous_index;
+
+	/* The index of the less recently used hot page, -1 if none
+	 */
+	int next_index;
+
+	/* The index of the next hot page in the same bucket, -1 if none
+	 */
+	int next_in_bucket_index;
+};
+
+typedef struct libesedb_hot_pages libesedb_hot_pages_t;
+
+/* The hot pages implement the frequently used part of a 2Q pages cache:
+ * the pages cache (A1in) contains the recently read pages, the ghost pages
+ * queue (A1out) contains the page numbers of recently read pages and the
+ * hot pages (Am) contain a copy of the data of the pages that are read again
+ * while their page number is in the ghost pages queue.
+ * Pages that are read only once, for example by a sequential scan, do not
+ * replace the hot pages.
+ */
+struct libesedb_hot_pages
+{
+	/* The page size
+	 */
+	size_t page_size;
+
+	/* The hot pages
+	 */
+	libesedb_hot_page_t *pages;
+
+	/* The number of hot pages
+	 */
+	int number_of_pages;
+
+	/* The maximum number of hot pages
+	 */
+	int maximum_number_of_pages;
+
+	/* The index of the most recently used hot page, -1 if none
+	 */
+	int most_recently_used_index;
+
+	/* The index of the least recently used hot page, -1 if none
+	 */
+	int least_recently_used_index;
+
+	/* The buckets with the index of the first hot page of the bucket, -1 if none
+	 */
+	int *buckets;
+
+	/* The number of buckets
+	 */
+	int number_of_buckets;
+
+	/* The ghost page numbers, stored as a circular queue
+	 */
+	uint32_t *ghost_page_numbers;
+
+	/* The number of ghost pages
+	 */
+	int number_of_ghost_pages;
+
+	/* The maximum number of ghost pages
+	 */
+	int maximum_number_of_ghost_pages;
+
+	/* The index of the oldest ghost page number
+	 */
+	int ghost_page_index;
+
+	/* The bitmap of the page numbers in the ghost pages queue
+	 */
+	uint8_t *ghost_pages_bitmap;
+
+	/* The ghost pages bitmap size
+	 */
+	size_t ghost_pages_bitmap_size;
+};
+
+int libesedb_hot_pages_initialize(
+     libesedb_hot_pages_t **hot_pages,
+     size_t page_size,
+     uint32_t last_page_number,
+     int maximum_number_of_pages,
+     int maximum_number_of_ghost_pages,
+     libcerror_error_t **error );
+
+int libesedb_hot_pages_free(
+     libesedb_hot_pages_t **hot_pages,
+     libcerror_error_t **error );
+
+int libesedb_hot_pages_get_index_by_page_number(
+     libesedb_hot_pages_t *hot_pages,
+     uint32_t page_number,
+     int *page_index,
+     libcerror_error_t **error );
+
+int libesedb_hot_pages_get_page_data(
+     libesedb_hot_pages_t *hot_pages,
+     uint32_t page_number,
+     const uint8_t **page_data,
+     size_t *page_data_size,
+     libcerror_error_t **error );
+
+int libesedb_hot_pages_set_page_data(
+     libesedb_hot_pages_t *hot_pages,
+     uint32_t page_number,
+     const uint8_t *page_data,
+     size_t page_data_size,
+     libcerror_error_t **error );
+
+int libesedb_hot_pages_append_ghost_page(
+     libesedb_hot_pages_t *hot_pages,
+     uint32_t page_number,
+     libcerror_error_t **error );
+
+int libesedb_hot_pages_admit_page(
+     libesedb_hot_pages_t *hot_pages,
+     uint32_t page_number,
+     const uint8_t *page_data,
+     size_t page_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_HOT_PAGES_H ) */
+
@@ -20,14 +20,17 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <memory.h>
 #include <types.h>
 
 #include "libesedb_catalog_definition.h"
+#include "libesedb_column_projection.h"
 #include "libesedb_data_definition.h"
 #include "libesedb_definitions.h"
 #include "libesedb_io_handle.h"
 #include "libesedb_index.h"
+#include "libesedb_index_cursor.h"
 #include "libesedb_key.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
@@ -35,7 +38,9 @@
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
 #include "libesedb_page_tree.h"
+#include "libesedb_page_tree_cursor.h"
 #include "libesedb_record.h"
+#include "libesedb_table_definition.h"
 #include "libesedb_types.h"
 
 /* Creates an index
@@ -185,9 +190,10 @@ int libesedb_index_initialize(
 
 		goto on_error;
 	}
-	if( libfcache_cache_initialize(
+	if( libesedb_io_handle_create_cache(
+	     io_handle,
+	     LIBESEDB_CACHE_TYPE_INDEX_VALUES,
 	     &( internal_index->index_values_cache ),
-	     LIBESEDB_MAXIMUM_CACHE_ENTRIES_INDEX_VALUES,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -232,7 +238,21 @@ int libesedb_index_initialize(
 	internal_index->table_values_cache        = table_values_cache;
 	internal_index->long_values_tree          = long_values_tree;
 	internal_index->long_values_cache         = long_values_cache;
+	internal_index->index_page_tree           = index_page_tree;
+
+	if( libesedb_index_read_key_columns(
+	     internal_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read key columns.",
+		 function );
 
+		goto on_error;
+	}
 	*index = (libesedb_index_t *) internal_index;
 
 	return( 1 );
@@ -240,9 +260,21 @@ int libesedb_index_initialize(
 on_error:
 	if( internal_index != NULL )
 	{
+		if( internal_index->key_column_types != NULL )
+		{
+			memory_free(
+			 internal_index->key_column_types );
+		}
+		if( internal_index->key_column_identifiers != NULL )
+		{
+			memory_free(
+			 internal_index->key_column_identifiers );
+		}
 		if( internal_index->index_values_cache != NULL )
 		{
-			libfcache_cache_free(
+			libesedb_io_handle_free_cache(
+			 io_handle,
+			 LIBESEDB_CACHE_TYPE_INDEX_VALUES,
 			 &( internal_index->index_values_cache ),
 			 NULL );
 		}
@@ -302,7 +334,9 @@ int libesedb_index_free(
 
 			result = -1;
 		}
-		if( libfcache_cache_free(
+		if( libesedb_io_handle_free_cache(
+		     internal_index->io_handle,
+		     LIBESEDB_CACHE_TYPE_INDEX_VALUES,
 		     &( internal_index->index_values_cache ),
 		     error ) != 1 )
 		{
@@ -315,12 +349,255 @@ int libesedb_index_free(
 
 			result = -1;
 		}
+		if( internal_index->column_projection != NULL )
+		{
+			if( libesedb_column_projection_free(
+			     &( internal_index->column_projection ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free column projection.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_index->key_column_types != NULL )
+		{
+			memory_free(
+			 internal_index->key_column_types );
+		}
+		if( internal_index->key_column_identifiers != NULL )
+		{
+			memory_free(
+			 internal_index->key_column_identifiers );
+		}
 		memory_free(
 		 internal_index );
 	}
 	return( result );
 }
 
+/* Reads the key columns from the key field identifiers (KeyFldIDs) of the index catalog definition
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_read_key_columns(
+     libesedb_internal_index_t *internal_index,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	static char *function                                    = "libesedb_index_read_key_columns";
+	size_t entry_size                                        = 0;
+	size_t key_field_identifiers_offset                      = 0;
+	uint16_t column_identifier                               = 0;
+	int column_index                                         = 0;
+	int key_column_index                                     = 0;
+	int number_of_key_columns                                = 0;
+	int result                                               = 0;
+
+	if( internal_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_index->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_index->index_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index - missing index catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_index->key_column_identifiers != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid index - key column identifiers value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_index->index_catalog_definition->key_field_identifiers == NULL )
+	 || ( internal_index->index_catalog_definition->key_field_identifiers_size == 0 ) )
+	{
+		return( 1 );
+	}
+	/* Before format revision 0x07 a key field identifier is a 16-bit signed column identifier
+	 * that is negative for a descending key column
+	 */
+	if( internal_index->io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_4BYTE_INDEX_SEGMENTS )
+	{
+		entry_size = 4;
+	}
+	else
+	{
+		entry_size = 2;
+	}
+	if( ( internal_index->index_catalog_definition->key_field_identifiers_size % entry_size ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported key field identifiers size.",
+		 function );
+
+		goto on_error;
+	}
+	number_of_key_columns = (int) ( internal_index->index_catalog_definition->key_field_identifiers_size / entry_size );
+
+	internal_index->key_column_identifiers = (uint32_t *) memory_allocate(
+	                                                       sizeof( uint32_t ) * number_of_key_columns );
+
+	if( internal_index->key_column_identifiers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create key column identifiers.",
+		 function );
+
+		goto on_error;
+	}
+	internal_index->key_column_types = (uint32_t *) memory_allocate(
+	                                                 sizeof( uint32_t ) * number_of_key_columns );
+
+	if( internal_index->key_column_types == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create key column types.",
+		 function );
+
+		goto on_error;
+	}
+	for( key_column_index = 0;
+	     key_column_index < number_of_key_columns;
+	     key_column_index++ )
+	{
+		if( entry_size == 4 )
+		{
+			byte_stream_copy_to_uint16_little_endian(
+			 &( internal_index->index_catalog_definition->key_field_identifiers[ key_field_identifiers_offset + 2 ] ),
+			 column_identifier );
+		}
+		else
+		{
+			byte_stream_copy_to_uint16_little_endian(
+			 &( internal_index->index_catalog_definition->key_field_identifiers[ key_field_identifiers_offset ] ),
+			 column_identifier );
+
+			if( ( column_identifier & 0x8000 ) != 0 )
+			{
+				column_identifier = (uint16_t) ( 0x10000 - (uint32_t) column_identifier );
+			}
+		}
+		key_field_identifiers_offset += entry_size;
+
+		internal_index->key_column_identifiers[ key_column_index ] = (uint32_t) column_identifier;
+		internal_index->key_column_types[ key_column_index ]       = LIBESEDB_COLUMN_TYPE_NULL;
+
+		result = libesedb_table_definition_get_column_index_by_identifier(
+		          internal_index->table_definition,
+		          (uint32_t) column_identifier,
+		          &column_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve index of column: %" PRIu16 ".",
+			 function,
+			 column_identifier );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			if( libesedb_table_definition_get_column_catalog_definition_by_index(
+			     internal_index->table_definition,
+			     column_index,
+			     &column_catalog_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve column catalog definition: %d.",
+				 function,
+				 column_index );
+
+				goto on_error;
+			}
+			if( column_catalog_definition == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing column catalog definition: %d.",
+				 function,
+				 column_index );
+
+				goto on_error;
+			}
+			internal_index->key_column_types[ key_column_index ] = column_catalog_definition->column_type;
+		}
+	}
+	internal_index->number_of_key_columns = number_of_key_columns;
+
+	return( 1 );
+
+on_error:
+	if( internal_index->key_column_types != NULL )
+	{
+		memory_free(
+		 internal_index->key_column_types );
+
+		internal_index->key_column_types = NULL;
+	}
+	if( internal_index->key_column_identifiers != NULL )
+	{
+		memory_free(
+		 internal_index->key_column_identifiers );
+
+		internal_index->key_column_identifiers = NULL;
+	}
+	return( -1 );
+}
+
 /* Retrieves the index identifier or Father Data Page (FDP) object identifier
  * Returns 1 if successful or -1 on error
  */
@@ -626,22 +903,16 @@ int libesedb_index_get_number_of_records(
 	return( 1 );
 }
 
-/* Retrieves a specific record
+/* Retrieves the number of key columns of the index
  * Returns 1 if successful or -1 on error
  */
-int libesedb_index_get_record(
+int libesedb_index_get_number_of_key_columns(
      libesedb_index_t *index,
-     int record_entry,
-     libesedb_record_t **record,
+     int *number_of_key_columns,
      libcerror_error_t **error )
 {
-	libesedb_data_definition_t *index_data_definition  = NULL;
-	libesedb_data_definition_t *record_data_definition = NULL;
-	libesedb_internal_index_t *internal_index          = NULL;
-	libesedb_key_t *key                                = NULL;
-	uint8_t *index_data                                = NULL;
-	static char *function                              = "libesedb_index_get_record";
-	size_t index_data_size                             = 0;
+	libesedb_internal_index_t *internal_index = NULL;
+	static char *function                     = "libesedb_index_get_number_of_key_columns";
 
 	if( index == NULL )
 	{
@@ -656,119 +927,248 @@ int libesedb_index_get_record(
 	}
 	internal_index = (libesedb_internal_index_t *) index;
 
-	if( record == NULL )
+	if( number_of_key_columns == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record.",
+		 "%s: invalid number of key columns.",
 		 function );
 
 		return( -1 );
 	}
-	if( *record != NULL )
+	*number_of_key_columns = internal_index->number_of_key_columns;
+
+	return( 1 );
+}
+
+/* Retrieves the column identifier of a specific key column of the index
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_get_key_column_identifier(
+     libesedb_index_t *index,
+     int key_column_index,
+     uint32_t *column_identifier,
+     libcerror_error_t **error )
+{
+	libesedb_internal_index_t *internal_index = NULL;
+	static char *function                     = "libesedb_index_get_key_column_identifier";
+
+	if( index == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid record value already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
 		 function );
 
 		return( -1 );
 	}
-	if( libfdata_btree_get_leaf_value_by_index(
-	     internal_index->index_values_tree,
-	     (intptr_t *) internal_index->file_io_handle,
-	     internal_index->index_values_cache,
-	     record_entry,
-	     (intptr_t **) &index_data_definition,
-	     0,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve leaf value: %d from index values tree.",
-		 function,
-		 record_entry );
+	internal_index = (libesedb_internal_index_t *) index;
 
-		goto on_error;
-	}
-	if( libesedb_data_definition_read_data(
-	     index_data_definition,
-	     internal_index->file_io_handle,
-	     internal_index->io_handle,
-	     internal_index->pages_vector,
-	     internal_index->pages_cache,
-	     &index_data,
-	     &index_data_size,
-	     error ) != 1 )
+	if( ( key_column_index < 0 )
+	 || ( key_column_index >= internal_index->number_of_key_columns ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read index data definition data.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid key column index value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libesedb_key_initialize(
-	     &key,
-	     error ) != 1 )
+	if( column_identifier == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create key.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column identifier.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libesedb_key_set_data(
-	     key,
-	     index_data,
-	     index_data_size,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set index data in key.",
-		 function );
+	*column_identifier = internal_index->key_column_identifiers[ key_column_index ];
 
-		goto on_error;
-	}
-	key->type = LIBESEDB_KEY_TYPE_INDEX_VALUE;
+	return( 1 );
+}
 
-	if( libfdata_btree_get_leaf_value_by_key(
-	     internal_index->table_values_tree,
-	     (intptr_t *) internal_index->file_io_handle,
-	     internal_index->table_values_cache,
-	     (intptr_t *) key,
-	     (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libesedb_key_compare,
-	     LIBFDATA_BTREE_SEARCH_FLAG_SCAN_NEXT_NODE,
-	     (intptr_t **) &record_data_definition,
-	     0,
-	     error ) != 1 )
+/* Sets the column projection
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_set_column_projection(
+     libesedb_index_t *index,
+     const uint32_t *column_identifiers,
+     int number_of_column_identifiers,
+     libcerror_error_t **error )
+{
+	libesedb_column_projection_t *column_projection = NULL;
+	libesedb_internal_index_t *internal_index       = NULL;
+	static char *function                           = "libesedb_index_set_column_projection";
+
+	if( index == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve leaf value by key.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libesedb_key_free(
-	     &key,
-	     error ) != 1 )
+	internal_index = (libesedb_internal_index_t *) index;
+
+	if( column_identifiers != NULL )
+	{
+		if( libesedb_column_projection_initialize(
+		     &column_projection,
+		     internal_index->table_definition,
+		     column_identifiers,
+		     number_of_column_identifiers,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create column projection.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( internal_index->column_projection != NULL )
+	{
+		if( libesedb_column_projection_free(
+		     &( internal_index->column_projection ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free column projection.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_index->column_projection = column_projection;
+
+	return( 1 );
+
+on_error:
+	if( column_projection != NULL )
+	{
+		libesedb_column_projection_free(
+		 &column_projection,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the record referenced by an index value
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_get_record_by_data_definition(
+     libesedb_internal_index_t *internal_index,
+     libesedb_data_definition_t *index_data_definition,
+     libesedb_record_t **record,
+     libcerror_error_t **error )
+{
+	libesedb_data_definition_t *record_data_definition = NULL;
+	libesedb_key_t *key                                = NULL;
+	uint8_t *index_data                                = NULL;
+	static char *function                              = "libesedb_index_get_record_by_data_definition";
+	size_t index_data_size                             = 0;
+
+	if( internal_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_data_definition_read_data(
+	     index_data_definition,
+	     internal_index->file_io_handle,
+	     internal_index->io_handle,
+	     internal_index->pages_vector,
+	     internal_index->pages_cache,
+	     &index_data,
+	     &index_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index data definition data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_key_initialize(
+	     &key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create key.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_key_set_data(
+	     key,
+	     index_data,
+	     index_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set index data in key.",
+		 function );
+
+		goto on_error;
+	}
+	key->type = LIBESEDB_KEY_TYPE_INDEX_VALUE;
+
+	if( libfdata_btree_get_leaf_value_by_key(
+	     internal_index->table_values_tree,
+	     (intptr_t *) internal_index->file_io_handle,
+	     internal_index->table_values_cache,
+	     (intptr_t *) key,
+	     (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libesedb_key_compare,
+	     LIBFDATA_BTREE_SEARCH_FLAG_SCAN_NEXT_NODE,
+	     (intptr_t **) &record_data_definition,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve leaf value by key.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_key_free(
+	     &key,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -785,6 +1185,7 @@ int libesedb_index_get_record(
 	     internal_index->io_handle,
 	     internal_index->table_definition,
 	     internal_index->template_table_definition,
+	     internal_index->column_projection,
 	     internal_index->pages_vector,
 	     internal_index->pages_cache,
 	     internal_index->long_values_pages_vector,
@@ -815,3 +1216,1296 @@ on_error:
 	return( -1 );
 }
 
+/* Retrieves a specific record
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_get_record(
+     libesedb_index_t *index,
+     int record_entry,
+     libesedb_record_t **record,
+     libcerror_error_t **error )
+{
+	libesedb_data_definition_t *index_data_definition = NULL;
+	libesedb_internal_index_t *internal_index         = NULL;
+	static char *function                             = "libesedb_index_get_record";
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index = (libesedb_internal_index_t *) index;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_btree_get_leaf_value_by_index(
+	     internal_index->index_values_tree,
+	     (intptr_t *) internal_index->file_io_handle,
+	     internal_index->index_values_cache,
+	     record_entry,
+	     (intptr_t **) &index_data_definition,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve leaf value: %d from index values tree.",
+		 function,
+		 record_entry );
+
+		return( -1 );
+	}
+	if( libesedb_index_get_record_by_data_definition(
+	     internal_index,
+	     index_data_definition,
+	     record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record: %d.",
+		 function,
+		 record_entry );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sorts the keys using a bottom-up merge sort
+ * The sorted entries are filled with the indexes of the keys in ascending key order,
+ * equal keys retain their order
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_sort_keys(
+     libesedb_key_t **keys,
+     int number_of_keys,
+     int *sorted_entries,
+     libcerror_error_t **error )
+{
+	int *merged_entries    = NULL;
+	int *source_entries    = NULL;
+	int *swap_entries      = NULL;
+	int *target_entries    = NULL;
+	static char *function  = "libesedb_index_sort_keys";
+	int entry_index        = 0;
+	int left_entry_index   = 0;
+	int lower_entry_index  = 0;
+	int middle_entry_index = 0;
+	int result             = 0;
+	int right_entry_index  = 0;
+	int run_size           = 0;
+	int upper_entry_index  = 0;
+
+	if( keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid keys.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_keys < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of keys value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( sorted_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sorted entries.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_keys;
+	     entry_index++ )
+	{
+		sorted_entries[ entry_index ] = entry_index;
+	}
+	if( number_of_keys <= 1 )
+	{
+		return( 1 );
+	}
+	merged_entries = (int *) memory_allocate(
+	                          sizeof( int ) * number_of_keys );
+
+	if( merged_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create merged entries.",
+		 function );
+
+		return( -1 );
+	}
+	source_entries = sorted_entries;
+	target_entries = merged_entries;
+
+	for( run_size = 1;
+	     run_size < number_of_keys;
+	     run_size *= 2 )
+	{
+		for( lower_entry_index = 0;
+		     lower_entry_index < number_of_keys;
+		     lower_entry_index += 2 * run_size )
+		{
+			middle_entry_index = lower_entry_index + run_size;
+
+			if( middle_entry_index > number_of_keys )
+			{
+				middle_entry_index = number_of_keys;
+			}
+			upper_entry_index = middle_entry_index + run_size;
+
+			if( upper_entry_index > number_of_keys )
+			{
+				upper_entry_index = number_of_keys;
+			}
+			left_entry_index  = lower_entry_index;
+			right_entry_index = middle_entry_index;
+
+			for( entry_index = lower_entry_index;
+			     entry_index < upper_entry_index;
+			     entry_index++ )
+			{
+				result = LIBFDATA_COMPARE_LESS;
+
+				if( left_entry_index >= middle_entry_index )
+				{
+					result = LIBFDATA_COMPARE_GREATER;
+				}
+				else if( right_entry_index < upper_entry_index )
+				{
+					result = libesedb_key_compare_data(
+					          keys[ source_entries[ left_entry_index ] ],
+					          keys[ source_entries[ right_entry_index ] ],
+					          error );
+
+					if( result == -1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GENERIC,
+						 "%s: unable to compare key: %d.",
+						 function,
+						 source_entries[ left_entry_index ] );
+
+						goto on_error;
+					}
+				}
+				/* Take the left entry unless it is greater to keep the sort stable
+				 */
+				if( result == LIBFDATA_COMPARE_GREATER )
+				{
+					target_entries[ entry_index ] = source_entries[ right_entry_index++ ];
+				}
+				else
+				{
+					target_entries[ entry_index ] = source_entries[ left_entry_index++ ];
+				}
+			}
+		}
+		swap_entries   = source_entries;
+		source_entries = target_entries;
+		target_entries = swap_entries;
+	}
+	if( source_entries != sorted_entries )
+	{
+		if( memory_copy(
+		     sorted_entries,
+		     source_entries,
+		     sizeof( int ) * number_of_keys ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy sorted entries.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 merged_entries );
+
+	return( 1 );
+
+on_error:
+	if( merged_entries != NULL )
+	{
+		memory_free(
+		 merged_entries );
+	}
+	return( -1 );
+}
+
+/* Retrieves the records of a range of index entries
+ * The records are stored in records in index order, the entries of records must be NULL
+ * The primary keys of the index entries are sorted before they are resolved so that
+ * the leaf pages of the table are read in ascending key order, the primary keys
+ * are matched with the table leaf keys like in libesedb_index_get_record
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_get_records(
+     libesedb_index_t *index,
+     int first_record_entry,
+     int number_of_records,
+     libesedb_record_t **records,
+     libcerror_error_t **error )
+{
+	libesedb_data_definition_t *index_data_definition  = NULL;
+	libesedb_data_definition_t *record_data_definition = NULL;
+	libesedb_internal_index_t *internal_index          = NULL;
+	libesedb_key_t **keys                              = NULL;
+	libesedb_key_t *record_key                         = NULL;
+	libesedb_page_tree_cursor_t *page_tree_cursor      = NULL;
+	libesedb_page_tree_t *table_page_tree              = NULL;
+	uint8_t *index_data                                = NULL;
+	uint8_t *is_flexible_key                           = NULL;
+	static char *function                              = "libesedb_index_get_records";
+	size_t index_data_size                             = 0;
+	int *sorted_entries                                = NULL;
+	int entry_index                                    = 0;
+	int number_of_index_records                        = 0;
+	int previous_record_index                          = 0;
+	int record_index                                   = 0;
+	int result                                         = 0;
+	int search_index                                   = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index = (libesedb_internal_index_t *) index;
+
+	if( internal_index->table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index - missing table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_index->table_definition->table_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index - invalid table definition - missing table catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of records value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records.",
+		 function );
+
+		return( -1 );
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		if( records[ record_index ] != NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid record: %d value already set.",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+	}
+	if( libesedb_index_get_number_of_records(
+	     index,
+	     &number_of_index_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( first_record_entry < 0 )
+	 || ( first_record_entry > number_of_index_records )
+	 || ( number_of_records > ( number_of_index_records - first_record_entry ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records == 0 )
+	{
+		return( 1 );
+	}
+	keys = (libesedb_key_t **) memory_allocate(
+	                            sizeof( libesedb_key_t * ) * number_of_records );
+
+	if( keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create keys.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     keys,
+	     0,
+	     sizeof( libesedb_key_t * ) * number_of_records ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear keys.",
+		 function );
+
+		memory_free(
+		 keys );
+
+		return( -1 );
+	}
+	sorted_entries = (int *) memory_allocate(
+	                          sizeof( int ) * number_of_records );
+
+	if( sorted_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sorted entries.",
+		 function );
+
+		goto on_error;
+	}
+	is_flexible_key = (uint8_t *) memory_allocate(
+	                               sizeof( uint8_t ) * number_of_records );
+
+	if( is_flexible_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create is flexible key values.",
+		 function );
+
+		goto on_error;
+	}
+	/* Read the primary keys from the index values
+	 */
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		if( libfdata_btree_get_leaf_value_by_index(
+		     internal_index->index_values_tree,
+		     (intptr_t *) internal_index->file_io_handle,
+		     internal_index->index_values_cache,
+		     first_record_entry + record_index,
+		     (intptr_t **) &index_data_definition,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve leaf value: %d from index values tree.",
+			 function,
+			 first_record_entry + record_index );
+
+			goto on_error;
+		}
+		if( libesedb_data_definition_read_data(
+		     index_data_definition,
+		     internal_index->file_io_handle,
+		     internal_index->io_handle,
+		     internal_index->pages_vector,
+		     internal_index->pages_cache,
+		     &index_data,
+		     &index_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read index data definition data.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_key_initialize(
+		     &( keys[ record_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create key: %d.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		if( libesedb_key_set_data(
+		     keys[ record_index ],
+		     index_data,
+		     index_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set index data in key: %d.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		keys[ record_index ]->type = LIBESEDB_KEY_TYPE_INDEX_VALUE;
+
+		/* libesedb_key_compare matches the second byte of an index value with the upper bit
+		 * set to the same byte of a leaf key without the upper bit, where the leaf key without
+		 * the upper bit sorts first. Hence the keys are sorted and searched without the upper bit
+		 * and the upper bit is restored before the leaf key is compared
+		 */
+		is_flexible_key[ record_index ] = 0;
+
+		if( ( keys[ record_index ]->data_size > 1 )
+		 && ( ( keys[ record_index ]->data[ 1 ] & 0x80 ) != 0 ) )
+		{
+			keys[ record_index ]->data[ 1 ] &= 0x7f;
+
+			is_flexible_key[ record_index ] = 1;
+		}
+	}
+	if( libesedb_index_sort_keys(
+	     keys,
+	     number_of_records,
+	     sorted_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to sort keys.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_page_tree_initialize(
+	     &table_page_tree,
+	     internal_index->io_handle,
+	     internal_index->pages_vector,
+	     internal_index->pages_cache,
+	     internal_index->table_definition->table_catalog_definition->identifier,
+	     internal_index->table_definition,
+	     internal_index->template_table_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create table page tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_page_tree_cursor_initialize(
+	     &page_tree_cursor,
+	     table_page_tree,
+	     internal_index->table_definition->table_catalog_definition->father_data_page_number,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create page tree cursor.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_key_initialize(
+	     &record_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record key.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_data_definition_initialize(
+	     &record_data_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record data definition.",
+		 function );
+
+		goto on_error;
+	}
+	/* Resolve the primary keys in ascending order in a single pass over the leaf pages,
+	 * the record data definition of the previous key is reused if the primary keys are equal
+	 */
+	for( entry_index = 0;
+	     entry_index < number_of_records;
+	     entry_index++ )
+	{
+		record_index = sorted_entries[ entry_index ];
+
+		result = LIBFDATA_COMPARE_LESS;
+
+		if( ( entry_index > 0 )
+		 && ( is_flexible_key[ record_index ] == is_flexible_key[ previous_record_index ] ) )
+		{
+			result = libesedb_key_compare_data(
+			          keys[ previous_record_index ],
+			          keys[ record_index ],
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare key: %d.",
+				 function,
+				 record_index );
+
+				goto on_error;
+			}
+		}
+		previous_record_index = record_index;
+
+		if( result == LIBFDATA_COMPARE_EQUAL )
+		{
+			result = 1;
+		}
+		else
+		{
+			/* The key without the upper bit is searched first
+			 */
+			for( search_index = 0;
+			     search_index <= (int) is_flexible_key[ record_index ];
+			     search_index++ )
+			{
+				if( search_index > 0 )
+				{
+					keys[ record_index ]->data[ 1 ] |= 0x80;
+				}
+				result = libesedb_page_tree_cursor_seek_forward(
+				          page_tree_cursor,
+				          internal_index->file_io_handle,
+				          keys[ record_index ],
+				          error );
+
+				if( result == 1 )
+				{
+					result = libesedb_page_tree_cursor_get_next_value(
+					          page_tree_cursor,
+					          internal_index->file_io_handle,
+					          record_key,
+					          record_data_definition,
+					          error );
+				}
+				if( is_flexible_key[ record_index ] != 0 )
+				{
+					keys[ record_index ]->data[ 1 ] |= 0x80;
+				}
+				if( result == 1 )
+				{
+					result = libesedb_key_compare(
+					          keys[ record_index ],
+					          record_key,
+					          error );
+
+					if( result == LIBFDATA_COMPARE_EQUAL )
+					{
+						result = 1;
+					}
+					else if( result != -1 )
+					{
+						result = 0;
+					}
+				}
+				if( is_flexible_key[ record_index ] != 0 )
+				{
+					keys[ record_index ]->data[ 1 ] &= 0x7f;
+				}
+				if( result != 0 )
+				{
+					break;
+				}
+			}
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve record value of key: %d from table page tree.",
+				 function,
+				 record_index );
+
+				goto on_error;
+			}
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing record for index entry: %d.",
+			 function,
+			 first_record_entry + record_index );
+
+			goto on_error;
+		}
+		if( libesedb_record_initialize(
+		     &( records[ record_index ] ),
+		     internal_index->file_io_handle,
+		     internal_index->io_handle,
+		     internal_index->table_definition,
+		     internal_index->template_table_definition,
+		     internal_index->column_projection,
+		     internal_index->pages_vector,
+		     internal_index->pages_cache,
+		     internal_index->long_values_pages_vector,
+		     internal_index->long_values_pages_cache,
+		     record_data_definition,
+		     internal_index->long_values_tree,
+		     internal_index->long_values_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create record: %d.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+	}
+	if( libesedb_data_definition_free(
+	     &record_data_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free record data definition.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_key_free(
+	     &record_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free record key.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_page_tree_cursor_free(
+	     &page_tree_cursor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free page tree cursor.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_page_tree_free(
+	     &table_page_tree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free table page tree.",
+		 function );
+
+		goto on_error;
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		if( libesedb_key_free(
+		     &( keys[ record_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free key: %d.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 is_flexible_key );
+
+	memory_free(
+	 sorted_entries );
+
+	memory_free(
+	 keys );
+
+	return( 1 );
+
+on_error:
+	if( record_data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &record_data_definition,
+		 NULL );
+	}
+	if( record_key != NULL )
+	{
+		libesedb_key_free(
+		 &record_key,
+		 NULL );
+	}
+	if( page_tree_cursor != NULL )
+	{
+		libesedb_page_tree_cursor_free(
+		 &page_tree_cursor,
+		 NULL );
+	}
+	if( table_page_tree != NULL )
+	{
+		libesedb_page_tree_free(
+		 &table_page_tree,
+		 NULL );
+	}
+	if( is_flexible_key != NULL )
+	{
+		memory_free(
+		 is_flexible_key );
+	}
+	if( sorted_entries != NULL )
+	{
+		memory_free(
+		 sorted_entries );
+	}
+	if( keys != NULL )
+	{
+		for( record_index = 0;
+		     record_index < number_of_records;
+		     record_index++ )
+		{
+			if( keys[ record_index ] != NULL )
+			{
+				libesedb_key_free(
+				 &( keys[ record_index ] ),
+				 NULL );
+			}
+		}
+		memory_free(
+		 keys );
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		if( records[ record_index ] != NULL )
+		{
+			libesedb_record_free(
+			 &( records[ record_index ] ),
+			 NULL );
+		}
+	}
+	return( -1 );
+}
+
+/* Retrieves the record of the first index value with a specific key
+ * The key contains the normalized key data as stored in the index
+ * The index page tree is descended using a binary search over the page values of every page
+ * Returns 1 if successful, 0 if no such record or -1 on error
+ */
+int libesedb_index_get_record_by_key(
+     libesedb_index_t *index,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     libesedb_record_t **record,
+     libcerror_error_t **error )
+{
+	libesedb_data_definition_t *index_data_definition = NULL;
+	libesedb_internal_index_t *internal_index         = NULL;
+	libesedb_key_t *index_value_key                   = NULL;
+	libesedb_key_t *key                               = NULL;
+	libesedb_page_tree_cursor_t *page_tree_cursor     = NULL;
+	static char *function                             = "libesedb_index_get_record_by_key";
+	int result                                        = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index = (libesedb_internal_index_t *) index;
+
+	if( internal_index->index_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index - missing index catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_key_initialize(
+	     &key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create key.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_key_set_data(
+	     key,
+	     key_data,
+	     key_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set key data.",
+		 function );
+
+		goto on_error;
+	}
+	key->type = LIBESEDB_KEY_TYPE_INDEX_VALUE;
+
+	if( libesedb_page_tree_cursor_initialize(
+	     &page_tree_cursor,
+	     internal_index->index_page_tree,
+	     internal_index->index_catalog_definition->father_data_page_number,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create page tree cursor.",
+		 function );
+
+		goto on_error;
+	}
+	result = libesedb_page_tree_cursor_seek(
+	          page_tree_cursor,
+	          internal_index->file_io_handle,
+	          key,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to seek key in index page tree.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( libesedb_key_initialize(
+		     &index_value_key,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create index value key.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_data_definition_initialize(
+		     &index_data_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create index data definition.",
+			 function );
+
+			goto on_error;
+		}
+		result = libesedb_page_tree_cursor_get_next_value(
+		          page_tree_cursor,
+		          internal_index->file_io_handle,
+		          index_value_key,
+		          index_data_definition,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve index value from page tree cursor.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( result != 0 )
+	{
+		result = libesedb_key_compare_data(
+		          index_value_key,
+		          key,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare index value key.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == LIBFDATA_COMPARE_EQUAL )
+		{
+			if( libesedb_index_get_record_by_data_definition(
+			     internal_index,
+			     index_data_definition,
+			     record,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve record.",
+				 function );
+
+				goto on_error;
+			}
+			result = 1;
+		}
+		else
+		{
+			result = 0;
+		}
+	}
+	if( index_data_definition != NULL )
+	{
+		if( libesedb_data_definition_free(
+		     &index_data_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free index data definition.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( index_value_key != NULL )
+	{
+		if( libesedb_key_free(
+		     &index_value_key,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free index value key.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libesedb_page_tree_cursor_free(
+	     &page_tree_cursor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free page tree cursor.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_key_free(
+	     &key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free key.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( *record != NULL )
+	{
+		libesedb_record_free(
+		 record,
+		 NULL );
+	}
+	if( index_data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &index_data_definition,
+		 NULL );
+	}
+	if( index_value_key != NULL )
+	{
+		libesedb_key_free(
+		 &index_value_key,
+		 NULL );
+	}
+	if( page_tree_cursor != NULL )
+	{
+		libesedb_page_tree_cursor_free(
+		 &page_tree_cursor,
+		 NULL );
+	}
+	if( key != NULL )
+	{
+		libesedb_key_free(
+		 &key,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves a cursor to read the records of the index over a range of keys
+ * The keys consist of the normalized key data as stored in the index
+ * The cursor starts at the first index value with a key that is greater than or equal to the lower bound key
+ * and stops before the first index value with a key that is greater than or equal to the upper bound key
+ * A lower_bound_key_data of NULL starts the cursor at the first index value
+ * and an upper_bound_key_data of NULL reads up to and including the last index value
+ * The cursor must be freed before the index
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_get_range_cursor(
+     libesedb_index_t *index,
+     const uint8_t *lower_bound_key_data,
+     size_t lower_bound_key_data_size,
+     const uint8_t *upper_bound_key_data,
+     size_t upper_bound_key_data_size,
+     libesedb_index_cursor_t **index_cursor,
+     libcerror_error_t **error )
+{
+	libesedb_internal_index_t *internal_index = NULL;
+	static char *function                     = "libesedb_index_get_range_cursor";
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index = (libesedb_internal_index_t *) index;
+
+	if( libesedb_index_cursor_initialize(
+	     index_cursor,
+	     internal_index,
+	     lower_bound_key_data,
+	     lower_bound_key_data_size,
+	     upper_bound_key_data,
+	     upper_bound_key_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index cursor.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
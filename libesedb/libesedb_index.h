@@ -26,12 +26,16 @@
 #include <types.h>
 
 #include "libesedb_catalog_definition.h"
+#include "libesedb_column_projection.h"
+#include "libesedb_data_definition.h"
 #include "libesedb_extern.h"
 #include "libesedb_io_handle.h"
+#include "libesedb_key.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
+#include "libesedb_page_tree.h"
 #include "libesedb_table_definition.h"
 #include "libesedb_types.h"
 
@@ -59,6 +63,10 @@ struct libesedb_internal_index
 	 */
 	libesedb_table_definition_t *template_table_definition;
 
+	/* The column projection
+	 */
+	libesedb_column_projection_t *column_projection;
+
 	/* The index catalog definition
 	 */
 	libesedb_catalog_definition_t *index_catalog_definition;
@@ -95,6 +103,10 @@ struct libesedb_internal_index
 	 */
 	libfcache_cache_t *long_values_cache;
 
+	/* The index page tree, managed by the index values tree
+	 */
+	libesedb_page_tree_t *index_page_tree;
+
 	/* The table values (data) tree
 	 */
 	libfdata_btree_t *index_values_tree;
@@ -102,6 +114,18 @@ struct libesedb_internal_index
 	/* The index values cache
 	 */
 	libfcache_cache_t *index_values_cache;
+
+	/* The key column identifiers
+	 */
+	uint32_t *key_column_identifiers;
+
+	/* The key column types
+	 */
+	uint32_t *key_column_types;
+
+	/* The number of key columns
+	 */
+	int number_of_key_columns;
 };
 
 int libesedb_index_initialize(
@@ -126,6 +150,10 @@ int libesedb_index_free(
      libesedb_index_t **index,
      libcerror_error_t **error );
 
+int libesedb_index_read_key_columns(
+     libesedb_internal_index_t *internal_index,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_index_get_identifier(
      libesedb_index_t *index,
@@ -164,6 +192,32 @@ int libesedb_index_get_number_of_records(
      int *number_of_records,
      libcerror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_index_get_number_of_key_columns(
+     libesedb_index_t *index,
+     int *number_of_key_columns,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_get_key_column_identifier(
+     libesedb_index_t *index,
+     int key_column_index,
+     uint32_t *column_identifier,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_set_column_projection(
+     libesedb_index_t *index,
+     const uint32_t *column_identifiers,
+     int number_of_column_identifiers,
+     libcerror_error_t **error );
+
+int libesedb_index_get_record_by_data_definition(
+     libesedb_internal_index_t *internal_index,
+     libesedb_data_definition_t *index_data_definition,
+     libesedb_record_t **record,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_index_get_record(
      libesedb_index_t *index,
@@ -171,6 +225,38 @@ int libesedb_index_get_record(
      libesedb_record_t **record,
      libcerror_error_t **error );
 
+int libesedb_index_sort_keys(
+     libesedb_key_t **keys,
+     int number_of_keys,
+     int *sorted_entries,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_get_records(
+     libesedb_index_t *index,
+     int first_record_entry,
+     int number_of_records,
+     libesedb_record_t **records,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_get_record_by_key(
+     libesedb_index_t *index,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     libesedb_record_t **record,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_get_range_cursor(
+     libesedb_index_t *index,
+     const uint8_t *lower_bound_key_data,
+     size_t lower_bound_key_data_size,
+     const uint8_t *upper_bound_key_data,
+     size_t upper_bound_key_data_size,
+     libesedb_index_cursor_t **index_cursor,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
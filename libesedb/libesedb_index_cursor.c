@@ -0,0 +1,865 @@
+/*
+ * Index cursor functions
+ *
+ * Copyright (C) 2009-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libesedb_data_definition.h"
+#include "libesedb_definitions.h"
+#include "libesedb_index.h"
+#include "libesedb_index_cursor.h"
+#include "libesedb_key.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_libfdata.h"
+#include "libesedb_page_tree_cursor.h"
+#include "libesedb_types.h"
+
+/* Creates an index cursor
+ * Make sure the value index_cursor is referencing, is set to NULL
+ * The cursor is positioned before the first index value with a key that is greater than
+ * or equal to the lower bound key or before the first index value if lower_bound_key_data is NULL
+ * Index values with a key that is greater than or equal to the upper bound key are not returned
+ * if upper_bound_key_data is not NULL
+ * The index is referenced by the cursor and must remain valid while the cursor is used
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_cursor_initialize(
+     libesedb_index_cursor_t **index_cursor,
+     libesedb_internal_index_t *internal_index,
+     const uint8_t *lower_bound_key_data,
+     size_t lower_bound_key_data_size,
+     const uint8_t *upper_bound_key_data,
+     size_t upper_bound_key_data_size,
+     libcerror_error_t **error )
+{
+	libesedb_internal_index_cursor_t *internal_index_cursor = NULL;
+	libesedb_key_t *lower_bound_key                         = NULL;
+	static char *function                                   = "libesedb_index_cursor_initialize";
+
+	if( index_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index_cursor != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid index cursor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_index->index_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index - missing index catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( lower_bound_key_data != NULL )
+	 && ( lower_bound_key_data_size == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid lower bound key data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( upper_bound_key_data != NULL )
+	 && ( upper_bound_key_data_size == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid upper bound key data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index_cursor = memory_allocate_structure(
+	                         libesedb_internal_index_cursor_t );
+
+	if( internal_index_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create index cursor.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_index_cursor,
+	     0,
+	     sizeof( libesedb_internal_index_cursor_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear index cursor.",
+		 function );
+
+		memory_free(
+		 internal_index_cursor );
+
+		return( -1 );
+	}
+	if( libesedb_page_tree_cursor_initialize(
+	     &( internal_index_cursor->page_tree_cursor ),
+	     internal_index->index_page_tree,
+	     internal_index->index_catalog_definition->father_data_page_number,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create page tree cursor.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_key_initialize(
+	     &( internal_index_cursor->key ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create key.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_data_definition_initialize(
+	     &( internal_index_cursor->data_definition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data definition.",
+		 function );
+
+		goto on_error;
+	}
+	if( upper_bound_key_data != NULL )
+	{
+		if( libesedb_key_initialize(
+		     &( internal_index_cursor->upper_bound_key ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create upper bound key.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_key_set_data(
+		     internal_index_cursor->upper_bound_key,
+		     upper_bound_key_data,
+		     upper_bound_key_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set upper bound key data.",
+			 function );
+
+			goto on_error;
+		}
+		internal_index_cursor->upper_bound_key->type = LIBESEDB_KEY_TYPE_INDEX_VALUE;
+	}
+	if( lower_bound_key_data != NULL )
+	{
+		if( libesedb_key_initialize(
+		     &lower_bound_key,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create lower bound key.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_key_set_data(
+		     lower_bound_key,
+		     lower_bound_key_data,
+		     lower_bound_key_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set lower bound key data.",
+			 function );
+
+			goto on_error;
+		}
+		lower_bound_key->type = LIBESEDB_KEY_TYPE_INDEX_VALUE;
+
+		/* An empty index page tree leaves the cursor unpositioned
+		 * in which case no index values are returned
+		 */
+		if( libesedb_page_tree_cursor_seek(
+		     internal_index_cursor->page_tree_cursor,
+		     internal_index->file_io_handle,
+		     lower_bound_key,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to seek lower bound key in index page tree.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_key_free(
+		     &lower_bound_key,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free lower bound key.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_index_cursor->internal_index = internal_index;
+
+	*index_cursor = (libesedb_index_cursor_t *) internal_index_cursor;
+
+	return( 1 );
+
+on_error:
+	if( lower_bound_key != NULL )
+	{
+		libesedb_key_free(
+		 &lower_bound_key,
+		 NULL );
+	}
+	if( internal_index_cursor != NULL )
+	{
+		if( internal_index_cursor->upper_bound_key != NULL )
+		{
+			libesedb_key_free(
+			 &( internal_index_cursor->upper_bound_key ),
+			 NULL );
+		}
+		if( internal_index_cursor->data_definition != NULL )
+		{
+			libesedb_data_definition_free(
+			 &( internal_index_cursor->data_definition ),
+			 NULL );
+		}
+		if( internal_index_cursor->key != NULL )
+		{
+			libesedb_key_free(
+			 &( internal_index_cursor->key ),
+			 NULL );
+		}
+		if( internal_index_cursor->page_tree_cursor != NULL )
+		{
+			libesedb_page_tree_cursor_free(
+			 &( internal_index_cursor->page_tree_cursor ),
+			 NULL );
+		}
+		memory_free(
+		 internal_index_cursor );
+	}
+	return( -1 );
+}
+
+/* Frees an index cursor
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_cursor_free(
+     libesedb_index_cursor_t **index_cursor,
+     libcerror_error_t **error )
+{
+	libesedb_internal_index_cursor_t *internal_index_cursor = NULL;
+	static char *function                                   = "libesedb_index_cursor_free";
+	int result                                              = 1;
+
+	if( index_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index_cursor != NULL )
+	{
+		internal_index_cursor = (libesedb_internal_index_cursor_t *) *index_cursor;
+		*index_cursor         = NULL;
+
+		/* The internal_index reference is freed elsewhere
+		 */
+		if( internal_index_cursor->upper_bound_key != NULL )
+		{
+			if( libesedb_key_free(
+			     &( internal_index_cursor->upper_bound_key ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free upper bound key.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libesedb_data_definition_free(
+		     &( internal_index_cursor->data_definition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free data definition.",
+			 function );
+
+			result = -1;
+		}
+		if( libesedb_key_free(
+		     &( internal_index_cursor->key ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free key.",
+			 function );
+
+			result = -1;
+		}
+		if( libesedb_page_tree_cursor_free(
+		     &( internal_index_cursor->page_tree_cursor ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free page tree cursor.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_index_cursor );
+	}
+	return( result );
+}
+
+/* Reads the next index value
+ * Returns 1 if successful, 0 if no such index value or -1 on error
+ */
+int libesedb_index_cursor_read_next_entry(
+     libesedb_internal_index_cursor_t *internal_index_cursor,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_index_cursor_read_next_entry";
+	int result            = 0;
+
+	if( internal_index_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_index_cursor->internal_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index cursor - missing index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index_cursor->has_entry = 0;
+
+	if( internal_index_cursor->upper_bound_reached != 0 )
+	{
+		return( 0 );
+	}
+	result = libesedb_page_tree_cursor_get_next_value(
+	          internal_index_cursor->page_tree_cursor,
+	          internal_index_cursor->internal_index->file_io_handle,
+	          internal_index_cursor->key,
+	          internal_index_cursor->data_definition,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve index value from page tree cursor.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( internal_index_cursor->upper_bound_key != NULL )
+	{
+		result = libesedb_key_compare_data(
+		          internal_index_cursor->key,
+		          internal_index_cursor->upper_bound_key,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare index value key with upper bound key.",
+			 function );
+
+			return( -1 );
+		}
+		/* The index values are stored in key order hence the scan stops
+		 * at the first index value that is not less than the upper bound
+		 */
+		else if( result != LIBFDATA_COMPARE_LESS )
+		{
+			internal_index_cursor->upper_bound_reached = 1;
+
+			return( 0 );
+		}
+	}
+	internal_index_cursor->has_entry = 1;
+
+	return( 1 );
+}
+
+/* Retrieves the next index entry
+ * Only the index is read, use libesedb_index_cursor_get_key_data or
+ * libesedb_index_cursor_get_key_column_value_data to retrieve the key of the entry
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libesedb_index_cursor_get_next_entry(
+     libesedb_index_cursor_t *index_cursor,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_index_cursor_get_next_entry";
+	int result            = 0;
+
+	result = libesedb_index_cursor_read_next_entry(
+	          (libesedb_internal_index_cursor_t *) index_cursor,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read next entry.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the size of the key data of the current index entry
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_cursor_get_key_data_size(
+     libesedb_index_cursor_t *index_cursor,
+     size_t *key_data_size,
+     libcerror_error_t **error )
+{
+	libesedb_internal_index_cursor_t *internal_index_cursor = NULL;
+	static char *function                                   = "libesedb_index_cursor_get_key_data_size";
+
+	if( index_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index_cursor = (libesedb_internal_index_cursor_t *) index_cursor;
+
+	if( internal_index_cursor->has_entry == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index cursor - missing current entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key data size.",
+		 function );
+
+		return( -1 );
+	}
+	*key_data_size = internal_index_cursor->key->data_size;
+
+	return( 1 );
+}
+
+/* Retrieves the key data of the current index entry
+ * The key data contains the normalized key as stored in the index
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_cursor_get_key_data(
+     libesedb_index_cursor_t *index_cursor,
+     uint8_t *key_data,
+     size_t key_data_size,
+     libcerror_error_t **error )
+{
+	libesedb_internal_index_cursor_t *internal_index_cursor = NULL;
+	static char *function                                   = "libesedb_index_cursor_get_key_data";
+
+	if( index_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index_cursor = (libesedb_internal_index_cursor_t *) index_cursor;
+
+	if( internal_index_cursor->has_entry == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index cursor - missing current entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key data.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid key data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_data_size < internal_index_cursor->key->data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid key data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_index_cursor->key->data_size > 0 )
+	{
+		if( memory_copy(
+		     key_data,
+		     internal_index_cursor->key->data,
+		     internal_index_cursor->key->data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy key data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the value data of a specific key column of the current index entry
+ * The value is decoded from the normalized key, which is only possible for
+ * fixed size column types when the preceding key columns are fixed size or NULL
+ * The value data is stored in the same byte order as the record value data
+ * Returns 1 if successful, 0 if the value is not available or -1 on error
+ */
+int libesedb_index_cursor_get_key_column_value_data(
+     libesedb_index_cursor_t *index_cursor,
+     int key_column_index,
+     uint8_t *value_data,
+     size_t value_data_size,
+     libcerror_error_t **error )
+{
+	libesedb_internal_index_cursor_t *internal_index_cursor = NULL;
+	static char *function                                   = "libesedb_index_cursor_get_key_column_value_data";
+	int result                                              = 0;
+
+	if( index_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index_cursor = (libesedb_internal_index_cursor_t *) index_cursor;
+
+	if( internal_index_cursor->internal_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index cursor - missing index.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_index_cursor->has_entry == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index cursor - missing current entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key_column_index < 0 )
+	 || ( key_column_index >= internal_index_cursor->internal_index->number_of_key_columns ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid key column index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_key_get_segment_value_data(
+	          internal_index_cursor->key,
+	          internal_index_cursor->internal_index->key_column_types,
+	          internal_index_cursor->internal_index->number_of_key_columns,
+	          key_column_index,
+	          value_data,
+	          value_data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value data of key column: %d.",
+		 function,
+		 key_column_index );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the next record
+ * The index values are read following the sibling links of the index leaf pages
+ * Returns 1 if successful, 0 if no such record or -1 on error
+ */
+int libesedb_index_cursor_get_next_record(
+     libesedb_index_cursor_t *index_cursor,
+     libesedb_record_t **record,
+     libcerror_error_t **error )
+{
+	libesedb_internal_index_cursor_t *internal_index_cursor = NULL;
+	static char *function                                   = "libesedb_index_cursor_get_next_record";
+	int result                                              = 0;
+
+	if( index_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index_cursor = (libesedb_internal_index_cursor_t *) index_cursor;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record value already set.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_index_cursor_read_next_entry(
+	          internal_index_cursor,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read next entry.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libesedb_index_get_record_by_data_definition(
+	     internal_index_cursor->internal_index,
+	     internal_index_cursor->data_definition,
+	     record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,128 @@
+/*
+ * Index cursor functions
+ *
+ * Copyright (C) 2009-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_INDEX_CURSOR_H )
+#define _LIBESEDB_INDEX_CURSOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_data_definition.h"
+#include "libesedb_extern.h"
+#include "libesedb_index.h"
+#include "libesedb_key.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_page_tree_cursor.h"
+#include "libesedb_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libesedb_internal_index_cursor libesedb_internal_index_cursor_t;
+
+struct libesedb_internal_index_cursor
+{
+	/* The index
+	 */
+	libesedb_internal_index_t *internal_index;
+
+	/* The page tree cursor
+	 */
+	libesedb_page_tree_cursor_t *page_tree_cursor;
+
+	/* The index value key
+	 */
+	libesedb_key_t *key;
+
+	/* The index value data definition
+	 */
+	libesedb_data_definition_t *data_definition;
+
+	/* The (exclusive) upper bound key, NULL if not set
+	 */
+	libesedb_key_t *upper_bound_key;
+
+	/* Value to indicate the upper bound was reached
+	 */
+	uint8_t upper_bound_reached;
+
+	/* Value to indicate the cursor is positioned on an index entry
+	 */
+	uint8_t has_entry;
+};
+
+int libesedb_index_cursor_initialize(
+     libesedb_index_cursor_t **index_cursor,
+     libesedb_internal_index_t *internal_index,
+     const uint8_t *lower_bound_key_data,
+     size_t lower_bound_key_data_size,
+     const uint8_t *upper_bound_key_data,
+     size_t upper_bound_key_data_size,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_cursor_free(
+     libesedb_index_cursor_t **index_cursor,
+     libcerror_error_t **error );
+
+int libesedb_index_cursor_read_next_entry(
+     libesedb_internal_index_cursor_t *internal_index_cursor,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_cursor_get_next_entry(
+     libesedb_index_cursor_t *index_cursor,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_cursor_get_key_data_size(
+     libesedb_index_cursor_t *index_cursor,
+     size_t *key_data_size,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_cursor_get_key_data(
+     libesedb_index_cursor_t *index_cursor,
+     uint8_t *key_data,
+     size_t key_data_size,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_cursor_get_key_column_value_data(
+     libesedb_index_cursor_t *index_cursor,
+     int key_column_index,
+     uint8_t *value_data,
+     size_t value_data_size,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_cursor_get_next_record(
+     libesedb_index_cursor_t *index_cursor,
+     libesedb_record_t **record,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_INDEX_CURSOR_H ) */
+
@@ -24,17 +24,41 @@
 #include <memory.h>
 #include <types.h>
 
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_SYS_MMAN_H )
+#include <sys/mman.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
 #include "libesedb_checksum.h"
 #include "libesedb_codepage.h"
+#include "libesedb_data_definition.h"
 #include "libesedb_debug.h"
 #include "libesedb_definitions.h"
+#include "libesedb_hot_pages.h"
 #include "libesedb_io_handle.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libcnotify.h"
+#include "libesedb_libcthreads.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
 #include "libesedb_page.h"
+#include "libesedb_page_pool.h"
 #include "libesedb_unused.h"
 
 #include "esedb_file_header.h"
@@ -101,7 +125,23 @@ int libesedb_io_handle_initialize(
 
 		goto on_error;
 	}
-	( *io_handle )->ascii_codepage = LIBESEDB_CODEPAGE_WINDOWS_1252;
+	if( libesedb_page_pool_initialize(
+	     &( ( *io_handle )->page_pool ),
+	     LIBESEDB_MAXIMUM_NUMBER_OF_FREE_PAGES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create page pool.",
+		 function );
+
+		goto on_error;
+	}
+	( *io_handle )->read_ahead_file_descriptor = -1;
+	( *io_handle )->checksum_policy            = LIBESEDB_CHECKSUM_POLICY_VERIFY_ON_READ;
+	( *io_handle )->ascii_codepage             = LIBESEDB_CODEPAGE_WINDOWS_1252;
 
 	return( 1 );
 
@@ -139,6 +179,96 @@ int libesedb_io_handle_free(
 	}
 	if( *io_handle != NULL )
 	{
+		if( libesedb_io_handle_join_checksum_verification(
+		     *io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join checksum verification.",
+			 function );
+
+			result = -1;
+		}
+		if( libesedb_io_handle_unmap_file(
+		     *io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to unmap file.",
+			 function );
+
+			result = -1;
+		}
+		if( libesedb_io_handle_close_read_ahead(
+		     *io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to close read-ahead file descriptor.",
+			 function );
+
+			result = -1;
+		}
+		if( libesedb_page_pool_free(
+		     &( ( *io_handle )->page_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free page pool.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *io_handle )->hot_pages != NULL )
+		{
+			if( libesedb_hot_pages_free(
+			     &( ( *io_handle )->hot_pages ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free hot pages.",
+				 function );
+
+				result = -1;
+			}
+		}
+		/* The tree values caches themselves are freed by their owners
+		 */
+		if( ( *io_handle )->tree_values_caches != NULL )
+		{
+			memory_free(
+			 ( *io_handle )->tree_values_caches );
+		}
+		if( ( *io_handle )->verified_pages_bitmap != NULL )
+		{
+			memory_free(
+			 ( *io_handle )->verified_pages_bitmap );
+		}
+		if( ( *io_handle )->mismatched_pages_bitmap != NULL )
+		{
+			memory_free(
+			 ( *io_handle )->mismatched_pages_bitmap );
+		}
+		if( ( *io_handle )->pages_read_buffer != NULL )
+		{
+			memory_free(
+			 ( *io_handle )->pages_read_buffer );
+		}
 		memory_free(
 		 *io_handle );
 
@@ -154,7 +284,15 @@ int libesedb_io_handle_clear(
      libesedb_io_handle_t *io_handle,
      libcerror_error_t **error )
 {
-	static char *function = "libesedb_io_handle_clear";
+	libesedb_page_pool_t *page_pool       = NULL;
+	static char *function                 = "libesedb_io_handle_clear";
+	void *checksum_mismatch_callback_data = NULL;
+	size64_t memory_budget                = 0;
+	int checksum_policy                   = 0;
+
+	void (*checksum_mismatch_callback)(
+	       uint32_t page_number,
+	       void *callback_data ) = NULL;
 
 	if( io_handle == NULL )
 	{
@@ -167,6 +305,112 @@ int libesedb_io_handle_clear(
 
 		return( -1 );
 	}
+	if( libesedb_io_handle_join_checksum_verification(
+	     io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join checksum verification.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_io_handle_unmap_file(
+	     io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to unmap file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_io_handle_close_read_ahead(
+	     io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to close read-ahead file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	/* The pages that are still in use are released to the page pool
+	 * after the IO handle has been cleared, hence the page pool is retained
+	 */
+	if( io_handle->page_pool != NULL )
+	{
+		if( libesedb_page_pool_empty(
+		     io_handle->page_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty page pool.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( io_handle->hot_pages != NULL )
+	{
+		if( libesedb_hot_pages_free(
+		     &( io_handle->hot_pages ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free hot pages.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* The tree values caches themselves are freed by their owners
+	 */
+	if( io_handle->tree_values_caches != NULL )
+	{
+		memory_free(
+		 io_handle->tree_values_caches );
+	}
+	if( io_handle->verified_pages_bitmap != NULL )
+	{
+		memory_free(
+		 io_handle->verified_pages_bitmap );
+	}
+	if( io_handle->mismatched_pages_bitmap != NULL )
+	{
+		memory_free(
+		 io_handle->mismatched_pages_bitmap );
+	}
+	if( io_handle->pages_read_buffer != NULL )
+	{
+		memory_free(
+		 io_handle->pages_read_buffer );
+	}
+	page_pool = io_handle->page_pool;
+
+	/* The memory budget, checksum policy and checksum mismatch callback
+	 * are settings that are retained
+	 */
+	memory_budget                   = io_handle->memory_budget;
+	checksum_policy                 = io_handle->checksum_policy;
+	checksum_mismatch_callback      = io_handle->checksum_mismatch_callback;
+	checksum_mismatch_callback_data = io_handle->checksum_mismatch_callback_data;
+
 	if( memory_set(
 	     io_handle,
 	     0,
@@ -181,20 +425,30 @@ int libesedb_io_handle_clear(
 
 		return( -1 );
 	}
-	io_handle->ascii_codepage = LIBESEDB_CODEPAGE_WINDOWS_1252;
+	io_handle->memory_budget                   = memory_budget;
+	io_handle->checksum_policy                 = checksum_policy;
+	io_handle->checksum_mismatch_callback      = checksum_mismatch_callback;
+	io_handle->checksum_mismatch_callback_data = checksum_mismatch_callback_data;
+	io_handle->page_pool                       = page_pool;
+	io_handle->read_ahead_file_descriptor      = -1;
+	io_handle->ascii_codepage                  = LIBESEDB_CODEPAGE_WINDOWS_1252;
 
 	return( 1 );
 }
 
-/* Sets the pages data range
- * Returns 1 if successful or -1 on error
+/* Determines if the checksum of a specific page has been verified
+ * The checksum is considered verified if the checksum policy does not require
+ * the checksum to be calculated when the page is read, a page of which the
+ * checksum is queued to be verified in the background is considered verified
+ * Returns 1 if verified, 0 if not or -1 on error
  */
-int libesedb_io_handle_set_pages_data_range(
+int libesedb_io_handle_get_page_checksum_verified(
      libesedb_io_handle_t *io_handle,
-     size64_t file_size,
+     uint32_t page_number,
      libcerror_error_t **error )
 {
-	static char *function = "libesedb_io_handle_set_pages_data_range";
+	static char *function = "libesedb_io_handle_get_page_checksum_verified";
+	size_t bitmap_index   = 0;
 
 	if( io_handle == NULL )
 	{
@@ -207,48 +461,41 @@ int libesedb_io_handle_set_pages_data_range(
 
 		return( -1 );
 	}
-	if( io_handle->page_size == 0 )
+	if( io_handle->checksum_policy == LIBESEDB_CHECKSUM_POLICY_DISABLED )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid IO handle - missing page size.",
-		 function );
-
-		return( -1 );
+		return( 1 );
 	}
-	io_handle->pages_data_offset = (off64_t) ( io_handle->page_size * 2 );
-	io_handle->pages_data_size   = file_size - (size64_t) io_handle->pages_data_offset;
-	io_handle->last_page_number  = (uint32_t) ( io_handle->pages_data_size / io_handle->page_size );
+	if( ( io_handle->checksum_policy != LIBESEDB_CHECKSUM_POLICY_VERIFY_ON_FIRST_READ )
+	 && ( io_handle->checksum_policy != LIBESEDB_CHECKSUM_POLICY_VERIFY_IN_BACKGROUND ) )
+	{
+		return( 0 );
+	}
+	bitmap_index = (size_t) ( page_number / 8 );
 
+	if( ( io_handle->verified_pages_bitmap == NULL )
+	 || ( bitmap_index >= io_handle->verified_pages_bitmap_size ) )
+	{
+		return( 0 );
+	}
+	if( ( io_handle->verified_pages_bitmap[ bitmap_index ] & ( 1 << ( page_number % 8 ) ) ) == 0 )
+	{
+		return( 0 );
+	}
 	return( 1 );
 }
 
-/* Reads the file (or database) header
+/* Marks the checksum of a specific page as verified
+ * This is only tracked if the checksum policy is to verify on first read
+ * or in the background
  * Returns 1 if successful or -1 on error
  */
-int libesedb_io_handle_read_file_header(
+int libesedb_io_handle_set_page_checksum_verified(
      libesedb_io_handle_t *io_handle,
-     libbfio_handle_t *file_io_handle,
-     off64_t file_offset,
+     uint32_t page_number,
      libcerror_error_t **error )
 {
-	uint8_t *file_header_data          = NULL;
-	static char *function              = "libesedb_io_handle_read_file_header";
-	size_t read_size                   = 2048;
-	ssize_t read_count                 = 0;
-	uint32_t calculated_xor32_checksum = 0;
-	uint32_t creation_format_revision  = 0;
-	uint32_t creation_format_version   = 0;
-	uint32_t format_revision           = 0;
-	uint32_t format_version            = 0;
-	uint32_t page_size                 = 0;
-	uint32_t stored_xor32_checksum     = 0;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	uint32_t value_32bit               = 0;
-#endif
+	static char *function = "libesedb_io_handle_set_page_checksum_verified";
+	size_t bitmap_index   = 0;
 
 	if( io_handle == NULL )
 	{
@@ -261,733 +508,3557 @@ int libesedb_io_handle_read_file_header(
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( ( io_handle->checksum_policy != LIBESEDB_CHECKSUM_POLICY_VERIFY_ON_FIRST_READ )
+	 && ( io_handle->checksum_policy != LIBESEDB_CHECKSUM_POLICY_VERIFY_IN_BACKGROUND ) )
 	{
-		libcnotify_printf(
-		 "%s: reading file header at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
-		 function,
-		 file_offset,
-		 file_offset );
+		return( 1 );
 	}
-#endif
-	if( libbfio_handle_seek_offset(
-	     file_io_handle,
-	     file_offset,
-	     SEEK_SET,
-	     error ) == -1 )
+	/* Pages beyond the last page number are not tracked
+	 */
+	if( page_number > io_handle->last_page_number )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek file header offset: %" PRIi64 ".",
-		 function,
-		 file_offset );
+		return( 1 );
+	}
+	if( io_handle->verified_pages_bitmap == NULL )
+	{
+		io_handle->verified_pages_bitmap_size = (size_t) ( io_handle->last_page_number / 8 ) + 1;
 
-		goto on_error;
+		io_handle->verified_pages_bitmap = (uint8_t *) memory_allocate(
+		                                                sizeof( uint8_t ) * io_handle->verified_pages_bitmap_size );
+
+		if( io_handle->verified_pages_bitmap == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create verified pages bitmap.",
+			 function );
+
+			io_handle->verified_pages_bitmap_size = 0;
+
+			return( -1 );
+		}
+		if( memory_set(
+		     io_handle->verified_pages_bitmap,
+		     0,
+		     sizeof( uint8_t ) * io_handle->verified_pages_bitmap_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear verified pages bitmap.",
+			 function );
+
+			memory_free(
+			 io_handle->verified_pages_bitmap );
+
+			io_handle->verified_pages_bitmap      = NULL;
+			io_handle->verified_pages_bitmap_size = 0;
+
+			return( -1 );
+		}
 	}
-	file_header_data = (uint8_t *) memory_allocate(
-	                                sizeof( uint8_t ) * read_size );
+	bitmap_index = (size_t) ( page_number / 8 );
 
-	if( file_header_data == NULL )
+	io_handle->verified_pages_bitmap[ bitmap_index ] |= (uint8_t) ( 1 << ( page_number % 8 ) );
+
+	return( 1 );
+}
+
+/* Marks the checksum of a specific page as mismatched
+ * The mismatch of a page is counted and reported to the checksum mismatch
+ * callback only once, regardless of the number of times the page is read
+ * Returns 1 if the page was marked, 0 if the page was already marked or -1 on error
+ */
+int libesedb_io_handle_set_page_checksum_mismatch(
+     libesedb_io_handle_t *io_handle,
+     uint32_t page_number,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_io_handle_set_page_checksum_mismatch";
+	void *reallocation    = NULL;
+	size_t bitmap_index   = 0;
+	size_t bitmap_size    = 0;
+
+	if( io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create file header data.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	read_count = libbfio_handle_read_buffer(
-	              file_io_handle,
-	              file_header_data,
-	              read_size,
-	              error );
+	bitmap_index = (size_t) ( page_number / 8 );
 
-	if( read_count != (ssize_t) read_size )
+	/* The bitmap is sized to the last page number and only grows for pages
+	 * beyond the last page number
+	 */
+	if( bitmap_index >= io_handle->mismatched_pages_bitmap_size )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read file header.",
-		 function );
+		bitmap_size = (size_t) ( io_handle->last_page_number / 8 ) + 1;
 
-		goto on_error;
+		if( bitmap_size <= bitmap_index )
+		{
+			bitmap_size = bitmap_index + 1;
+		}
+		reallocation = memory_reallocate(
+		                io_handle->mismatched_pages_bitmap,
+		                sizeof( uint8_t ) * bitmap_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize mismatched pages bitmap.",
+			 function );
+
+			return( -1 );
+		}
+		io_handle->mismatched_pages_bitmap = (uint8_t *) reallocation;
+
+		if( memory_set(
+		     &( io_handle->mismatched_pages_bitmap[ io_handle->mismatched_pages_bitmap_size ] ),
+		     0,
+		     sizeof( uint8_t ) * ( bitmap_size - io_handle->mismatched_pages_bitmap_size ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear mismatched pages bitmap.",
+			 function );
+
+			return( -1 );
+		}
+		io_handle->mismatched_pages_bitmap_size = bitmap_size;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( ( io_handle->mismatched_pages_bitmap[ bitmap_index ] & ( 1 << ( page_number % 8 ) ) ) != 0 )
 	{
-		libcnotify_printf(
-		 "%s: file header data:\n",
-		 function );
-		libcnotify_print_data(
-		 file_header_data,
-		 sizeof( esedb_file_header_t ),
-		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+		return( 0 );
 	}
-#endif
-	if( memory_compare(
-	     ( (esedb_file_header_t *) file_header_data )->signature,
-	     esedb_file_signature,
-	     4 ) != 0 )
+	io_handle->mismatched_pages_bitmap[ bitmap_index ] |= (uint8_t) ( 1 << ( page_number % 8 ) );
+
+	io_handle->number_of_checksum_mismatches += 1;
+
+	if( io_handle->checksum_mismatch_callback != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported file signature.",
-		 function );
+		io_handle->checksum_mismatch_callback(
+		 page_number,
+		 io_handle->checksum_mismatch_callback_data );
+	}
+	return( 1 );
+}
 
-		goto on_error;
+/* Verifies the checksums of a page that was queued to be verified in the background
+ * Callback function for the checksum verification thread pool
+ * The checksum verification is freed by the callback
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_io_handle_verify_page_checksums_callback(
+     libesedb_checksum_verification_t *checksum_verification,
+     void *arguments LIBESEDB_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "libesedb_io_handle_verify_page_checksums_callback";
+	int result               = 0;
+
+	LIBESEDB_UNREFERENCED_PARAMETER( arguments )
+
+	if( checksum_verification == NULL )
+	{
+		return( -1 );
 	}
-	if( libesedb_checksum_calculate_little_endian_xor32(
-	     &calculated_xor32_checksum,
-	     &( file_header_data[ 4 ] ),
-	     read_size - 4,
-	     0x89abcdef,
-	     error ) != 1 )
+	result = libesedb_page_verify_checksums(
+	          checksum_verification->io_handle,
+	          checksum_verification->page_number,
+	          checksum_verification->page_flags,
+	          checksum_verification->page_data,
+	          checksum_verification->page_data_size,
+	          &error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
-		 error,
+		 &error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GENERIC,
-		 "%s: unable to calculate XOR-32 checksum.",
-		 function );
-
-		goto on_error;
+		 "%s: unable to verify checksums of page: %" PRIu32 ".",
+		 function,
+		 checksum_verification->page_number );
 	}
-	byte_stream_copy_to_uint32_little_endian(
-	 ( (esedb_file_header_t *) file_header_data )->checksum,
-	 stored_xor32_checksum );
+	else if( result == 0 )
+	{
+		if( libesedb_io_handle_set_page_checksum_mismatch(
+		     checksum_verification->io_handle,
+		     checksum_verification->page_number,
+		     &error ) == -1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to mark checksum of page: %" PRIu32 " as mismatched.",
+			 function,
+			 checksum_verification->page_number );
+
+			result = -1;
+		}
+	}
+	/* There is no caller to pass the error on to
+	 */
+	if( error != NULL )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+#endif
+		libcerror_error_free(
+		 &error );
+	}
+	memory_free(
+	 checksum_verification->page_data );
 
-	if( stored_xor32_checksum != calculated_xor32_checksum )
+	memory_free(
+	 checksum_verification );
+
+	if( result == -1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Queues the checksums of a page to be verified in the background
+ * A copy of the page data is queued, hence the page data can be released after
+ * the call, if no thread pool is available the checksums are verified immediately
+ *
+ * The pages are verified by a single background thread, the mismatched pages
+ * bitmap, the number of checksum mismatches and the checksum mismatch callback
+ * are only accessed by this thread until the checksum verification is joined
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_io_handle_queue_page_checksum_verification(
+     libesedb_io_handle_t *io_handle,
+     uint32_t page_number,
+     uint32_t page_flags,
+     const uint8_t *page_data,
+     size_t page_data_size,
+     libcerror_error_t **error )
+{
+	libesedb_checksum_verification_t *checksum_verification = NULL;
+	static char *function                                   = "libesedb_io_handle_queue_page_checksum_verification";
+
+	if( io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_INPUT,
-		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
-		 "%s: mismatch in file header checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).",
-		 function,
-		 stored_xor32_checksum,
-		 calculated_xor32_checksum );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page_data_size == 0 )
+	 || ( page_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	checksum_verification = memory_allocate_structure(
+	                         libesedb_checksum_verification_t );
+
+	if( checksum_verification == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create checksum verification.",
+		 function );
 
 		goto on_error;
 	}
-	byte_stream_copy_to_uint32_little_endian(
-	 ( (esedb_file_header_t *) file_header_data )->format_version,
-	 format_version );
+	checksum_verification->io_handle      = io_handle;
+	checksum_verification->page_number    = page_number;
+	checksum_verification->page_flags     = page_flags;
+	checksum_verification->page_data_size = page_data_size;
 
-	byte_stream_copy_to_uint32_little_endian(
-	 ( (esedb_file_header_t *) file_header_data )->file_type,
-	 io_handle->file_type );
+	checksum_verification->page_data = (uint8_t *) memory_allocate(
+	                                                sizeof( uint8_t ) * page_data_size );
 
-	byte_stream_copy_to_uint32_little_endian(
-	 ( (esedb_file_header_t *) file_header_data )->format_revision,
-	 format_revision );
-	byte_stream_copy_to_uint32_little_endian(
-	 ( (esedb_file_header_t *) file_header_data )->page_size,
-	 page_size );
+	if( checksum_verification->page_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create page data.",
+		 function );
 
-	byte_stream_copy_to_uint32_little_endian(
-	 ( (esedb_file_header_t *) file_header_data )->creation_format_version,
-	 creation_format_version );
-	byte_stream_copy_to_uint32_little_endian(
-	 ( (esedb_file_header_t *) file_header_data )->creation_format_revision,
-	 creation_format_revision );
+		goto on_error;
+	}
+	if( memory_copy(
+	     checksum_verification->page_data,
+	     page_data,
+	     page_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy page data.",
+		 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+		goto on_error;
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( io_handle->checksum_thread_pool == NULL )
 	{
-		libcnotify_printf(
-		 "%s: checksum\t\t\t\t: 0x%08" PRIx32 "\n",
+		if( libcthreads_thread_pool_create(
+		     &( io_handle->checksum_thread_pool ),
+		     NULL,
+		     1,
+		     LIBESEDB_MAXIMUM_NUMBER_OF_QUEUED_VERIFY_PAGES,
+		     (int (*)(intptr_t *, void *)) &libesedb_io_handle_verify_page_checksums_callback,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create checksum thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The push blocks if the maximum number of queued pages is reached
+	 */
+	if( libcthreads_thread_pool_push(
+	     io_handle->checksum_thread_pool,
+	     (intptr_t *) checksum_verification,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push checksum verification of page: %" PRIu32 " onto thread pool.",
 		 function,
-		 stored_xor32_checksum );
+		 page_number );
 
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (esedb_file_header_t *) file_header_data )->signature,
-		 value_32bit );
-		libcnotify_printf(
-		 "%s: signature\t\t\t\t: 0x%08" PRIx32 "\n",
-		 function,
-		 value_32bit );
+		goto on_error;
+	}
+#else
+	/* Without multi-threading support the checksums are verified immediately
+	 */
+	libesedb_io_handle_verify_page_checksums_callback(
+	 checksum_verification,
+	 NULL );
+#endif
+	return( 1 );
 
-		libcnotify_printf(
-		 "%s: format version\t\t\t: 0x%08" PRIx32 "\n",
-		 function,
-		 format_version );
+on_error:
+	if( checksum_verification != NULL )
+	{
+		if( checksum_verification->page_data != NULL )
+		{
+			memory_free(
+			 checksum_verification->page_data );
+		}
+		memory_free(
+		 checksum_verification );
+	}
+	return( -1 );
+}
 
-		libcnotify_printf(
-		 "%s: file type\t\t\t\t: %" PRIu32 " (",
-		 function,
-		 io_handle->file_type );
-		libesedb_debug_print_file_type(
-		 io_handle->file_type );
-		libcnotify_printf(
-		 ")\n" );
+/* Joins the checksum verification in the background
+ * Waits until all the queued pages have been verified
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_io_handle_join_checksum_verification(
+     libesedb_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_io_handle_join_checksum_verification";
 
-		libcnotify_printf(
-		 "%s: database time:\n",
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
 		 function );
-		libcnotify_print_data(
-		 ( (esedb_file_header_t *) file_header_data )->database_time,
-		 8,
-		 0 );
 
-		libcnotify_printf(
-		 "%s: database signature:\n",
-		 function );
-		libcnotify_print_data(
-		 ( (esedb_file_header_t *) file_header_data )->database_signature,
-		 28,
-		 0 );
+		return( -1 );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( io_handle->checksum_thread_pool != NULL )
+	{
+		if( libcthreads_thread_pool_join(
+		     &( io_handle->checksum_thread_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join checksum thread pool.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	return( 1 );
+}
 
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (esedb_file_header_t *) file_header_data )->database_state,
-		 value_32bit );
-		libcnotify_printf(
-		 "%s: database state\t\t\t: %" PRIu32 " ",
-		 function,
-		 value_32bit );
-		libesedb_debug_print_database_state(
-		 value_32bit );
-		libcnotify_printf(
-		 "\n" );
+/* Maps the file into memory
+ * The mapping is private and read-only, the page data is never modified
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libesedb_io_handle_map_file(
+     libesedb_io_handle_t *io_handle,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_io_handle_map_file";
 
-		libcnotify_printf(
-		 "%s: consistent position:\n",
-		 function );
-		libcnotify_print_data(
-		 ( (esedb_file_header_t *) file_header_data )->consistent_postition,
-		 8,
-		 0 );
-		libesedb_debug_print_log_time(
-		 ( (esedb_file_header_t *) file_header_data )->consistent_time,
-		 8,
-		 "consistent time",
-		 "\t\t\t\t",
-		 NULL );
+#if defined( HAVE_MMAP ) && defined( HAVE_SYS_MMAN_H ) && defined( HAVE_FSTAT ) && defined( HAVE_OPEN ) && defined( HAVE_CLOSE )
+	struct stat file_statistics;
 
-		libesedb_debug_print_log_time(
-		 ( (esedb_file_header_t *) file_header_data )->attach_time,
-		 8,
-		 "attach time",
-		 "\t\t\t\t",
-		 NULL );
-		libcnotify_printf(
-		 "%s: attach position:\n",
-		 function );
-		libcnotify_print_data(
-		 ( (esedb_file_header_t *) file_header_data )->attach_postition,
-		 8,
-		 0 );
+	void *mapped_data     = NULL;
+	int file_descriptor   = -1;
+#endif
 
-		libesedb_debug_print_log_time(
-		 ( (esedb_file_header_t *) file_header_data )->detach_time,
-		 8,
-		 "detach time",
-		 "\t\t\t\t",
-		 NULL );
-		libcnotify_printf(
-		 "%s: detach position:\n",
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
 		 function );
-		libcnotify_print_data(
-		 ( (esedb_file_header_t *) file_header_data )->detach_postition,
-		 8,
-		 0 );
 
-		libcnotify_printf(
-		 "%s: log signature:\n",
+		return( -1 );
+	}
+	if( io_handle->mapped_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid IO handle - mapped data value already set.",
 		 function );
-		libcnotify_print_data(
-		 ( (esedb_file_header_t *) file_header_data )->log_signature,
-		 28,
-		 0 );
 
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (esedb_file_header_t *) file_header_data )->unknown1,
-		 value_32bit );
-		libcnotify_printf(
-		 "%s: unknown1\t\t\t\t: 0x%08" PRIx32 " (%" PRIu32 ")\n",
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MMAP ) && defined( HAVE_SYS_MMAN_H ) && defined( HAVE_FSTAT ) && defined( HAVE_OPEN ) && defined( HAVE_CLOSE )
+	file_descriptor = open(
+	                   filename,
+	                   O_RDONLY );
+
+	if( file_descriptor == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open file: %s.",
 		 function,
-		 value_32bit,
-		 value_32bit );
+		 filename );
 
-		libcnotify_printf(
-		 "%s: previous full backup:\n",
-		 function );
-		libcnotify_print_data(
-		 ( (esedb_file_header_t *) file_header_data )->previous_full_backup,
-		 24,
-		 0 );
-		libcnotify_printf(
-		 "%s: previous incremental backup:\n",
-		 function );
-		libcnotify_print_data(
-		 ( (esedb_file_header_t *) file_header_data )->previous_incremental_backup,
-		 24,
-		 0 );
-		libcnotify_printf(
-		 "%s: current full backup:\n",
+		goto on_error;
+	}
+	if( fstat(
+	     file_descriptor,
+	     &file_statistics ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 errno,
+		 "%s: unable to retrieve file statistics.",
 		 function );
-		libcnotify_print_data(
-		 ( (esedb_file_header_t *) file_header_data )->current_full_backup,
-		 24,
-		 0 );
 
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (esedb_file_header_t *) file_header_data )->shadowing_disabled,
-		 value_32bit );
-		libcnotify_printf(
-		 "%s: shadowing disabled\t\t\t: %" PRIu32 "\n",
-		 function,
-		 value_32bit );
+		goto on_error;
+	}
+	/* Fall back to reading the pages if the file cannot be mapped as a whole
+	 */
+	if( ( file_statistics.st_size <= 0 )
+	 || ( (uint64_t) file_statistics.st_size > (uint64_t) SSIZE_MAX ) )
+	{
+		close(
+		 file_descriptor );
 
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (esedb_file_header_t *) file_header_data )->last_object_identifier,
-		 value_32bit );
-		libcnotify_printf(
-		 "%s: last object identifier\t\t: %" PRIu32 "\n",
+		return( 0 );
+	}
+	mapped_data = mmap(
+	               NULL,
+	               (size_t) file_statistics.st_size,
+	               PROT_READ,
+	               MAP_PRIVATE,
+	               file_descriptor,
+	               0 );
+
+	if( mapped_data == MAP_FAILED )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to map file: %s.",
 		 function,
-		 value_32bit );
+		 filename );
 
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (esedb_file_header_t *) file_header_data )->index_update_major_version,
-		 value_32bit );
-		libcnotify_printf(
-		 "%s: index update major version\t\t: %" PRIu32 "\n",
-		 function,
-		 value_32bit );
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (esedb_file_header_t *) file_header_data )->index_update_minor_version,
-		 value_32bit );
-		libcnotify_printf(
-		 "%s: index update minor version\t\t: %" PRIu32 "\n",
-		 function,
-		 value_32bit );
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (esedb_file_header_t *) file_header_data )->index_update_build_number,
-		 value_32bit );
-		libcnotify_printf(
-		 "%s: index update build number\t\t: %" PRIu32 "\n",
-		 function,
-		 value_32bit );
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (esedb_file_header_t *) file_header_data )->index_update_service_pack_number,
-		 value_32bit );
-		libcnotify_printf(
-		 "%s: index update service pack number\t: %" PRIu32 "\n",
-		 function,
-		 value_32bit );
+		mapped_data = NULL;
 
-		libcnotify_printf(
-		 "%s: format revision\t\t\t: 0x%08" PRIx32 "\n",
-		 function,
-		 format_revision );
-		libcnotify_printf(
-		 "%s: page size\t\t\t\t: %" PRIu32 "\n",
+		goto on_error;
+	}
+	/* The mapping remains valid after the file descriptor is closed
+	 */
+	if( close(
+	     file_descriptor ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 errno,
+		 "%s: unable to close file: %s.",
 		 function,
-		 page_size );
+		 filename );
 
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (esedb_file_header_t *) file_header_data )->repair_count,
-		 value_32bit );
-		libcnotify_printf(
-		 "%s: repair count\t\t\t: %" PRIu32 "\n",
-		 function,
-		 value_32bit );
-		libesedb_debug_print_log_time(
-		 ( (esedb_file_header_t *) file_header_data )->repair_time,
-		 8,
-		 "repair time",
-		 "\t\t\t\t",
-		 NULL );
+		file_descriptor = -1;
 
-		libcnotify_printf(
-		 "%s: unknown2:\n",
-		 function );
-		libcnotify_print_data(
-		 ( (esedb_file_header_t *) file_header_data )->unknown2,
-		 28,
-		 0 );
+		goto on_error;
+	}
+	io_handle->mapped_data      = (uint8_t *) mapped_data;
+	io_handle->mapped_data_size = (size64_t) file_statistics.st_size;
 
-		libcnotify_printf(
-		 "%s: scrub database time:\n",
+	return( 1 );
+
+on_error:
+	if( mapped_data != NULL )
+	{
+		munmap(
+		 mapped_data,
+		 (size_t) file_statistics.st_size );
+	}
+	if( file_descriptor != -1 )
+	{
+		close(
+		 file_descriptor );
+	}
+	return( -1 );
+#else
+	return( 0 );
+#endif
+}
+
+/* Unmaps the file from memory
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_io_handle_unmap_file(
+     libesedb_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_io_handle_unmap_file";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
 		 function );
-		libcnotify_print_data(
-		 ( (esedb_file_header_t *) file_header_data )->scrub_database_time,
-		 8,
-		 0 );
-		libesedb_debug_print_log_time(
-		 ( (esedb_file_header_t *) file_header_data )->scrub_time,
-		 8,
-		 "scrub time",
-		 "\t\t\t\t",
-		 NULL );
 
-		libcnotify_printf(
-		 "%s: required log:\n",
+		return( -1 );
+	}
+	if( io_handle->mapped_data == NULL )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_MUNMAP ) && defined( HAVE_SYS_MMAN_H )
+	if( munmap(
+	     (void *) io_handle->mapped_data,
+	     (size_t) io_handle->mapped_data_size ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 errno,
+		 "%s: unable to unmap file.",
 		 function );
-		libcnotify_print_data(
-		 ( (esedb_file_header_t *) file_header_data )->required_log,
-		 8,
-		 0 );
 
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (esedb_file_header_t *) file_header_data )->upgrade_exchange5_format,
-		 value_32bit );
-		libcnotify_printf(
-		 "%s: upgrade Exchange 5.5 format\t: %" PRIu32 "\n",
-		 function,
-		 value_32bit );
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (esedb_file_header_t *) file_header_data )->upgrade_free_pages,
-		 value_32bit );
-		libcnotify_printf(
-		 "%s: upgrade free pages\t\t\t: %" PRIu32 "\n",
-		 function,
-		 value_32bit );
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (esedb_file_header_t *) file_header_data )->upgrade_space_map_pages,
-		 value_32bit );
-		libcnotify_printf(
-		 "%s: upgrade space map pages\t\t: %" PRIu32 "\n",
-		 function,
-		 value_32bit );
+		return( -1 );
+	}
+#endif
+	io_handle->mapped_data      = NULL;
+	io_handle->mapped_data_size = 0;
 
-		libcnotify_printf(
-		 "%s: current shadow volume backup:\n",
-		 function );
-		libcnotify_print_data(
-		 ( (esedb_file_header_t *) file_header_data )->current_shadow_volume_backup,
-		 24,
-		 0 );
+	return( 1 );
+}
 
-		libcnotify_printf(
-		 "%s: creation format version\t\t: 0x%08" PRIx32 "\n",
-		 function,
-		 creation_format_version );
-		libcnotify_printf(
-		 "%s: creation format revision\t\t: 0x%08" PRIx32 "\n",
-		 function,
-		 creation_format_revision );
+/* Opens a file descriptor that is used to pass read-ahead hints to the operating system
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libesedb_io_handle_open_read_ahead(
+     libesedb_io_handle_t *io_handle,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_io_handle_open_read_ahead";
 
-		libcnotify_printf(
-		 "%s: unknown3:\n",
+#if defined( HAVE_POSIX_FADVISE ) && defined( HAVE_OPEN ) && defined( HAVE_CLOSE )
+	int file_descriptor   = -1;
+#endif
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
 		 function );
-		libcnotify_print_data(
-		 ( (esedb_file_header_t *) file_header_data )->unknown3,
-		 16,
-		 0 );
 
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (esedb_file_header_t *) file_header_data )->old_repair_count,
-		 value_32bit );
-		libcnotify_printf(
-		 "%s: old repair count\t\t\t: %" PRIu32 "\n",
-		 function,
-		 value_32bit );
+		return( -1 );
+	}
+	if( io_handle->read_ahead_file_descriptor != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid IO handle - read-ahead file descriptor value already set.",
+		 function );
 
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (esedb_file_header_t *) file_header_data )->ecc_fix_success_count,
-		 value_32bit );
-		libcnotify_printf(
-		 "%s: ECC fix success count\t\t: %" PRIu32 "\n",
-		 function,
-		 value_32bit );
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_POSIX_FADVISE ) && defined( HAVE_OPEN ) && defined( HAVE_CLOSE )
+	file_descriptor = open(
+	                   filename,
+	                   O_RDONLY );
+
+	if( file_descriptor == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open file: %s.",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	io_handle->read_ahead_file_descriptor = file_descriptor;
+
+	return( 1 );
+#else
+	return( 0 );
+#endif
+}
+
+/* Closes the read-ahead file descriptor
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_io_handle_close_read_ahead(
+     libesedb_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_io_handle_close_read_ahead";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->read_ahead_file_descriptor == -1 )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_CLOSE )
+	if( close(
+	     io_handle->read_ahead_file_descriptor ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 errno,
+		 "%s: unable to close read-ahead file descriptor.",
+		 function );
+
+		io_handle->read_ahead_file_descriptor = -1;
+
+		return( -1 );
+	}
+#endif
+	io_handle->read_ahead_file_descriptor = -1;
+
+	return( 1 );
+}
+
+/* Passes a hint to the operating system that a range of pages will be read
+ * The pages are read in the background and the hint itself does not fail
+ * Returns 1 if successful, 0 if no hint was passed or -1 on error
+ */
+int libesedb_io_handle_read_ahead_pages(
+     libesedb_io_handle_t *io_handle,
+     uint32_t page_number,
+     uint32_t number_of_pages,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_io_handle_read_ahead_pages";
+	size64_t read_size    = 0;
+	off64_t file_offset   = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page_number == 0 )
+	 || ( page_number > io_handle->last_page_number )
+	 || ( number_of_pages == 0 ) )
+	{
+		return( 0 );
+	}
+	if( number_of_pages > ( io_handle->last_page_number - page_number + 1 ) )
+	{
+		number_of_pages = io_handle->last_page_number - page_number + 1;
+	}
+	file_offset  = page_number - 1;
+	file_offset *= io_handle->page_size;
+	file_offset += io_handle->pages_data_offset;
+
+	read_size  = number_of_pages;
+	read_size *= io_handle->page_size;
+
+#if defined( HAVE_MADVISE ) && defined( HAVE_SYS_MMAN_H )
+	if( io_handle->mapped_data != NULL )
+	{
+		if( ( (size64_t) file_offset + read_size ) > io_handle->mapped_data_size )
+		{
+			return( 0 );
+		}
+		madvise(
+		 (void *) &( io_handle->mapped_data[ file_offset ] ),
+		 (size_t) read_size,
+		 MADV_WILLNEED );
+
+		return( 1 );
+	}
+#endif
+#if defined( HAVE_POSIX_FADVISE )
+	if( io_handle->read_ahead_file_descriptor != -1 )
+	{
+		posix_fadvise(
+		 io_handle->read_ahead_file_descriptor,
+		 (off_t) file_offset,
+		 (off_t) read_size,
+		 POSIX_FADV_WILLNEED );
+
+		return( 1 );
+	}
+#endif
+	return( 0 );
+}
+
+/* Retrieves the maximum number of cache entries of a specific cache type
+ * If a memory budget is set the number of cache entries is derived from the
+ * share of the budget of the cache type and the size of a cache entry:
+ * - half of the budget is used by the pages, a quarter of which by the pages
+ *   cache and the remainder by the ghost pages queue and the hot pages
+ * - the other half is shared equally by the tree values caches, which prevents
+ *   a sequential scan over the pages from evicting the tree values
+ * Every cache has at least 1 entry, hence the memory budget can be exceeded
+ * by 1 entry per cache if the budget is too small for the number of caches
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_io_handle_get_maximum_number_of_cache_entries(
+     libesedb_io_handle_t *io_handle,
+     int cache_type,
+     int *maximum_number_of_cache_entries,
+     libcerror_error_t **error )
+{
+	static char *function               = "libesedb_io_handle_get_maximum_number_of_cache_entries";
+	size64_t cache_entry_size           = 0;
+	size64_t cache_memory_budget        = 0;
+	size64_t ghost_pages_size           = 0;
+	size64_t pages_cache_size           = 0;
+	size64_t pages_memory_budget        = 0;
+	uint64_t number_of_cache_entries    = 0;
+	int default_number_of_cache_entries = 0;
+	int number_of_tree_values_caches    = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_cache_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum number of cache entries.",
+		 function );
+
+		return( -1 );
+	}
+	pages_memory_budget = io_handle->memory_budget / 2;
+
+	/* The size of a page cache entry is the size of the page and its data
+	 */
+	cache_entry_size = (size64_t) sizeof( libesedb_page_t ) + io_handle->page_size + LIBESEDB_CACHE_ENTRY_OVERHEAD_SIZE;
+	pages_cache_size = ( ( pages_memory_budget / 4 ) / cache_entry_size ) * cache_entry_size;
+
+	/* The ghost pages queue contains 3 times the number of page numbers of the pages cache,
+	 * the page numbers that are in the pages cache and the ones recently evicted from it
+	 */
+	ghost_pages_size = 3 * ( pages_cache_size / cache_entry_size ) * sizeof( uint32_t );
+
+	if( ghost_pages_size == 0 )
+	{
+		ghost_pages_size = sizeof( uint32_t );
+	}
+	ghost_pages_size += ( io_handle->last_page_number / 8 ) + 1;
+
+	switch( cache_type )
+	{
+		case LIBESEDB_CACHE_TYPE_PAGES:
+			default_number_of_cache_entries = LIBESEDB_MAXIMUM_CACHE_ENTRIES_PAGES;
+			cache_memory_budget             = pages_memory_budget / 4;
+			break;
+
+		case LIBESEDB_CACHE_TYPE_GHOST_PAGES:
+			default_number_of_cache_entries = LIBESEDB_MAXIMUM_CACHE_ENTRIES_GHOST_PAGES;
+			cache_memory_budget             = 3 * ( pages_cache_size / cache_entry_size ) * sizeof( uint32_t );
+			cache_entry_size                = sizeof( uint32_t );
+			break;
+
+		case LIBESEDB_CACHE_TYPE_HOT_PAGES:
+			default_number_of_cache_entries = LIBESEDB_MAXIMUM_CACHE_ENTRIES_HOT_PAGES;
+			cache_entry_size                = (size64_t) sizeof( libesedb_hot_page_t ) + sizeof( int ) + io_handle->page_size;
+
+			if( ( pages_cache_size + ghost_pages_size ) < pages_memory_budget )
+			{
+				cache_memory_budget = pages_memory_budget - pages_cache_size - ghost_pages_size;
+			}
+			break;
+
+		case LIBESEDB_CACHE_TYPE_INDEX_VALUES:
+			default_number_of_cache_entries = LIBESEDB_MAXIMUM_CACHE_ENTRIES_INDEX_VALUES;
+			break;
+
+		case LIBESEDB_CACHE_TYPE_LONG_VALUES:
+			default_number_of_cache_entries = LIBESEDB_MAXIMUM_CACHE_ENTRIES_LONG_VALUES;
+			break;
+
+		case LIBESEDB_CACHE_TYPE_TABLE_VALUES:
+			default_number_of_cache_entries = LIBESEDB_MAXIMUM_CACHE_ENTRIES_TABLE_VALUES;
+			break;
+
+		case LIBESEDB_CACHE_TYPE_TREE_VALUES:
+			default_number_of_cache_entries = LIBESEDB_MAXIMUM_CACHE_ENTRIES_TREE_VALUES;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported cache type: %d.",
+			 function,
+			 cache_type );
+
+			return( -1 );
+	}
+	if( io_handle->memory_budget == 0 )
+	{
+		*maximum_number_of_cache_entries = default_number_of_cache_entries;
+
+		return( 1 );
+	}
+	if( ( cache_type != LIBESEDB_CACHE_TYPE_PAGES )
+	 && ( cache_type != LIBESEDB_CACHE_TYPE_GHOST_PAGES )
+	 && ( cache_type != LIBESEDB_CACHE_TYPE_HOT_PAGES ) )
+	{
+		/* The tree values caches contain the data definitions of the tree values
+		 */
+		number_of_tree_values_caches = io_handle->number_of_tree_values_caches;
+
+		if( number_of_tree_values_caches == 0 )
+		{
+			number_of_tree_values_caches = 1;
+		}
+		cache_memory_budget = ( io_handle->memory_budget / 2 ) / number_of_tree_values_caches;
+		cache_entry_size    = (size64_t) sizeof( libesedb_data_definition_t ) + LIBESEDB_CACHE_ENTRY_OVERHEAD_SIZE;
+	}
+	number_of_cache_entries = cache_memory_budget / cache_entry_size;
+
+	if( number_of_cache_entries == 0 )
+	{
+		number_of_cache_entries = 1;
+	}
+	else if( number_of_cache_entries > (uint64_t) INT_MAX )
+	{
+		number_of_cache_entries = (uint64_t) INT_MAX;
+	}
+	*maximum_number_of_cache_entries = (int) number_of_cache_entries;
+
+	return( 1 );
+}
+
+/* Resizes the tree values caches to their share of the memory budget
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_io_handle_resize_tree_values_caches(
+     libesedb_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function               = "libesedb_io_handle_resize_tree_values_caches";
+	int cache_index                     = 0;
+	int maximum_number_of_cache_entries = 0;
+	int number_of_cache_entries         = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->number_of_tree_values_caches == 0 )
+	{
+		return( 1 );
+	}
+	/* All the tree values caches have the same share of the memory budget
+	 */
+	if( libesedb_io_handle_get_maximum_number_of_cache_entries(
+	     io_handle,
+	     LIBESEDB_CACHE_TYPE_TREE_VALUES,
+	     &maximum_number_of_cache_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve maximum number of cache entries.",
+		 function );
+
+		return( -1 );
+	}
+	for( cache_index = 0;
+	     cache_index < io_handle->number_of_tree_values_caches;
+	     cache_index++ )
+	{
+		if( libfcache_cache_get_number_of_entries(
+		     io_handle->tree_values_caches[ cache_index ],
+		     &number_of_cache_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of entries of cache: %d.",
+			 function,
+			 cache_index );
+
+			return( -1 );
+		}
+		if( number_of_cache_entries == maximum_number_of_cache_entries )
+		{
+			continue;
+		}
+		/* Values are only referenced from the cache during a single library call,
+		 * hence shrinking the cache does not free values that are still in use
+		 */
+		if( libfcache_cache_resize(
+		     io_handle->tree_values_caches[ cache_index ],
+		     maximum_number_of_cache_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize cache: %d.",
+			 function,
+			 cache_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Creates a cache of a specific cache type
+ * If a memory budget is set a tree values cache shares the memory budget with
+ * the other tree values caches until it is freed with libesedb_io_handle_free_cache,
+ * the other tree values caches are resized to their new share of the memory budget
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_io_handle_create_cache(
+     libesedb_io_handle_t *io_handle,
+     int cache_type,
+     libfcache_cache_t **cache,
+     libcerror_error_t **error )
+{
+	void *reallocation                  = NULL;
+	static char *function               = "libesedb_io_handle_create_cache";
+	int is_tree_values_cache            = 0;
+	int maximum_number_of_cache_entries = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( io_handle->memory_budget != 0 )
+	 && ( ( cache_type == LIBESEDB_CACHE_TYPE_INDEX_VALUES )
+	  ||  ( cache_type == LIBESEDB_CACHE_TYPE_LONG_VALUES )
+	  ||  ( cache_type == LIBESEDB_CACHE_TYPE_TABLE_VALUES )
+	  ||  ( cache_type == LIBESEDB_CACHE_TYPE_TREE_VALUES ) ) )
+	{
+		is_tree_values_cache = 1;
+	}
+	if( is_tree_values_cache != 0 )
+	{
+		reallocation = memory_reallocate(
+		                io_handle->tree_values_caches,
+		                sizeof( libfcache_cache_t * ) * ( io_handle->number_of_tree_values_caches + 1 ) );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize tree values caches.",
+			 function );
+
+			return( -1 );
+		}
+		io_handle->tree_values_caches = (libfcache_cache_t **) reallocation;
+
+		/* The share of the new cache is determined including the new cache
+		 */
+		io_handle->number_of_tree_values_caches += 1;
+	}
+	if( libesedb_io_handle_get_maximum_number_of_cache_entries(
+	     io_handle,
+	     cache_type,
+	     &maximum_number_of_cache_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve maximum number of cache entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfcache_cache_initialize(
+	     cache,
+	     maximum_number_of_cache_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( is_tree_values_cache != 0 )
+	{
+		io_handle->tree_values_caches[ io_handle->number_of_tree_values_caches - 1 ] = *cache;
+
+		if( libesedb_io_handle_resize_tree_values_caches(
+		     io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize tree values caches.",
+			 function );
+
+			libfcache_cache_free(
+			 cache,
+			 NULL );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( is_tree_values_cache != 0 )
+	{
+		io_handle->number_of_tree_values_caches -= 1;
+	}
+	return( -1 );
+}
+
+/* Frees a cache of a specific cache type
+ * A tree values cache no longer shares the memory budget, the other tree values
+ * caches are resized to their new share of the memory budget
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_io_handle_free_cache(
+     libesedb_io_handle_t *io_handle,
+     int cache_type,
+     libfcache_cache_t **cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_io_handle_free_cache";
+	int cache_index       = 0;
+	int result            = 1;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cache == NULL )
+	{
+		return( 1 );
+	}
+	/* The tree values caches are no longer tracked after the IO handle has been cleared
+	 */
+	for( cache_index = 0;
+	     cache_index < io_handle->number_of_tree_values_caches;
+	     cache_index++ )
+	{
+		if( io_handle->tree_values_caches[ cache_index ] == *cache )
+		{
+			break;
+		}
+	}
+	if( cache_index < io_handle->number_of_tree_values_caches )
+	{
+		io_handle->number_of_tree_values_caches -= 1;
+
+		while( cache_index < io_handle->number_of_tree_values_caches )
+		{
+			io_handle->tree_values_caches[ cache_index ] = io_handle->tree_values_caches[ cache_index + 1 ];
+
+			cache_index++;
+		}
+	}
+	if( libfcache_cache_free(
+	     cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free cache.",
+		 function );
+
+		result = -1;
+	}
+	if( ( io_handle->memory_budget != 0 )
+	 && ( cache_type != LIBESEDB_CACHE_TYPE_PAGES ) )
+	{
+		if( libesedb_io_handle_resize_tree_values_caches(
+		     io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize tree values caches.",
+			 function );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Creates the hot pages
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_io_handle_create_hot_pages(
+     libesedb_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function               = "libesedb_io_handle_create_hot_pages";
+	int maximum_number_of_ghost_pages   = 0;
+	int maximum_number_of_hot_pages     = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_io_handle_get_maximum_number_of_cache_entries(
+	     io_handle,
+	     LIBESEDB_CACHE_TYPE_HOT_PAGES,
+	     &maximum_number_of_hot_pages,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve maximum number of hot pages.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_io_handle_get_maximum_number_of_cache_entries(
+	     io_handle,
+	     LIBESEDB_CACHE_TYPE_GHOST_PAGES,
+	     &maximum_number_of_ghost_pages,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve maximum number of ghost pages.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_hot_pages_initialize(
+	     &( io_handle->hot_pages ),
+	     (size_t) io_handle->page_size,
+	     io_handle->last_page_number,
+	     maximum_number_of_hot_pages,
+	     maximum_number_of_ghost_pages,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create hot pages.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the pages data range
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_io_handle_set_pages_data_range(
+     libesedb_io_handle_t *io_handle,
+     size64_t file_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_io_handle_set_pages_data_range";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->page_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - missing page size.",
+		 function );
+
+		return( -1 );
+	}
+	io_handle->pages_data_offset = (off64_t) ( io_handle->page_size * 2 );
+	io_handle->pages_data_size   = file_size - (size64_t) io_handle->pages_data_offset;
+	io_handle->last_page_number  = (uint32_t) ( io_handle->pages_data_size / io_handle->page_size );
+
+	return( 1 );
+}
+
+/* Reads the file (or database) header
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_io_handle_read_file_header(
+     libesedb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	uint8_t *file_header_data          = NULL;
+	static char *function              = "libesedb_io_handle_read_file_header";
+	size_t read_size                   = 2048;
+	ssize_t read_count                 = 0;
+	uint32_t calculated_xor32_checksum = 0;
+	uint32_t creation_format_revision  = 0;
+	uint32_t creation_format_version   = 0;
+	uint32_t format_revision           = 0;
+	uint32_t format_version            = 0;
+	uint32_t page_size                 = 0;
+	uint32_t stored_xor32_checksum     = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	uint32_t value_32bit               = 0;
+#endif
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading file header at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+		 function,
+		 file_offset,
+		 file_offset );
+	}
+#endif
+	if( libbfio_handle_seek_offset(
+	     file_io_handle,
+	     file_offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek file header offset: %" PRIi64 ".",
+		 function,
+		 file_offset );
+
+		goto on_error;
+	}
+	file_header_data = (uint8_t *) memory_allocate(
+	                                sizeof( uint8_t ) * read_size );
+
+	if( file_header_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file header data.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer(
+	              file_io_handle,
+	              file_header_data,
+	              read_size,
+	              error );
+
+	if( read_count != (ssize_t) read_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: file header data:\n",
+		 function );
+		libcnotify_print_data(
+		 file_header_data,
+		 sizeof( esedb_file_header_t ),
+		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+	}
+#endif
+	if( memory_compare(
+	     ( (esedb_file_header_t *) file_header_data )->signature,
+	     esedb_file_signature,
+	     4 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported file signature.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_checksum_calculate_little_endian_xor32(
+	     &calculated_xor32_checksum,
+	     &( file_header_data[ 4 ] ),
+	     read_size - 4,
+	     0x89abcdef,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate XOR-32 checksum.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_file_header_t *) file_header_data )->checksum,
+	 stored_xor32_checksum );
+
+	if( stored_xor32_checksum != calculated_xor32_checksum )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+		 "%s: mismatch in file header checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).",
+		 function,
+		 stored_xor32_checksum,
+		 calculated_xor32_checksum );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_file_header_t *) file_header_data )->format_version,
+	 format_version );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_file_header_t *) file_header_data )->file_type,
+	 io_handle->file_type );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_file_header_t *) file_header_data )->format_revision,
+	 format_revision );
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_file_header_t *) file_header_data )->page_size,
+	 page_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_file_header_t *) file_header_data )->creation_format_version,
+	 creation_format_version );
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_file_header_t *) file_header_data )->creation_format_revision,
+	 creation_format_revision );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: checksum\t\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 stored_xor32_checksum );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (esedb_file_header_t *) file_header_data )->signature,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: signature\t\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 value_32bit );
+
+		libcnotify_printf(
+		 "%s: format version\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 format_version );
+
+		libcnotify_printf(
+		 "%s: file type\t\t\t\t: %" PRIu32 " (",
+		 function,
+		 io_handle->file_type );
+		libesedb_debug_print_file_type(
+		 io_handle->file_type );
+		libcnotify_printf(
+		 ")\n" );
+
+		libcnotify_printf(
+		 "%s: database time:\n",
+		 function );
+		libcnotify_print_data(
+		 ( (esedb_file_header_t *) file_header_data )->database_time,
+		 8,
+		 0 );
+
+		libcnotify_printf(
+		 "%s: database signature:\n",
+		 function );
+		libcnotify_print_data(
+		 ( (esedb_file_header_t *) file_header_data )->database_signature,
+		 28,
+		 0 );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (esedb_file_header_t *) file_header_data )->database_state,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: database state\t\t\t: %" PRIu32 " ",
+		 function,
+		 value_32bit );
+		libesedb_debug_print_database_state(
+		 value_32bit );
+		libcnotify_printf(
+		 "\n" );
+
+		libcnotify_printf(
+		 "%s: consistent position:\n",
+		 function );
+		libcnotify_print_data(
+		 ( (esedb_file_header_t *) file_header_data )->consistent_postition,
+		 8,
+		 0 );
+		libesedb_debug_print_log_time(
+		 ( (esedb_file_header_t *) file_header_data )->consistent_time,
+		 8,
+		 "consistent time",
+		 "\t\t\t\t",
+		 NULL );
+
+		libesedb_debug_print_log_time(
+		 ( (esedb_file_header_t *) file_header_data )->attach_time,
+		 8,
+		 "attach time",
+		 "\t\t\t\t",
+		 NULL );
+		libcnotify_printf(
+		 "%s: attach position:\n",
+		 function );
+		libcnotify_print_data(
+		 ( (esedb_file_header_t *) file_header_data )->attach_postition,
+		 8,
+		 0 );
+
+		libesedb_debug_print_log_time(
+		 ( (esedb_file_header_t *) file_header_data )->detach_time,
+		 8,
+		 "detach time",
+		 "\t\t\t\t",
+		 NULL );
+		libcnotify_printf(
+		 "%s: detach position:\n",
+		 function );
+		libcnotify_print_data(
+		 ( (esedb_file_header_t *) file_header_data )->detach_postition,
+		 8,
+		 0 );
+
+		libcnotify_printf(
+		 "%s: log signature:\n",
+		 function );
+		libcnotify_print_data(
+		 ( (esedb_file_header_t *) file_header_data )->log_signature,
+		 28,
+		 0 );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (esedb_file_header_t *) file_header_data )->unknown1,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: unknown1\t\t\t\t: 0x%08" PRIx32 " (%" PRIu32 ")\n",
+		 function,
+		 value_32bit,
+		 value_32bit );
+
+		libcnotify_printf(
+		 "%s: previous full backup:\n",
+		 function );
+		libcnotify_print_data(
+		 ( (esedb_file_header_t *) file_header_data )->previous_full_backup,
+		 24,
+		 0 );
+		libcnotify_printf(
+		 "%s: previous incremental backup:\n",
+		 function );
+		libcnotify_print_data(
+		 ( (esedb_file_header_t *) file_header_data )->previous_incremental_backup,
+		 24,
+		 0 );
+		libcnotify_printf(
+		 "%s: current full backup:\n",
+		 function );
+		libcnotify_print_data(
+		 ( (esedb_file_header_t *) file_header_data )->current_full_backup,
+		 24,
+		 0 );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (esedb_file_header_t *) file_header_data )->shadowing_disabled,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: shadowing disabled\t\t\t: %" PRIu32 "\n",
+		 function,
+		 value_32bit );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (esedb_file_header_t *) file_header_data )->last_object_identifier,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: last object identifier\t\t: %" PRIu32 "\n",
+		 function,
+		 value_32bit );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (esedb_file_header_t *) file_header_data )->index_update_major_version,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: index update major version\t\t: %" PRIu32 "\n",
+		 function,
+		 value_32bit );
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (esedb_file_header_t *) file_header_data )->index_update_minor_version,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: index update minor version\t\t: %" PRIu32 "\n",
+		 function,
+		 value_32bit );
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (esedb_file_header_t *) file_header_data )->index_update_build_number,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: index update build number\t\t: %" PRIu32 "\n",
+		 function,
+		 value_32bit );
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (esedb_file_header_t *) file_header_data )->index_update_service_pack_number,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: index update service pack number\t: %" PRIu32 "\n",
+		 function,
+		 value_32bit );
+
+		libcnotify_printf(
+		 "%s: format revision\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 format_revision );
+		libcnotify_printf(
+		 "%s: page size\t\t\t\t: %" PRIu32 "\n",
+		 function,
+		 page_size );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (esedb_file_header_t *) file_header_data )->repair_count,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: repair count\t\t\t: %" PRIu32 "\n",
+		 function,
+		 value_32bit );
+		libesedb_debug_print_log_time(
+		 ( (esedb_file_header_t *) file_header_data )->repair_time,
+		 8,
+		 "repair time",
+		 "\t\t\t\t",
+		 NULL );
+
+		libcnotify_printf(
+		 "%s: unknown2:\n",
+		 function );
+		libcnotify_print_data(
+		 ( (esedb_file_header_t *) file_header_data )->unknown2,
+		 28,
+		 0 );
+
+		libcnotify_printf(
+		 "%s: scrub database time:\n",
+		 function );
+		libcnotify_print_data(
+		 ( (esedb_file_header_t *) file_header_data )->scrub_database_time,
+		 8,
+		 0 );
+		libesedb_debug_print_log_time(
+		 ( (esedb_file_header_t *) file_header_data )->scrub_time,
+		 8,
+		 "scrub time",
+		 "\t\t\t\t",
+		 NULL );
+
+		libcnotify_printf(
+		 "%s: required log:\n",
+		 function );
+		libcnotify_print_data(
+		 ( (esedb_file_header_t *) file_header_data )->required_log,
+		 8,
+		 0 );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (esedb_file_header_t *) file_header_data )->upgrade_exchange5_format,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: upgrade Exchange 5.5 format\t: %" PRIu32 "\n",
+		 function,
+		 value_32bit );
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (esedb_file_header_t *) file_header_data )->upgrade_free_pages,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: upgrade free pages\t\t\t: %" PRIu32 "\n",
+		 function,
+		 value_32bit );
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (esedb_file_header_t *) file_header_data )->upgrade_space_map_pages,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: upgrade space map pages\t\t: %" PRIu32 "\n",
+		 function,
+		 value_32bit );
+
+		libcnotify_printf(
+		 "%s: current shadow volume backup:\n",
+		 function );
+		libcnotify_print_data(
+		 ( (esedb_file_header_t *) file_header_data )->current_shadow_volume_backup,
+		 24,
+		 0 );
+
+		libcnotify_printf(
+		 "%s: creation format version\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 creation_format_version );
+		libcnotify_printf(
+		 "%s: creation format revision\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 creation_format_revision );
+
+		libcnotify_printf(
+		 "%s: unknown3:\n",
+		 function );
+		libcnotify_print_data(
+		 ( (esedb_file_header_t *) file_header_data )->unknown3,
+		 16,
+		 0 );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (esedb_file_header_t *) file_header_data )->old_repair_count,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: old repair count\t\t\t: %" PRIu32 "\n",
+		 function,
+		 value_32bit );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (esedb_file_header_t *) file_header_data )->ecc_fix_success_count,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: ECC fix success count\t\t: %" PRIu32 "\n",
+		 function,
+		 value_32bit );
 		libesedb_debug_print_log_time(
 		 ( (esedb_file_header_t *) file_header_data )->ecc_fix_success_time,
 		 8,
 		 "ECC fix success time",
 		 "\t\t\t",
 		 NULL );
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (esedb_file_header_t *) file_header_data )->old_ecc_fix_success_count,
-		 value_32bit );
-		libcnotify_printf(
-		 "%s: old ECC fix success count\t\t: %" PRIu32 "\n",
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (esedb_file_header_t *) file_header_data )->old_ecc_fix_success_count,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: old ECC fix success count\t\t: %" PRIu32 "\n",
+		 function,
+		 value_32bit );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (esedb_file_header_t *) file_header_data )->ecc_fix_error_count,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: ECC fix error count\t\t: %" PRIu32 "\n",
+		 function,
+		 value_32bit );
+		libesedb_debug_print_log_time(
+		 ( (esedb_file_header_t *) file_header_data )->ecc_fix_error_time,
+		 8,
+		 "ECC fix error time",
+		 "\t\t\t",
+		 NULL );
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (esedb_file_header_t *) file_header_data )->old_ecc_fix_error_count,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: old ECC fix error count\t\t: %" PRIu32 "\n",
+		 function,
+		 value_32bit );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (esedb_file_header_t *) file_header_data )->bad_checksum_error_count,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: bad checksum error count\t\t: %" PRIu32 "\n",
+		 function,
+		 value_32bit );
+		libesedb_debug_print_log_time(
+		 ( (esedb_file_header_t *) file_header_data )->bad_checksum_error_time,
+		 8,
+		 "bad checksum error time",
+		 "\t\t\t",
+		 NULL );
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (esedb_file_header_t *) file_header_data )->old_bad_checksum_error_count,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: old bad checksum error count\t: %" PRIu32 "\n",
+		 function,
+		 value_32bit );
+
+		libcnotify_printf(
+		 "%s: committed log:\n",
+		 function );
+		libcnotify_print_data(
+		 ( (esedb_file_header_t *) file_header_data )->committed_log,
+		 4,
+		 0 );
+
+		libcnotify_printf(
+		 "%s: previous shadow volume backup:\n",
+		 function );
+		libcnotify_print_data(
+		 ( (esedb_file_header_t *) file_header_data )->previous_shadow_volume_backup,
+		 24,
+		 0 );
+		libcnotify_printf(
+		 "%s: previous differential backup:\n",
+		 function );
+		libcnotify_print_data(
+		 ( (esedb_file_header_t *) file_header_data )->previous_differential_backup,
+		 24,
+		 0 );
+
+		libcnotify_printf(
+		 "%s: unknown4:\n",
+		 function );
+		libcnotify_print_data(
+		 ( (esedb_file_header_t *) file_header_data )->unknown4,
+		 40,
+		 0 );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (esedb_file_header_t *) file_header_data )->nls_major_version,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: NLS major version\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 value_32bit );
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (esedb_file_header_t *) file_header_data )->nls_minor_version,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: NLS minor version\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 value_32bit );
+
+		libcnotify_printf(
+		 "%s: unknown5:\n",
+		 function );
+		libcnotify_print_data(
+		 ( (esedb_file_header_t *) file_header_data )->unknown5,
+		 148,
+		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (esedb_file_header_t *) file_header_data )->unknown_flags,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: unknown flags\t\t\t: 0x%08" PRIx32 " (%" PRIu32 ")\n",
+		 function,
+		 value_32bit,
+		 value_32bit );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+
+	memory_free(
+	 file_header_data );
+
+	file_header_data = NULL;
+
+	/* TODO add more values to internal structures */
+
+	if( file_offset == 0 )
+	{
+		io_handle->format_version           = format_version;
+		io_handle->format_revision          = format_revision;
+		io_handle->page_size                = page_size;
+		io_handle->creation_format_version  = creation_format_version;
+		io_handle->creation_format_revision = creation_format_revision;
+	}
+	else
+	{
+		if( io_handle->format_version == 0 )
+		{
+			io_handle->format_version = format_version;
+		}
+		else if( io_handle->format_version != format_version )
+		{
+#if defined( HAVE_VERBOSE_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: mismatch in format version: 0x%" PRIx32 " and backup: 0x%" PRIx32 "\n",
+				 function,
+				 io_handle->format_version,
+				 io_handle->format_version );
+			}
+#endif
+		}
+		if( io_handle->format_revision == 0 )
+		{
+			io_handle->format_revision = format_revision;
+		}
+		else if( io_handle->format_revision != format_revision )
+		{
+#if defined( HAVE_VERBOSE_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: mismatch in format revision: 0x%" PRIx32 " and backup: 0x%" PRIx32 "\n",
+				 function,
+				 io_handle->format_revision,
+				 io_handle->format_revision );
+			}
+#endif
+		}
+		if( io_handle->page_size == 0 )
+		{
+			io_handle->page_size = page_size;
+		}
+		else if( io_handle->page_size != page_size )
+		{
+#if defined( HAVE_VERBOSE_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: mismatch in page size: 0x%04" PRIx32 " and backup: 0x%04" PRIx32 "\n",
+				 function,
+				 io_handle->page_size,
+				 page_size );
+			}
+#endif
+			/* The offset of the backup (database) file header
+			 * is a good indication of the actual page size
+			 */
+			io_handle->page_size = (uint32_t) file_offset;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( file_header_data != NULL )
+	{
+		memory_free(
+		 file_header_data );
+	}
+	return( -1 );
+}
+
+/* Reads a page
+ * Callback function for the page vector
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_io_handle_read_page(
+     libesedb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfdata_vector_t *vector,
+     libfcache_cache_t *cache,
+     int element_index,
+     int element_file_index LIBESEDB_ATTRIBUTE_UNUSED,
+     off64_t element_offset,
+     size64_t element_size LIBESEDB_ATTRIBUTE_UNUSED,
+     uint32_t element_flags LIBESEDB_ATTRIBUTE_UNUSED,
+     uint8_t read_flags LIBESEDB_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	libesedb_page_t *page      = NULL;
+	const uint8_t *page_data   = NULL;
+	static char *function      = "libesedb_io_handle_read_page";
+	size_t page_data_size      = 0;
+	uint32_t page_number       = 0;
+	int result                 = 0;
+
+	LIBESEDB_UNREFERENCED_PARAMETER( element_file_index );
+	LIBESEDB_UNREFERENCED_PARAMETER( element_size );
+	LIBESEDB_UNREFERENCED_PARAMETER( element_flags );
+	LIBESEDB_UNREFERENCED_PARAMETER( read_flags );
+
+	if( libesedb_page_pool_get_page(
+	     io_handle->page_pool,
+	     &page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page from page pool.",
+		 function );
+
+		goto on_error;
+	}
+	/* The hot pages are not used if the file is memory mapped
+	 */
+	if( ( io_handle->mapped_data == NULL )
+	 && ( io_handle->hot_pages == NULL ) )
+	{
+		if( libesedb_io_handle_create_hot_pages(
+		     io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create hot pages.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	page_number = (uint32_t) element_index + 1;
+
+	if( io_handle->hot_pages != NULL )
+	{
+		result = libesedb_hot_pages_get_page_data(
+		          io_handle->hot_pages,
+		          page_number,
+		          &page_data,
+		          &page_data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve hot page: %" PRIu32 " data.",
+			 function,
+			 page_number );
+
+			goto on_error;
+		}
+	}
+	if( result != 0 )
+	{
+		if( libesedb_page_read_buffer(
+		     page,
+		     io_handle,
+		     element_offset,
+		     page_data,
+		     page_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read hot page: %" PRIu32 ".",
+			 function,
+			 page_number );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		if( libesedb_page_read(
+		     page,
+		     io_handle,
+		     file_io_handle,
+		     element_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read page.",
+			 function );
+
+			goto on_error;
+		}
+		if( io_handle->hot_pages != NULL )
+		{
+			if( libesedb_hot_pages_admit_page(
+			     io_handle->hot_pages,
+			     page_number,
+			     page->data,
+			     page->data_size,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to admit page: %" PRIu32 " to hot pages.",
+				 function,
+				 page_number );
+
+				goto on_error;
+			}
+		}
+	}
+	if( libfdata_vector_set_element_value_by_index(
+	     vector,
+	     (intptr_t *) file_io_handle,
+	     cache,
+	     element_index,
+	     (intptr_t *) page,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_page_free,
+	     LIBFDATA_VECTOR_ELEMENT_VALUE_FLAG_MANAGED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set page as element value.",
+		 function );
+
+		goto on_error;
+	}
+	/* The page is managed by the pages cache, it is marked resident after it
+	 * was set since setting it can free a previous page with the same page number
+	 */
+	if( libesedb_page_pool_set_page_resident(
+	     io_handle->page_pool,
+	     page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set page: %" PRIu32 " resident.",
+		 function,
+		 page_number );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( page != NULL )
+	{
+		libesedb_page_free(
+		 &page,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Determines if a specific page is stored in the pages cache or the hot pages
+ * A page stored in the pages cache is resident in the page pool until it is freed
+ * Returns 1 if the page is cached, 0 if not or -1 on error
+ */
+int libesedb_io_handle_get_page_is_cached(
+     libesedb_io_handle_t *io_handle,
+     uint32_t page_number,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_io_handle_get_page_is_cached";
+	int hot_page_index    = 0;
+	int result            = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_number == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->hot_pages != NULL )
+	{
+		result = libesedb_hot_pages_get_index_by_page_number(
+		          io_handle->hot_pages,
+		          page_number,
+		          &hot_page_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve hot page: %" PRIu32 " index.",
+			 function,
+			 page_number );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			return( 1 );
+		}
+	}
+	if( io_handle->page_pool == NULL )
+	{
+		return( 0 );
+	}
+	result = libesedb_page_pool_get_page_is_resident(
+	          io_handle->page_pool,
+	          page_number,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if page: %" PRIu32 " is resident.",
 		 function,
-		 value_32bit );
+		 page_number );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Reads a range of consecutive pages and stores them in the pages cache
+ * Pages that are already stored in the pages cache are not read again,
+ * the other pages are read with a single read per run of consecutive pages
+ * Pages that cannot be read are skipped, these are read again when they are retrieved
+ * Returns 1 if successful, 0 if the pages are memory mapped or -1 on error
+ */
+int libesedb_io_handle_read_pages(
+     libesedb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfdata_vector_t *vector,
+     libfcache_cache_t *cache,
+     uint32_t page_number,
+     uint32_t number_of_pages,
+     libcerror_error_t **error )
+{
+	libesedb_page_t *page        = NULL;
+	static char *function        = "libesedb_io_handle_read_pages";
+	size_t pages_read_size       = 0;
+	ssize_t read_count           = 0;
+	off64_t file_offset          = 0;
+	uint32_t last_page_number    = 0;
+	uint32_t number_of_run_pages = 0;
+	uint32_t page_index          = 0;
+	uint32_t run_page_number     = 0;
+	int result                   = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->page_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - missing page size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page_number == 0 )
+	 || ( page_number > io_handle->last_page_number ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_pages == 0 )
+	 || ( number_of_pages > LIBESEDB_MAXIMUM_NUMBER_OF_BATCH_READ_PAGES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of pages value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->mapped_data != NULL )
+	{
+		return( 0 );
+	}
+	if( io_handle->hot_pages == NULL )
+	{
+		if( libesedb_io_handle_create_hot_pages(
+		     io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create hot pages.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( number_of_pages > ( io_handle->last_page_number - page_number + 1 ) )
+	{
+		number_of_pages = io_handle->last_page_number - page_number + 1;
+	}
+	last_page_number = page_number + number_of_pages - 1;
+
+	/* The buffer is retained by the IO handle to prevent an allocation per read
+	 */
+	if( io_handle->pages_read_buffer == NULL )
+	{
+		pages_read_size = (size_t) LIBESEDB_MAXIMUM_NUMBER_OF_BATCH_READ_PAGES * io_handle->page_size;
+
+		io_handle->pages_read_buffer = (uint8_t *) memory_allocate(
+		                                            sizeof( uint8_t ) * pages_read_size );
+
+		if( io_handle->pages_read_buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create pages read buffer.",
+			 function );
+
+			goto on_error;
+		}
+		io_handle->pages_read_buffer_size = pages_read_size;
+	}
+	while( page_number <= last_page_number )
+	{
+		/* Skip the pages that are already cached
+		 */
+		result = libesedb_io_handle_get_page_is_cached(
+		          io_handle,
+		          page_number,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if page: %" PRIu32 " is cached.",
+			 function,
+			 page_number );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			page_number++;
+
+			continue;
+		}
+		/* Determine the run of consecutive pages that are not cached
+		 */
+		run_page_number     = page_number;
+		number_of_run_pages = 1;
+
+		while( ( run_page_number + number_of_run_pages ) <= last_page_number )
+		{
+			result = libesedb_io_handle_get_page_is_cached(
+			          io_handle,
+			          run_page_number + number_of_run_pages,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine if page: %" PRIu32 " is cached.",
+				 function,
+				 run_page_number + number_of_run_pages );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				break;
+			}
+			number_of_run_pages++;
+		}
+		page_number += number_of_run_pages;
 
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (esedb_file_header_t *) file_header_data )->ecc_fix_error_count,
-		 value_32bit );
-		libcnotify_printf(
-		 "%s: ECC fix error count\t\t: %" PRIu32 "\n",
-		 function,
-		 value_32bit );
-		libesedb_debug_print_log_time(
-		 ( (esedb_file_header_t *) file_header_data )->ecc_fix_error_time,
-		 8,
-		 "ECC fix error time",
-		 "\t\t\t",
-		 NULL );
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (esedb_file_header_t *) file_header_data )->old_ecc_fix_error_count,
-		 value_32bit );
-		libcnotify_printf(
-		 "%s: old ECC fix error count\t\t: %" PRIu32 "\n",
-		 function,
-		 value_32bit );
+		file_offset  = run_page_number - 1;
+		file_offset *= io_handle->page_size;
+		file_offset += io_handle->pages_data_offset;
 
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (esedb_file_header_t *) file_header_data )->bad_checksum_error_count,
-		 value_32bit );
-		libcnotify_printf(
-		 "%s: bad checksum error count\t\t: %" PRIu32 "\n",
-		 function,
-		 value_32bit );
-		libesedb_debug_print_log_time(
-		 ( (esedb_file_header_t *) file_header_data )->bad_checksum_error_time,
-		 8,
-		 "bad checksum error time",
-		 "\t\t\t",
+		pages_read_size = (size_t) number_of_run_pages * io_handle->page_size;
+
+		if( pages_read_size > io_handle->pages_read_buffer_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid pages read size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		if( libbfio_handle_seek_offset(
+		     file_io_handle,
+		     file_offset,
+		     SEEK_SET,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek pages offset: %" PRIi64 ".",
+			 function,
+			 file_offset );
+
+			goto on_error;
+		}
+		read_count = libbfio_handle_read_buffer(
+		              file_io_handle,
+		              io_handle->pages_read_buffer,
+		              pages_read_size,
+		              error );
+
+		if( read_count != (ssize_t) pages_read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read pages data.",
+			 function );
+
+			goto on_error;
+		}
+		for( page_index = 0;
+		     page_index < number_of_run_pages;
+		     page_index++ )
+		{
+			if( libesedb_page_pool_get_page(
+			     io_handle->page_pool,
+			     &page,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve page from page pool.",
+				 function );
+
+				goto on_error;
+			}
+			if( libesedb_page_read_buffer(
+			     page,
+			     io_handle,
+			     file_offset,
+			     &( io_handle->pages_read_buffer[ page_index * io_handle->page_size ] ),
+			     io_handle->page_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read page: %" PRIu32 ".",
+				 function,
+				 run_page_number + page_index );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+#endif
+				libcerror_error_free(
+				 error );
+
+				libesedb_page_free(
+				 &page,
+				 NULL );
+			}
+			else
+			{
+				if( io_handle->hot_pages != NULL )
+				{
+					if( libesedb_hot_pages_admit_page(
+					     io_handle->hot_pages,
+					     run_page_number + page_index,
+					     page->data,
+					     page->data_size,
+					     error ) == -1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+						 "%s: unable to admit page: %" PRIu32 " to hot pages.",
+						 function,
+						 run_page_number + page_index );
+
+						goto on_error;
+					}
+				}
+				if( libfdata_vector_set_element_value_by_index(
+				     vector,
+				     (intptr_t *) file_io_handle,
+				     cache,
+				     (int) ( run_page_number - 1 + page_index ),
+				     (intptr_t *) page,
+				     (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_page_free,
+				     LIBFDATA_VECTOR_ELEMENT_VALUE_FLAG_MANAGED,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set page: %" PRIu32 " as element value.",
+					 function,
+					 run_page_number + page_index );
+
+					goto on_error;
+				}
+				if( libesedb_page_pool_set_page_resident(
+				     io_handle->page_pool,
+				     page,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set page: %" PRIu32 " resident.",
+					 function,
+					 run_page_number + page_index );
+
+					page = NULL;
+
+					goto on_error;
+				}
+				page = NULL;
+			}
+			file_offset += io_handle->page_size;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( page != NULL )
+	{
+		libesedb_page_free(
+		 &page,
 		 NULL );
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (esedb_file_header_t *) file_header_data )->old_bad_checksum_error_count,
-		 value_32bit );
-		libcnotify_printf(
-		 "%s: old bad checksum error count\t: %" PRIu32 "\n",
-		 function,
-		 value_32bit );
+	}
+	return( -1 );
+}
 
-		libcnotify_printf(
-		 "%s: committed log:\n",
+/* Verifies a range of pages
+ * The pages are read sequentially in batches without using the pages cache
+ * The status of each page is stored in pages_status, where the status of page
+ * number N is stored at index N - 1, pages_status can be NULL
+ * If abort is signalled the status of the remaining pages is set to not verified
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int libesedb_io_handle_verify_page_range(
+     libesedb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t first_page_number,
+     uint32_t last_page_number,
+     uint8_t *pages_status,
+     uint32_t *number_of_corrupted_pages,
+     libcerror_error_t **error )
+{
+	const uint8_t *page_data = NULL;
+	uint8_t *pages_data      = NULL;
+	static char *function    = "libesedb_io_handle_verify_page_range";
+	size_t pages_data_size   = 0;
+	ssize_t read_count       = 0;
+	off64_t file_offset      = 0;
+	uint32_t number_of_pages = 0;
+	uint32_t page_index      = 0;
+	uint32_t page_number     = 0;
+	uint8_t page_status      = 0;
+	int result               = 1;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
 		 function );
-		libcnotify_print_data(
-		 ( (esedb_file_header_t *) file_header_data )->committed_log,
-		 4,
-		 0 );
 
-		libcnotify_printf(
-		 "%s: previous shadow volume backup:\n",
+		return( -1 );
+	}
+	if( io_handle->page_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - missing page size.",
 		 function );
-		libcnotify_print_data(
-		 ( (esedb_file_header_t *) file_header_data )->previous_shadow_volume_backup,
-		 24,
-		 0 );
-		libcnotify_printf(
-		 "%s: previous differential backup:\n",
+
+		return( -1 );
+	}
+	if( ( first_page_number == 0 )
+	 || ( first_page_number > last_page_number )
+	 || ( last_page_number > io_handle->last_page_number ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page range value out of bounds.",
 		 function );
-		libcnotify_print_data(
-		 ( (esedb_file_header_t *) file_header_data )->previous_differential_backup,
-		 24,
-		 0 );
 
-		libcnotify_printf(
-		 "%s: unknown4:\n",
+		return( -1 );
+	}
+	if( number_of_corrupted_pages == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of corrupted pages.",
 		 function );
-		libcnotify_print_data(
-		 ( (esedb_file_header_t *) file_header_data )->unknown4,
-		 40,
-		 0 );
 
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (esedb_file_header_t *) file_header_data )->nls_major_version,
-		 value_32bit );
-		libcnotify_printf(
-		 "%s: NLS major version\t\t\t: 0x%08" PRIx32 "\n",
-		 function,
-		 value_32bit );
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (esedb_file_header_t *) file_header_data )->nls_minor_version,
-		 value_32bit );
-		libcnotify_printf(
-		 "%s: NLS minor version\t\t\t: 0x%08" PRIx32 "\n",
-		 function,
-		 value_32bit );
+		return( -1 );
+	}
+	*number_of_corrupted_pages = 0;
+
+	if( io_handle->mapped_data == NULL )
+	{
+		pages_data_size = (size_t) LIBESEDB_MAXIMUM_NUMBER_OF_BATCH_READ_PAGES * io_handle->page_size;
+
+		pages_data = (uint8_t *) memory_allocate(
+		                          sizeof( uint8_t ) * pages_data_size );
+
+		if( pages_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create pages data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	page_number = first_page_number;
+
+	while( page_number <= last_page_number )
+	{
+		if( io_handle->abort != 0 )
+		{
+			if( pages_status != NULL )
+			{
+				while( page_number <= last_page_number )
+				{
+					pages_status[ page_number - 1 ] = LIBESEDB_PAGE_STATUS_NOT_VERIFIED;
+
+					page_number++;
+				}
+			}
+			result = 0;
+
+			break;
+		}
+		number_of_pages = last_page_number - page_number + 1;
+
+		if( number_of_pages > LIBESEDB_MAXIMUM_NUMBER_OF_BATCH_READ_PAGES )
+		{
+			number_of_pages = LIBESEDB_MAXIMUM_NUMBER_OF_BATCH_READ_PAGES;
+		}
+		file_offset  = page_number - 1;
+		file_offset *= io_handle->page_size;
+		file_offset += io_handle->pages_data_offset;
+
+		if( io_handle->mapped_data != NULL )
+		{
+			read_count = 0;
+
+			if( (size64_t) file_offset < io_handle->mapped_data_size )
+			{
+				read_count = (ssize_t) ( io_handle->mapped_data_size - (size64_t) file_offset );
+
+				if( (size_t) read_count > ( (size_t) number_of_pages * io_handle->page_size ) )
+				{
+					read_count = (ssize_t) number_of_pages * io_handle->page_size;
+				}
+			}
+		}
+		else
+		{
+			/* Hint the next batch of pages while the current batch is verified
+			 */
+			if( ( page_number + number_of_pages ) <= last_page_number )
+			{
+				if( libesedb_io_handle_read_ahead_pages(
+				     io_handle,
+				     page_number + number_of_pages,
+				     LIBESEDB_MAXIMUM_NUMBER_OF_BATCH_READ_PAGES,
+				     error ) == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read-ahead pages.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			read_count = -1;
+
+			if( libbfio_handle_seek_offset(
+			     file_io_handle,
+			     file_offset,
+			     SEEK_SET,
+			     error ) != -1 )
+			{
+				read_count = libbfio_handle_read_buffer(
+				              file_io_handle,
+				              pages_data,
+				              (size_t) number_of_pages * io_handle->page_size,
+				              error );
+			}
+			/* A failed read is reported in the status of the pages
+			 */
+			if( read_count == -1 )
+			{
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+#endif
+				libcerror_error_free(
+				 error );
+
+				read_count = 0;
+			}
+		}
+		for( page_index = 0;
+		     page_index < number_of_pages;
+		     page_index++ )
+		{
+			if( (size_t) read_count < ( (size_t) ( page_index + 1 ) * io_handle->page_size ) )
+			{
+				page_status = LIBESEDB_PAGE_STATUS_UNREADABLE;
+			}
+			else
+			{
+				if( io_handle->mapped_data != NULL )
+				{
+					page_data = &( io_handle->mapped_data[ file_offset + ( page_index * io_handle->page_size ) ] );
+				}
+				else
+				{
+					page_data = &( pages_data[ page_index * io_handle->page_size ] );
+				}
+				if( libesedb_page_verify_data(
+				     io_handle,
+				     page_number + page_index,
+				     page_data,
+				     (size_t) io_handle->page_size,
+				     &page_status,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to verify page: %" PRIu32 ".",
+					 function,
+					 page_number + page_index );
+
+					goto on_error;
+				}
+			}
+			if( ( page_status != LIBESEDB_PAGE_STATUS_VALID )
+			 && ( page_status != LIBESEDB_PAGE_STATUS_EMPTY ) )
+			{
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "%s: page: %" PRIu32 " is corrupted (status: %" PRIu8 ").\n",
+					 function,
+					 page_number + page_index,
+					 page_status );
+				}
+#endif
+				*number_of_corrupted_pages += 1;
+			}
+			if( pages_status != NULL )
+			{
+				pages_status[ page_number + page_index - 1 ] = page_status;
+			}
+		}
+		page_number += number_of_pages;
+	}
+	if( pages_data != NULL )
+	{
+		memory_free(
+		 pages_data );
+	}
+	return( result );
+
+on_error:
+	if( pages_data != NULL )
+	{
+		memory_free(
+		 pages_data );
+	}
+	return( -1 );
+}
+
+/* Frees the verify pages workers
+ * The file IO handles of the workers are closed and freed
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_io_handle_free_verify_pages_workers(
+     libesedb_verify_pages_worker_t **workers,
+     int number_of_workers,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_io_handle_free_verify_pages_workers";
+	int result            = 1;
+	int worker_index      = 0;
+
+	if( workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid workers.",
+		 function );
+
+		return( -1 );
+	}
+	if( *workers != NULL )
+	{
+		for( worker_index = 0;
+		     worker_index < number_of_workers;
+		     worker_index++ )
+		{
+			if( ( *workers )[ worker_index ].file_io_handle != NULL )
+			{
+				if( libbfio_handle_is_open(
+				     ( *workers )[ worker_index ].file_io_handle,
+				     NULL ) == 1 )
+				{
+					if( libbfio_handle_close(
+					     ( *workers )[ worker_index ].file_io_handle,
+					     error ) != 0 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+						 "%s: unable to close file IO handle of worker: %d.",
+						 function,
+						 worker_index );
+
+						result = -1;
+					}
+				}
+				if( libbfio_handle_free(
+				     &( ( *workers )[ worker_index ].file_io_handle ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free file IO handle of worker: %d.",
+					 function,
+					 worker_index );
+
+					result = -1;
+				}
+			}
+			if( ( *workers )[ worker_index ].error != NULL )
+			{
+				libcerror_error_free(
+				 &( ( *workers )[ worker_index ].error ) );
+			}
+		}
+		memory_free(
+		 *workers );
+
+		*workers = NULL;
+	}
+	return( result );
+}
+
+/* Verifies the pages of a worker
+ * Callback function for the verify pages thread pool
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int libesedb_io_handle_verify_pages_worker_callback(
+     libesedb_verify_pages_worker_t *worker,
+     void *arguments LIBESEDB_ATTRIBUTE_UNUSED )
+{
+	LIBESEDB_UNREFERENCED_PARAMETER( arguments )
+
+	if( worker == NULL )
+	{
+		return( -1 );
+	}
+	worker->result = libesedb_io_handle_verify_page_range(
+	                  worker->io_handle,
+	                  worker->file_io_handle,
+	                  worker->first_page_number,
+	                  worker->last_page_number,
+	                  worker->pages_status,
+	                  &( worker->number_of_corrupted_pages ),
+	                  &( worker->error ) );
+
+	return( worker->result );
+}
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+
+/* Verifies the pages from the first to the last page number using a pool of workers
+ * The page range is split in consecutive parts of whole batches, one per worker,
+ * every worker reads its pages from the memory mapped data or from its own clone
+ * of the file IO handle, if the file IO handle cannot be cloned the pages are
+ * verified sequentially
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int libesedb_io_handle_verify_pages_with_workers(
+     libesedb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint8_t *pages_status,
+     int number_of_workers,
+     uint32_t *number_of_corrupted_pages,
+     libcerror_error_t **error )
+{
+	libcthreads_thread_pool_t *thread_pool  = NULL;
+	libesedb_verify_pages_worker_t *workers = NULL;
+	static char *function                   = "libesedb_io_handle_verify_pages_with_workers";
+	uint32_t number_of_batches              = 0;
+	uint32_t number_of_pages_per_worker     = 0;
+	int result                              = 1;
+	int worker_index                        = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
 
-		libcnotify_printf(
-		 "%s: unknown5:\n",
+		return( -1 );
+	}
+	if( number_of_workers <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of workers value out of bounds.",
 		 function );
-		libcnotify_print_data(
-		 ( (esedb_file_header_t *) file_header_data )->unknown5,
-		 148,
-		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
 
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (esedb_file_header_t *) file_header_data )->unknown_flags,
-		 value_32bit );
-		libcnotify_printf(
-		 "%s: unknown flags\t\t\t: 0x%08" PRIx32 " (%" PRIu32 ")\n",
-		 function,
-		 value_32bit,
-		 value_32bit );
+		return( -1 );
+	}
+	if( number_of_corrupted_pages == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of corrupted pages.",
+		 function );
 
-		libcnotify_printf(
-		 "\n" );
+		return( -1 );
 	}
-#endif
+	*number_of_corrupted_pages = 0;
 
-	memory_free(
-	 file_header_data );
+	number_of_batches = ( io_handle->last_page_number + LIBESEDB_MAXIMUM_NUMBER_OF_BATCH_READ_PAGES - 1 ) / LIBESEDB_MAXIMUM_NUMBER_OF_BATCH_READ_PAGES;
 
-	file_header_data = NULL;
+	workers = (libesedb_verify_pages_worker_t *) memory_allocate(
+	                                              sizeof( libesedb_verify_pages_worker_t ) * number_of_workers );
 
-	/* TODO add more values to internal structures */
+	if( workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create workers.",
+		 function );
 
-	if( file_offset == 0 )
+		return( -1 );
+	}
+	if( memory_set(
+	     workers,
+	     0,
+	     sizeof( libesedb_verify_pages_worker_t ) * number_of_workers ) == NULL )
 	{
-		io_handle->format_version           = format_version;
-		io_handle->format_revision          = format_revision;
-		io_handle->page_size                = page_size;
-		io_handle->creation_format_version  = creation_format_version;
-		io_handle->creation_format_revision = creation_format_revision;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear workers.",
+		 function );
+
+		memory_free(
+		 workers );
+
+		return( -1 );
 	}
-	else
+	number_of_pages_per_worker  = ( number_of_batches + number_of_workers - 1 ) / number_of_workers;
+	number_of_pages_per_worker *= LIBESEDB_MAXIMUM_NUMBER_OF_BATCH_READ_PAGES;
+
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
 	{
-		if( io_handle->format_version == 0 )
+		workers[ worker_index ].io_handle         = io_handle;
+		workers[ worker_index ].first_page_number = 1 + ( (uint32_t) worker_index * number_of_pages_per_worker );
+		workers[ worker_index ].pages_status      = pages_status;
+
+		if( workers[ worker_index ].first_page_number > io_handle->last_page_number )
 		{
-			io_handle->format_version = format_version;
+			number_of_workers = worker_index;
+
+			break;
 		}
-		else if( io_handle->format_version != format_version )
+		workers[ worker_index ].last_page_number = workers[ worker_index ].first_page_number + number_of_pages_per_worker - 1;
+
+		if( workers[ worker_index ].last_page_number > io_handle->last_page_number )
 		{
-#if defined( HAVE_VERBOSE_OUTPUT )
-			if( libcnotify_verbose != 0 )
+			workers[ worker_index ].last_page_number = io_handle->last_page_number;
+		}
+		/* The file IO handle cannot be shared between threads
+		 */
+		if( io_handle->mapped_data == NULL )
+		{
+			result = libbfio_handle_clone(
+			          &( workers[ worker_index ].file_io_handle ),
+			          file_io_handle,
+			          error );
+
+			if( result == 1 )
 			{
-				libcnotify_printf(
-				 "%s: mismatch in format version: 0x%" PRIx32 " and backup: 0x%" PRIx32 "\n",
-				 function,
-				 io_handle->format_version,
-				 io_handle->format_version );
+				result = libbfio_handle_is_open(
+				          workers[ worker_index ].file_io_handle,
+				          error );
+
+				if( result == 0 )
+				{
+					result = libbfio_handle_open(
+					          workers[ worker_index ].file_io_handle,
+					          LIBBFIO_OPEN_READ,
+					          error );
+				}
+			}
+			if( result != 1 )
+			{
+				break;
 			}
+		}
+	}
+	/* If the file IO handle cannot be cloned the pages are verified sequentially
+	 */
+	if( result != 1 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( ( libcnotify_verbose != 0 )
+		 && ( error != NULL )
+		 && ( *error != NULL ) )
+		{
+			libcnotify_print_error_backtrace(
+			 *error );
+		}
 #endif
+		libcerror_error_free(
+		 error );
+
+		if( libesedb_io_handle_free_verify_pages_workers(
+		     &workers,
+		     number_of_workers,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free workers.",
+			 function );
+
+			goto on_error;
 		}
-		if( io_handle->format_revision == 0 )
+		result = libesedb_io_handle_verify_page_range(
+		          io_handle,
+		          file_io_handle,
+		          1,
+		          io_handle->last_page_number,
+		          pages_status,
+		          number_of_corrupted_pages,
+		          error );
+
+		if( result == -1 )
 		{
-			io_handle->format_revision = format_revision;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to verify pages.",
+			 function );
+
+			goto on_error;
 		}
-		else if( io_handle->format_revision != format_revision )
+		return( result );
+	}
+	if( libcthreads_thread_pool_create(
+	     &thread_pool,
+	     NULL,
+	     number_of_workers,
+	     number_of_workers,
+	     (int (*)(intptr_t *, void *)) &libesedb_io_handle_verify_pages_worker_callback,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		if( libcthreads_thread_pool_push(
+		     thread_pool,
+		     (intptr_t *) &( workers[ worker_index ] ),
+		     error ) != 1 )
 		{
-#if defined( HAVE_VERBOSE_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: mismatch in format revision: 0x%" PRIx32 " and backup: 0x%" PRIx32 "\n",
-				 function,
-				 io_handle->format_revision,
-				 io_handle->format_revision );
-			}
-#endif
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push worker: %d onto thread pool.",
+			 function,
+			 worker_index );
+
+			goto on_error;
 		}
-		if( io_handle->page_size == 0 )
+	}
+	if( libcthreads_thread_pool_join(
+	     &thread_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	result = 1;
+
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		/* The pages of an aborted worker that were verified are counted
+		 */
+		if( workers[ worker_index ].result == 0 )
 		{
-			io_handle->page_size = page_size;
+			result = 0;
 		}
-		else if( io_handle->page_size != page_size )
+		else if( workers[ worker_index ].result != 1 )
 		{
-#if defined( HAVE_VERBOSE_OUTPUT )
-			if( libcnotify_verbose != 0 )
+			/* The error of the first failed worker is passed on
+			 */
+			if( ( error != NULL )
+			 && ( *error == NULL ) )
 			{
-				libcnotify_printf(
-				 "%s: mismatch in page size: 0x%04" PRIx32 " and backup: 0x%04" PRIx32 "\n",
-				 function,
-				 io_handle->page_size,
-				 page_size );
+				*error = workers[ worker_index ].error;
+
+				workers[ worker_index ].error = NULL;
 			}
-#endif
-			/* The offset of the backup (database) file header
-			 * is a good indication of the actual page size
-			 */
-			io_handle->page_size = (uint32_t) file_offset;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to verify pages: %" PRIu32 " to %" PRIu32 ".",
+			 function,
+			 workers[ worker_index ].first_page_number,
+			 workers[ worker_index ].last_page_number );
+
+			result = -1;
+
+			break;
 		}
+		*number_of_corrupted_pages += workers[ worker_index ].number_of_corrupted_pages;
 	}
-	return( 1 );
+	if( libesedb_io_handle_free_verify_pages_workers(
+	     &workers,
+	     number_of_workers,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free workers.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
 
 on_error:
-	if( file_header_data != NULL )
+	if( thread_pool != NULL )
 	{
-		memory_free(
-		 file_header_data );
+		libcthreads_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+	if( workers != NULL )
+	{
+		libesedb_io_handle_free_verify_pages_workers(
+		 &workers,
+		 number_of_workers,
+		 NULL );
 	}
 	return( -1 );
 }
 
-/* Reads a page
- * Callback function for the page vector
- * Returns 1 if successful or -1 on error
+#endif /* defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT ) */
+
+/* Verifies the pages from the first to the last page number
+ * If multi-threading is supported and the number of threads is more than 1 the pages
+ * are verified by a pool of at most number of threads workers, otherwise the pages
+ * are verified sequentially
+ * The status of each page is stored in pages_status, where the status of page
+ * number N is stored at index N - 1, pages_status can be NULL
+ * Returns 1 if successful, 0 if aborted or -1 on error
  */
-int libesedb_io_handle_read_page(
+int libesedb_io_handle_verify_pages(
      libesedb_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
-     libfdata_vector_t *vector,
-     libfcache_cache_t *cache,
-     int element_index,
-     int element_file_index LIBESEDB_ATTRIBUTE_UNUSED,
-     off64_t element_offset,
-     size64_t element_size LIBESEDB_ATTRIBUTE_UNUSED,
-     uint32_t element_flags LIBESEDB_ATTRIBUTE_UNUSED,
-     uint8_t read_flags LIBESEDB_ATTRIBUTE_UNUSED,
+     int number_of_threads,
+     uint8_t *pages_status,
+     size_t pages_status_size,
+     uint32_t *number_of_corrupted_pages,
      libcerror_error_t **error )
 {
-	libesedb_page_t *page = NULL;
-	static char *function = "libesedb_io_handle_read_page";
+	static char *function      = "libesedb_io_handle_verify_pages";
+	int result                 = 0;
 
-	LIBESEDB_UNREFERENCED_PARAMETER( element_file_index );
-	LIBESEDB_UNREFERENCED_PARAMETER( element_size );
-	LIBESEDB_UNREFERENCED_PARAMETER( element_flags );
-	LIBESEDB_UNREFERENCED_PARAMETER( read_flags );
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	uint32_t number_of_batches = 0;
+	int number_of_workers      = 0;
+#endif
 
-	if( libesedb_page_initialize(
-	     &page,
-	     error ) != 1 )
+	if( io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create page.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libesedb_page_read(
-	     page,
-	     io_handle,
-	     file_io_handle,
-	     element_offset,
-	     error ) != 1 )
+	if( number_of_threads < 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read page.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of threads value less than zero.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfdata_vector_set_element_value_by_index(
-	     vector,
-	     (intptr_t *) file_io_handle,
-	     cache,
-	     element_index,
-	     (intptr_t *) page,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_page_free,
-	     LIBFDATA_VECTOR_ELEMENT_VALUE_FLAG_MANAGED,
-	     error ) != 1 )
+	if( ( pages_status != NULL )
+	 && ( pages_status_size < (size_t) io_handle->last_page_number ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set page as element value.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid pages status size value too small.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	return( 1 );
+	if( number_of_corrupted_pages == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of corrupted pages.",
+		 function );
 
-on_error:
-	if( page != NULL )
+		return( -1 );
+	}
+	*number_of_corrupted_pages = 0;
+
+	if( io_handle->last_page_number == 0 )
 	{
-		libesedb_page_free(
-		 &page,
-		 NULL );
+		return( 1 );
 	}
-	return( -1 );
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	/* Every worker verifies at least one batch of pages
+	 */
+	number_of_batches = ( io_handle->last_page_number + LIBESEDB_MAXIMUM_NUMBER_OF_BATCH_READ_PAGES - 1 ) / LIBESEDB_MAXIMUM_NUMBER_OF_BATCH_READ_PAGES;
+
+	if( number_of_batches < (uint32_t) number_of_threads )
+	{
+		number_of_workers = (int) number_of_batches;
+	}
+	else
+	{
+		number_of_workers = number_of_threads;
+	}
+	if( number_of_workers > 1 )
+	{
+		result = libesedb_io_handle_verify_pages_with_workers(
+		          io_handle,
+		          file_io_handle,
+		          pages_status,
+		          number_of_workers,
+		          number_of_corrupted_pages,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to verify pages.",
+			 function );
+
+			return( -1 );
+		}
+		return( result );
+	}
+#endif /* defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT ) */
+
+	result = libesedb_io_handle_verify_page_range(
+	          io_handle,
+	          file_io_handle,
+	          1,
+	          io_handle->last_page_number,
+	          pages_status,
+	          number_of_corrupted_pages,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to verify pages.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
 }
 
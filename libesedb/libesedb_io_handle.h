@@ -25,8 +25,10 @@
 #include <common.h>
 #include <types.h>
 
+#include "libesedb_hot_pages.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
+#include "libesedb_libcthreads.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
 
@@ -76,6 +78,86 @@ struct libesedb_io_handle
 	 */
 	uint32_t last_page_number;
 
+	/* The memory mapped file data
+	 */
+	uint8_t *mapped_data;
+
+	/* The memory mapped file data size
+	 */
+	size64_t mapped_data_size;
+
+	/* The memory budget of the caches in bytes, 0 represents the default cache sizes
+	 */
+	size64_t memory_budget;
+
+	/* The tree values caches that share the memory budget
+	 */
+	libfcache_cache_t **tree_values_caches;
+
+	/* The number of tree values caches that share the memory budget
+	 */
+	int number_of_tree_values_caches;
+
+	/* The hot pages, the frequently used pages of the pages cache
+	 */
+	libesedb_hot_pages_t *hot_pages;
+
+	/* The file descriptor used to pass read-ahead hints, -1 if not available
+	 */
+	int read_ahead_file_descriptor;
+
+	/* The page pool
+	 */
+	struct libesedb_page_pool *page_pool;
+
+	/* The checksum policy
+	 */
+	int checksum_policy;
+
+	/* The bitmap of the pages of which the checksum was verified
+	 */
+	uint8_t *verified_pages_bitmap;
+
+	/* The verified pages bitmap size
+	 */
+	size_t verified_pages_bitmap_size;
+
+	/* The buffer used to read a range of consecutive pages
+	 */
+	uint8_t *pages_read_buffer;
+
+	/* The pages read buffer size
+	 */
+	size_t pages_read_buffer_size;
+
+	/* The bitmap of the pages of which the checksum did not match
+	 */
+	uint8_t *mismatched_pages_bitmap;
+
+	/* The mismatched pages bitmap size
+	 */
+	size_t mismatched_pages_bitmap_size;
+
+	/* The number of pages with a checksum mismatch
+	 */
+	uint32_t number_of_checksum_mismatches;
+
+	/* The checksum mismatch callback function
+	 */
+	void (*checksum_mismatch_callback)(
+	       uint32_t page_number,
+	       void *callback_data );
+
+	/* The checksum mismatch callback data
+	 */
+	void *checksum_mismatch_callback_data;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	/* The thread pool used to verify the page checksums in the background
+	 */
+	libcthreads_thread_pool_t *checksum_thread_pool;
+#endif
+
 	/* The codepage of the ASCII strings
 	 */
 	int ascii_codepage;
@@ -85,6 +167,68 @@ struct libesedb_io_handle
 	int abort;
 };
 
+typedef struct libesedb_checksum_verification libesedb_checksum_verification_t;
+
+struct libesedb_checksum_verification
+{
+	/* The IO handle
+	 */
+	libesedb_io_handle_t *io_handle;
+
+	/* The page number
+	 */
+	uint32_t page_number;
+
+	/* The page flags
+	 */
+	uint32_t page_flags;
+
+	/* The copy of the page data
+	 */
+	uint8_t *page_data;
+
+	/* The page data size
+	 */
+	size_t page_data_size;
+};
+
+typedef struct libesedb_verify_pages_worker libesedb_verify_pages_worker_t;
+
+struct libesedb_verify_pages_worker
+{
+	/* The IO handle
+	 */
+	libesedb_io_handle_t *io_handle;
+
+	/* The file IO handle of the worker, NULL if the file is memory mapped
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The first page number
+	 */
+	uint32_t first_page_number;
+
+	/* The last page number
+	 */
+	uint32_t last_page_number;
+
+	/* The pages status
+	 */
+	uint8_t *pages_status;
+
+	/* The number of corrupted pages
+	 */
+	uint32_t number_of_corrupted_pages;
+
+	/* The result of the worker
+	 */
+	int result;
+
+	/* The error of the worker
+	 */
+	libcerror_error_t *error;
+};
+
 int libesedb_io_handle_initialize(
      libesedb_io_handle_t **io_handle,
      libcerror_error_t **error );
@@ -97,6 +241,87 @@ int libesedb_io_handle_clear(
      libesedb_io_handle_t *io_handle,
      libcerror_error_t **error );
 
+int libesedb_io_handle_get_page_checksum_verified(
+     libesedb_io_handle_t *io_handle,
+     uint32_t page_number,
+     libcerror_error_t **error );
+
+int libesedb_io_handle_set_page_checksum_verified(
+     libesedb_io_handle_t *io_handle,
+     uint32_t page_number,
+     libcerror_error_t **error );
+
+int libesedb_io_handle_set_page_checksum_mismatch(
+     libesedb_io_handle_t *io_handle,
+     uint32_t page_number,
+     libcerror_error_t **error );
+
+int libesedb_io_handle_verify_page_checksums_callback(
+     libesedb_checksum_verification_t *checksum_verification,
+     void *arguments );
+
+int libesedb_io_handle_queue_page_checksum_verification(
+     libesedb_io_handle_t *io_handle,
+     uint32_t page_number,
+     uint32_t page_flags,
+     const uint8_t *page_data,
+     size_t page_data_size,
+     libcerror_error_t **error );
+
+int libesedb_io_handle_join_checksum_verification(
+     libesedb_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libesedb_io_handle_map_file(
+     libesedb_io_handle_t *io_handle,
+     const char *filename,
+     libcerror_error_t **error );
+
+int libesedb_io_handle_unmap_file(
+     libesedb_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libesedb_io_handle_open_read_ahead(
+     libesedb_io_handle_t *io_handle,
+     const char *filename,
+     libcerror_error_t **error );
+
+int libesedb_io_handle_close_read_ahead(
+     libesedb_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libesedb_io_handle_read_ahead_pages(
+     libesedb_io_handle_t *io_handle,
+     uint32_t page_number,
+     uint32_t number_of_pages,
+     libcerror_error_t **error );
+
+int libesedb_io_handle_get_maximum_number_of_cache_entries(
+     libesedb_io_handle_t *io_handle,
+     int cache_type,
+     int *maximum_number_of_cache_entries,
+     libcerror_error_t **error );
+
+int libesedb_io_handle_resize_tree_values_caches(
+     libesedb_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libesedb_io_handle_create_cache(
+     libesedb_io_handle_t *io_handle,
+     int cache_type,
+     libfcache_cache_t **cache,
+     libcerror_error_t **error );
+
+int libesedb_io_handle_free_cache(
+     libesedb_io_handle_t *io_handle,
+     int cache_type,
+     libfcache_cache_t **cache,
+     libcerror_error_t **error );
+
+int libesedb_io_handle_create_hot_pages(
+     libesedb_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
 int libesedb_io_handle_set_pages_data_range(
      libesedb_io_handle_t *io_handle,
      size64_t file_size,
@@ -121,6 +346,59 @@ int libesedb_io_handle_read_page(
      uint8_t read_flags,
      libcerror_error_t **error );
 
+int libesedb_io_handle_get_page_is_cached(
+     libesedb_io_handle_t *io_handle,
+     uint32_t page_number,
+     libcerror_error_t **error );
+
+int libesedb_io_handle_read_pages(
+     libesedb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfdata_vector_t *vector,
+     libfcache_cache_t *cache,
+     uint32_t page_number,
+     uint32_t number_of_pages,
+     libcerror_error_t **error );
+
+int libesedb_io_handle_verify_page_range(
+     libesedb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t first_page_number,
+     uint32_t last_page_number,
+     uint8_t *pages_status,
+     uint32_t *number_of_corrupted_pages,
+     libcerror_error_t **error );
+
+int libesedb_io_handle_free_verify_pages_workers(
+     libesedb_verify_pages_worker_t **workers,
+     int number_of_workers,
+     libcerror_error_t **error );
+
+int libesedb_io_handle_verify_pages_worker_callback(
+     libesedb_verify_pages_worker_t *worker,
+     void *arguments );
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+
+int libesedb_io_handle_verify_pages_with_workers(
+     libesedb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint8_t *pages_status,
+     int number_of_workers,
+     uint32_t *number_of_corrupted_pages,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT ) */
+
+int libesedb_io_handle_verify_pages(
+     libesedb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     int number_of_threads,
+     uint8_t *pages_status,
+     size_t pages_status_size,
+     uint32_t *number_of_corrupted_pages,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <memory.h>
 #include <types.h>
 
@@ -139,6 +140,7 @@ int libesedb_key_free(
 }
 
 /* Sets the data
+ * Existing data is replaced, so that a key can be reused
  * Returns 1 if successful or -1 on error
  */
 int libesedb_key_set_data(
@@ -160,17 +162,6 @@ int libesedb_key_set_data(
 
 		return( -1 );
 	}
-	if( key->data != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid key - data already set.",
-		 function );
-
-		return( -1 );
-	}
 	if( data == NULL )
 	{
 		libcerror_error_set(
@@ -193,6 +184,15 @@ int libesedb_key_set_data(
 
 		return( -1 );
 	}
+	if( key->data != NULL )
+	{
+		memory_free(
+		 key->data );
+
+		key->data = NULL;
+	}
+	key->data_size = 0;
+
 	if( data_size > 0 )
 	{
 		key->data = (uint8_t *) memory_allocate(
@@ -670,3 +670,390 @@ fprintf( stderr, "MARKER\n" );
 	return( result );
 }
 
+/* Compares the data of two keys
+ * The data is compared byte by byte, a key that is a prefix of the other key is less
+ * Unlike libesedb_key_compare the type of the keys is not taken into account
+ * Returns LIBFDATA_COMPARE_LESS, LIBFDATA_COMPARE_EQUAL, LIBFDATA_COMPARE_GREATER if successful or -1 on error
+ */
+int libesedb_key_compare_data(
+     libesedb_key_t *first_key,
+     libesedb_key_t *second_key,
+     libcerror_error_t **error )
+{
+	static char *function    = "libesedb_key_compare_data";
+	size_t compare_data_size = 0;
+	int result               = 0;
+
+	if( first_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first key.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( first_key->data == NULL )
+	 && ( first_key->data_size > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid first key - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second key.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( second_key->data == NULL )
+	 && ( second_key->data_size > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid second key - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_key->data_size <= second_key->data_size )
+	{
+		compare_data_size = first_key->data_size;
+	}
+	else
+	{
+		compare_data_size = second_key->data_size;
+	}
+	if( compare_data_size > 0 )
+	{
+		result = memory_compare(
+		          first_key->data,
+		          second_key->data,
+		          compare_data_size );
+	}
+	if( result < 0 )
+	{
+		return( LIBFDATA_COMPARE_LESS );
+	}
+	else if( result > 0 )
+	{
+		return( LIBFDATA_COMPARE_GREATER );
+	}
+	else if( first_key->data_size < second_key->data_size )
+	{
+		return( LIBFDATA_COMPARE_LESS );
+	}
+	else if( first_key->data_size > second_key->data_size )
+	{
+		return( LIBFDATA_COMPARE_GREATER );
+	}
+	return( LIBFDATA_COMPARE_EQUAL );
+}
+
+/* Retrieves the value data of a specific segment of a normalized key
+ * The segments are normalized column values of the key columns, each with a leading prefix byte,
+ * where the bytes of the segment of a descending key column are complemented
+ * Only values of fixed size column types can be decoded, hence the segment must
+ * be preceded by segments that are either fixed size or do not contain a value
+ * The value data is stored in the same byte order as the record value data
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libesedb_key_get_segment_value_data(
+     libesedb_key_t *key,
+     const uint32_t *segment_column_types,
+     int number_of_segments,
+     int segment_index,
+     uint8_t *value_data,
+     size_t value_data_size,
+     libcerror_error_t **error )
+{
+	uint8_t segment_data[ 8 ];
+
+	static char *function     = "libesedb_key_get_segment_value_data";
+	size_t key_data_offset    = 0;
+	size_t segment_data_index = 0;
+	size_t segment_data_size  = 0;
+	uint64_t value_64bit      = 0;
+	uint32_t value_32bit      = 0;
+	uint16_t value_16bit      = 0;
+	uint8_t is_descending     = 0;
+	uint8_t prefix            = 0;
+	int key_segment_index     = 0;
+
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key->data == NULL )
+	 && ( key->data_size > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid key - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_column_types == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment column types.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( segment_index < 0 )
+	 || ( segment_index >= number_of_segments ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid segment index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid value data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	for( key_segment_index = 0;
+	     key_segment_index <= segment_index;
+	     key_segment_index++ )
+	{
+		/* The key can be truncated
+		 */
+		if( key_data_offset >= key->data_size )
+		{
+			return( 0 );
+		}
+		prefix = key->data[ key_data_offset ];
+
+		switch( prefix )
+		{
+			case 0x00:
+			case 0x40:
+			case 0x7f:
+			case 0xc0:
+				is_descending = 0;
+				break;
+
+			case 0x3f:
+			case 0x80:
+			case 0xbf:
+			case 0xff:
+				is_descending = 1;
+
+				prefix ^= 0xff;
+				break;
+
+			default:
+				return( 0 );
+		}
+		switch( segment_column_types[ key_segment_index ] )
+		{
+			case LIBESEDB_COLUMN_TYPE_BOOLEAN:
+			case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
+				segment_data_size = 1;
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+			case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
+				segment_data_size = 2;
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
+			case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
+			case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
+				segment_data_size = 4;
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_CURRENCY:
+			case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
+			case LIBESEDB_COLUMN_TYPE_DATE_TIME:
+			case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
+				segment_data_size = 8;
+				break;
+
+			default:
+				segment_data_size = 0;
+				break;
+		}
+		key_data_offset += 1;
+
+		/* A segment without a value consists of the prefix only
+		 */
+		if( prefix != 0x7f )
+		{
+			if( key_segment_index == segment_index )
+			{
+				return( 0 );
+			}
+			continue;
+		}
+		/* The size of the segment of a variable size or unsupported column type is not known
+		 */
+		if( segment_data_size == 0 )
+		{
+			return( 0 );
+		}
+		if( segment_data_size > ( key->data_size - key_data_offset ) )
+		{
+			return( 0 );
+		}
+		if( key_segment_index < segment_index )
+		{
+			key_data_offset += segment_data_size;
+		}
+	}
+	if( value_data_size < segment_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid value data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	for( segment_data_index = 0;
+	     segment_data_index < segment_data_size;
+	     segment_data_index++ )
+	{
+		segment_data[ segment_data_index ] = key->data[ key_data_offset + segment_data_index ];
+
+		if( is_descending != 0 )
+		{
+			segment_data[ segment_data_index ] ^= 0xff;
+		}
+	}
+	/* Integer values are stored big-endian, signed integer values with the sign bit flipped,
+	 * floating point values with the sign bit flipped if positive or all bits flipped if negative
+	 */
+	switch( segment_column_types[ segment_index ] )
+	{
+		case LIBESEDB_COLUMN_TYPE_BOOLEAN:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
+			value_data[ 0 ] = segment_data[ 0 ];
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
+			byte_stream_copy_to_uint16_big_endian(
+			 segment_data,
+			 value_16bit );
+
+			if( segment_column_types[ segment_index ] == LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED )
+			{
+				value_16bit ^= 0x8000;
+			}
+			byte_stream_copy_from_uint16_little_endian(
+			 value_data,
+			 value_16bit );
+
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
+		case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
+			byte_stream_copy_to_uint32_big_endian(
+			 segment_data,
+			 value_32bit );
+
+			if( segment_column_types[ segment_index ] == LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED )
+			{
+				value_32bit ^= 0x80000000UL;
+			}
+			else if( segment_column_types[ segment_index ] == LIBESEDB_COLUMN_TYPE_FLOAT_32BIT )
+			{
+				if( ( value_32bit & 0x80000000UL ) != 0 )
+				{
+					value_32bit ^= 0x80000000UL;
+				}
+				else
+				{
+					value_32bit ^= 0xffffffffUL;
+				}
+			}
+			byte_stream_copy_from_uint32_little_endian(
+			 value_data,
+			 value_32bit );
+
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_CURRENCY:
+		case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
+		case LIBESEDB_COLUMN_TYPE_DATE_TIME:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
+			byte_stream_copy_to_uint64_big_endian(
+			 segment_data,
+			 value_64bit );
+
+			if( ( segment_column_types[ segment_index ] == LIBESEDB_COLUMN_TYPE_CURRENCY )
+			 || ( segment_column_types[ segment_index ] == LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED ) )
+			{
+				value_64bit ^= 0x8000000000000000ULL;
+			}
+			else if( ( value_64bit & 0x8000000000000000ULL ) != 0 )
+			{
+				value_64bit ^= 0x8000000000000000ULL;
+			}
+			else
+			{
+				value_64bit ^= 0xffffffffffffffffULL;
+			}
+			byte_stream_copy_from_uint64_little_endian(
+			 value_data,
+			 value_64bit );
+
+			break;
+	}
+	return( 1 );
+}
+
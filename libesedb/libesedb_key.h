@@ -73,6 +73,20 @@ int libesedb_key_compare(
      libesedb_key_t *second_key,
      libcerror_error_t **error );
 
+int libesedb_key_compare_data(
+     libesedb_key_t *first_key,
+     libesedb_key_t *second_key,
+     libcerror_error_t **error );
+
+int libesedb_key_get_segment_value_data(
+     libesedb_key_t *key,
+     const uint32_t *segment_column_types,
+     int number_of_segments,
+     int segment_index,
+     uint8_t *value_data,
+     size_t value_data_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
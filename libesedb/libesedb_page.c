@@ -28,70 +28,70 @@
 #include "libesedb_debug.h"
 #include "libesedb_definitions.h"
 #include "libesedb_libbfio.h"
-#include "libesedb_libcdata.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libcnotify.h"
 #include "libesedb_page.h"
+#include "libesedb_page_pool.h"
 #include "libesedb_page_value.h"
 
 #include "esedb_page.h"
 
-/* Creates a page tags value
- * Make sure the value page_tags_value is referencing, is set to NULL
+/* Creates a page
+ * Make sure the value page is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
  */
-int libesedb_page_tags_value_initialize(
-     libesedb_page_tags_value_t **page_tags_value,
+int libesedb_page_initialize(
+     libesedb_page_t **page,
      libcerror_error_t **error )
 {
-	static char *function = "libesedb_page_tags_value_initialize";
+	static char *function = "libesedb_page_initialize";
 
-	if( page_tags_value == NULL )
+	if( page == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid page tags value.",
+		 "%s: invalid page.",
 		 function );
 
 		return( -1 );
 	}
-	if( *page_tags_value != NULL )
+	if( *page != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid page tags value value already set.",
+		 "%s: invalid page value already set.",
 		 function );
 
 		return( -1 );
 	}
-	*page_tags_value = memory_allocate_structure(
-	                    libesedb_page_tags_value_t );
+	*page = memory_allocate_structure(
+	         libesedb_page_t );
 
-	if( *page_tags_value == NULL )
+	if( *page == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_MEMORY,
 		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create page tags value.",
+		 "%s: unable to create page.",
 		 function );
 
 		goto on_error;
 	}
 	if( memory_set(
-	     *page_tags_value,
+	     *page,
 	     0,
-	     sizeof( libesedb_page_tags_value_t ) ) == NULL )
+	     sizeof( libesedb_page_t ) ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_MEMORY,
 		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear page tags value.",
+		 "%s: unable to clear page.",
 		 function );
 
 		goto on_error;
@@ -99,55 +99,84 @@ int libesedb_page_tags_value_initialize(
 	return( 1 );
 
 on_error:
-	if( *page_tags_value != NULL )
+	if( *page != NULL )
 	{
 		memory_free(
-		 *page_tags_value );
+		 *page );
 
-		*page_tags_value = NULL;
+		*page = NULL;
 	}
 	return( -1 );
 }
 
-/* Frees a page tags value
+/* Frees a page
+ * A pooled page is returned to its page pool
  * Returns 1 if successful or -1 on error
  */
-int libesedb_page_tags_value_free(
-     libesedb_page_tags_value_t **page_tags_value,
+int libesedb_page_free(
+     libesedb_page_t **page,
      libcerror_error_t **error )
 {
-	static char *function = "libesedb_page_tags_value_free";
+	static char *function = "libesedb_page_free";
 
-	if( page_tags_value == NULL )
+	if( page == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid page tags value.",
+		 "%s: invalid page.",
 		 function );
 
 		return( -1 );
 	}
-	if( *page_tags_value != NULL )
+	if( *page != NULL )
 	{
+		if( ( *page )->page_pool != NULL )
+		{
+			if( libesedb_page_pool_release_page(
+			     ( *page )->page_pool,
+			     page,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release page to page pool.",
+				 function );
+
+				return( -1 );
+			}
+			return( 1 );
+		}
+		if( ( *page )->values != NULL )
+		{
+			memory_free(
+			 ( *page )->values );
+		}
+		if( ( *page )->data_buffer != NULL )
+		{
+			memory_free(
+			 ( *page )->data_buffer );
+		}
 		memory_free(
-		 *page_tags_value );
+		 *page );
 
-		*page_tags_value = NULL;
+		*page = NULL;
 	}
 	return( 1 );
 }
 
-/* Creates a page
- * Make sure the value page is referencing, is set to NULL
+/* Clears a page for reuse
+ * The page data buffer and the page values are retained
  * Returns 1 if successful or -1 on error
  */
-int libesedb_page_initialize(
-     libesedb_page_t **page,
+int libesedb_page_clear(
+     libesedb_page_t *page,
      libcerror_error_t **error )
 {
-	static char *function = "libesedb_page_initialize";
+	static char *function = "libesedb_page_clear";
 
 	if( page == NULL )
 	{
@@ -160,55 +189,289 @@ int libesedb_page_initialize(
 
 		return( -1 );
 	}
-	if( *page != NULL )
+	page->page_number                        = 0;
+	page->previous_page_number               = 0;
+	page->next_page_number                   = 0;
+	page->father_data_page_object_identifier = 0;
+	page->flags                              = 0;
+	page->data                               = NULL;
+	page->data_size                          = 0;
+	page->data_is_mapped                     = 0;
+	page->offset                             = 0;
+	page->values_data_offset                 = 0;
+	page->number_of_values                   = 0;
+	page->has_extended_page_header           = 0;
+
+	return( 1 );
+}
+
+/* Reads a page and its values
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_read(
+     libesedb_page_t *page,
+     libesedb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	static char *function           = "libesedb_page_read";
+	ssize_t read_count              = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	uint32_t calculated_page_number = 0;
+#endif
+
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( page->data != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid page value already set.",
+		 "%s: invalid page data already set.",
 		 function );
 
 		return( -1 );
 	}
-	*page = memory_allocate_structure(
-	         libesedb_page_t );
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
 
-	if( *page == NULL )
+		return( -1 );
+	}
+	page->offset = file_offset;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		calculated_page_number = (uint32_t) ( ( file_offset - io_handle->page_size ) / io_handle->page_size );
+
+		libcnotify_printf(
+		 "%s: reading page: %" PRIu32 " at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+		 function,
+		 calculated_page_number,
+		 page->offset,
+		 page->offset );
+	}
+#endif
+	if( ( io_handle->mapped_data != NULL )
+	 && ( file_offset >= 0 )
+	 && ( (size64_t) file_offset < io_handle->mapped_data_size )
+	 && ( (size64_t) io_handle->page_size <= ( io_handle->mapped_data_size - (size64_t) file_offset ) ) )
+	{
+		/* The page data references the memory mapping and is not copied
+		 */
+		page->data           = &( io_handle->mapped_data[ file_offset ] );
+		page->data_size      = (size_t) io_handle->page_size;
+		page->data_is_mapped = 1;
+	}
+	else
+	{
+		if( libbfio_handle_seek_offset(
+		     file_io_handle,
+		     page->offset,
+		     SEEK_SET,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek page offset: %" PRIi64 ".",
+			 function,
+			 page->offset );
+
+			goto on_error;
+		}
+		if( libesedb_page_resize_data_buffer(
+		     page,
+		     (size_t) io_handle->page_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize page data buffer.",
+			 function );
+
+			goto on_error;
+		}
+		page->data           = page->data_buffer;
+		page->data_size      = (size_t) io_handle->page_size;
+		page->data_is_mapped = 0;
+
+		read_count = libbfio_handle_read_buffer(
+		              file_io_handle,
+		              page->data,
+		              page->data_size,
+		              error );
+
+		if( read_count != (ssize_t) page->data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read page data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libesedb_page_read_page_data(
+	     page,
+	     io_handle,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create page.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read page data.",
 		 function );
 
 		goto on_error;
 	}
-	if( memory_set(
-	     *page,
-	     0,
-	     sizeof( libesedb_page_t ) ) == NULL )
+	return( 1 );
+
+on_error:
+	page->data           = NULL;
+	page->data_size      = 0;
+	page->data_is_mapped = 0;
+
+	return( -1 );
+}
+
+/* Reads a page from a buffer
+ * The page data is copied from the buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_read_buffer(
+     libesedb_page_t *page,
+     libesedb_io_handle_t *io_handle,
+     off64_t file_offset,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_page_read_buffer";
+
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( page->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid page data already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size < (size_t) io_handle->page_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid buffer size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	page->offset = file_offset;
+
+	if( libesedb_page_resize_data_buffer(
+	     page,
+	     (size_t) io_handle->page_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize page data buffer.",
+		 function );
+
+		goto on_error;
+	}
+	page->data           = page->data_buffer;
+	page->data_size      = (size_t) io_handle->page_size;
+	page->data_is_mapped = 0;
+
+	if( memory_copy(
+	     page->data,
+	     buffer,
+	     page->data_size ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear page.",
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy page data.",
 		 function );
 
 		goto on_error;
 	}
-	if( libcdata_array_initialize(
-	     &( ( *page )->values_array ),
-	     0,
+	if( libesedb_page_read_page_data(
+	     page,
+	     io_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create page values array.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read page data.",
 		 function );
 
 		goto on_error;
@@ -216,94 +479,445 @@ int libesedb_page_initialize(
 	return( 1 );
 
 on_error:
-	if( *page != NULL )
-	{
-		memory_free(
-		 *page );
+	page->data      = NULL;
+	page->data_size = 0;
 
-		*page = NULL;
-	}
 	return( -1 );
 }
 
-/* Frees a page
- * Returns 1 if successful or -1 on error
+/* Verifies the checksums of the page data
+ * Pages with an extended page header have a checksum per block of 1/4 of the page,
+ * the checksum of the first block is stored in the page header and the checksums
+ * of the other blocks in the extended page header
+ * Returns 1 if the checksums match, 0 if not or -1 on error
  */
-int libesedb_page_free(
-     libesedb_page_t **page,
+int libesedb_page_verify_checksums(
+     libesedb_io_handle_t *io_handle,
+     uint32_t page_number,
+     uint32_t page_flags,
+     const uint8_t *page_data,
+     size_t page_data_size,
      libcerror_error_t **error )
 {
-	static char *function = "libesedb_page_free";
-	int result            = 1;
+	const uint8_t *checksum_block_data = NULL;
+	static char *function              = "libesedb_page_verify_checksums";
+	size_t checksum_block_size         = 0;
+	uint32_t calculated_ecc32_checksum = 0;
+	uint32_t calculated_xor32_checksum = 0;
+	uint32_t stored_ecc32_checksum     = 0;
+	uint32_t stored_xor32_checksum     = 0;
+	uint8_t checksum_block_index       = 0;
+	uint8_t number_of_checksum_blocks  = 1;
+	int result                         = 1;
 
-	if( page == NULL )
+	if( io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid page.",
+		 "%s: invalid IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( *page != NULL )
+	if( page_data == NULL )
 	{
-		if( libcdata_array_free(
-		     &( ( *page )->values_array ),
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_page_value_free,
-		     error ) != 1 )
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page_data_size < sizeof( esedb_page_header_t ) )
+	 || ( page_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
+	 && ( io_handle->page_size >= 16384 ) )
+	{
+		if( page_data_size < ( sizeof( esedb_page_header_t ) + sizeof( esedb_extended_page_header_t ) ) )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free the page values array.",
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid page data size value out of bounds.",
 			 function );
 
-			result = -1;
+			return( -1 );
 		}
-		if( ( *page )->data != NULL )
+		number_of_checksum_blocks = 4;
+	}
+	checksum_block_size = page_data_size / number_of_checksum_blocks;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_page_header_t *) page_data )->xor_checksum,
+	 stored_xor32_checksum );
+
+	for( checksum_block_index = 0;
+	     checksum_block_index < number_of_checksum_blocks;
+	     checksum_block_index++ )
+	{
+		if( number_of_checksum_blocks > 1 )
 		{
-			memory_free(
-			 ( *page )->data );
+			checksum_block_data = &( page_data[ checksum_block_index * checksum_block_size ] );
+
+			if( checksum_block_index == 0 )
+			{
+				byte_stream_copy_to_uint32_little_endian(
+				 ( (esedb_page_header_t *) page_data )->ecc_checksum,
+				 stored_ecc32_checksum );
+			}
+			else
+			{
+				byte_stream_copy_to_uint32_little_endian(
+				 &( page_data[ sizeof( esedb_page_header_t ) + ( ( checksum_block_index - 1 ) * 8 ) ] ),
+				 stored_xor32_checksum );
+
+				byte_stream_copy_to_uint32_little_endian(
+				 &( page_data[ sizeof( esedb_page_header_t ) + ( ( checksum_block_index - 1 ) * 8 ) + 4 ] ),
+				 stored_ecc32_checksum );
+			}
+			if( libesedb_checksum_calculate_little_endian_ecc32(
+			     &calculated_ecc32_checksum,
+			     &calculated_xor32_checksum,
+			     checksum_block_data,
+			     checksum_block_size,
+			     ( checksum_block_index == 0 ) ? 8 : 0,
+			     page_number,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unable to calculate ECC-32 and XOR-32 checksum of block: %" PRIu8 ".",
+				 function,
+				 checksum_block_index );
+
+				return( -1 );
+			}
 		}
-		memory_free(
-		 *page );
+		else if( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_NEW_RECORD_FORMAT )
+		      && ( ( page_flags & LIBESEDB_PAGE_FLAG_IS_NEW_RECORD_FORMAT ) != 0 ) )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (esedb_page_header_t *) page_data )->ecc_checksum,
+			 stored_ecc32_checksum );
 
-		*page = NULL;
+			if( libesedb_checksum_calculate_little_endian_ecc32(
+			     &calculated_ecc32_checksum,
+			     &calculated_xor32_checksum,
+			     page_data,
+			     page_data_size,
+			     8,
+			     page_number,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unable to calculate ECC-32 and XOR-32 checksum.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			if( libesedb_checksum_calculate_little_endian_xor32(
+			     &calculated_xor32_checksum,
+			     &( page_data[ 4 ] ),
+			     page_data_size - 4,
+			     0x89abcdef,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unable to calculate XOR-32 checksum.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( stored_xor32_checksum != calculated_xor32_checksum )
+		{
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: mismatch in page: %" PRIu32 " block: %" PRIu8 " XOR-32 checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).\n",
+				 function,
+				 page_number,
+				 checksum_block_index,
+				 stored_xor32_checksum,
+				 calculated_xor32_checksum );
+			}
+			result = 0;
+		}
+		if( stored_ecc32_checksum != calculated_ecc32_checksum )
+		{
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: mismatch in page: %" PRIu32 " block: %" PRIu8 " ECC-32 checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).\n",
+				 function,
+				 page_number,
+				 checksum_block_index,
+				 stored_ecc32_checksum,
+				 calculated_ecc32_checksum );
+			}
+			result = 0;
+		}
 	}
 	return( result );
 }
 
-/* Reads a page and its values
+/* Verifies the page data without reading the page values
+ * Sets the page status to one of the LIBESEDB_PAGE_STATUS values
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_verify_data(
+     libesedb_io_handle_t *io_handle,
+     uint32_t page_number,
+     const uint8_t *page_data,
+     size_t page_data_size,
+     uint8_t *page_status,
+     libcerror_error_t **error )
+{
+	const uint8_t *page_tags_data  = NULL;
+	static char *function          = "libesedb_page_verify_data";
+	size_t data_offset             = 0;
+	size_t page_headers_size       = 0;
+	size_t page_values_data_size   = 0;
+	uint64_t stored_page_number    = 0;
+	uint32_t page_flags            = 0;
+	uint16_t available_page_tag    = 0;
+	uint16_t page_tag_offset       = 0;
+	uint16_t page_tag_size         = 0;
+	uint16_t page_tags_index       = 0;
+	uint8_t has_stored_page_number = 0;
+	int result                     = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page data.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid page data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_status == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page status.",
+		 function );
+
+		return( -1 );
+	}
+	page_headers_size = sizeof( esedb_page_header_t );
+
+	if( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
+	 && ( io_handle->page_size >= 16384 ) )
+	{
+		page_headers_size += sizeof( esedb_extended_page_header_t );
+	}
+	if( page_data_size < page_headers_size )
+	{
+		*page_status = LIBESEDB_PAGE_STATUS_INVALID_HEADER;
+
+		return( 1 );
+	}
+	/* Pages that were never written to are filled with 0-byte values
+	 */
+	for( data_offset = 0;
+	     data_offset < page_data_size;
+	     data_offset++ )
+	{
+		if( page_data[ data_offset ] != 0 )
+		{
+			break;
+		}
+	}
+	if( data_offset >= page_data_size )
+	{
+		*page_status = LIBESEDB_PAGE_STATUS_EMPTY;
+
+		return( 1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_page_header_t *) page_data )->page_flags,
+	 page_flags );
+
+	result = libesedb_page_verify_checksums(
+	          io_handle,
+	          page_number,
+	          page_flags,
+	          page_data,
+	          page_data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to verify page checksums.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		*page_status = LIBESEDB_PAGE_STATUS_CHECKSUM_MISMATCH;
+
+		return( 1 );
+	}
+	if( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
+	 && ( io_handle->page_size >= 16384 ) )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (esedb_extended_page_header_t *) &( page_data[ sizeof( esedb_page_header_t ) ] ) )->page_number,
+		 stored_page_number );
+
+		has_stored_page_number = 1;
+	}
+	else if( ( io_handle->format_revision < LIBESEDB_FORMAT_REVISION_NEW_RECORD_FORMAT )
+	      || ( ( page_flags & LIBESEDB_PAGE_FLAG_IS_NEW_RECORD_FORMAT ) == 0 ) )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (esedb_page_header_t *) page_data )->page_number,
+		 stored_page_number );
+
+		has_stored_page_number = 1;
+	}
+	if( ( has_stored_page_number != 0 )
+	 && ( stored_page_number != (uint64_t) page_number ) )
+	{
+		*page_status = LIBESEDB_PAGE_STATUS_PAGE_NUMBER_MISMATCH;
+
+		return( 1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (esedb_page_header_t *) page_data )->available_page_tag,
+	 available_page_tag );
+
+	page_values_data_size = page_data_size - page_headers_size;
+
+	if( ( 4 * (size_t) available_page_tag ) > page_values_data_size )
+	{
+		*page_status = LIBESEDB_PAGE_STATUS_INVALID_HEADER;
+
+		return( 1 );
+	}
+	/* The page tags are stored back to front at the end of the page
+	 */
+	page_tags_data = &( page_data[ page_data_size - 2 ] );
+
+	for( page_tags_index = 0;
+	     page_tags_index < available_page_tag;
+	     page_tags_index++ )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 page_tags_data,
+		 page_tag_offset );
+
+		page_tags_data -= 2;
+
+		byte_stream_copy_to_uint16_little_endian(
+		 page_tags_data,
+		 page_tag_size );
+
+		page_tags_data -= 2;
+
+		if( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
+		 && ( io_handle->page_size >= 16384 ) )
+		{
+			page_tag_offset &= 0x7fff;
+			page_tag_size   &= 0x7fff;
+		}
+		else
+		{
+			page_tag_offset &= 0x1fff;
+			page_tag_size   &= 0x1fff;
+		}
+		if( ( (size_t) page_tag_offset > page_values_data_size )
+		 || ( (size_t) page_tag_size > ( page_values_data_size - page_tag_offset ) ) )
+		{
+			*page_status = LIBESEDB_PAGE_STATUS_INVALID_PAGE_TAGS;
+
+			return( 1 );
+		}
+	}
+	*page_status = LIBESEDB_PAGE_STATUS_VALID;
+
+	return( 1 );
+}
+
+/* Reads the page header, tags and values from the page data
  * Returns 1 if successful or -1 on error
  */
-int libesedb_page_read(
+int libesedb_page_read_page_data(
      libesedb_page_t *page,
      libesedb_io_handle_t *io_handle,
-     libbfio_handle_t *file_io_handle,
-     off64_t file_offset,
      libcerror_error_t **error )
 {
-	libcdata_array_t *page_tags_array  = NULL;
-	uint8_t *page_values_data          = NULL;
-	static char *function              = "libesedb_page_read";
-	size_t page_values_data_offset     = 0;
-	size_t page_values_data_size       = 0;
-	ssize_t read_count                 = 0;
-	uint32_t calculated_ecc32_checksum = 0;
-	uint32_t calculated_page_number    = 0;
-	uint32_t calculated_xor32_checksum = 0;
-	uint32_t stored_ecc32_checksum     = 0;
-	uint32_t stored_page_number        = 0;
-	uint32_t stored_xor32_checksum     = 0;
-	uint16_t available_data_size       = 0;
-	uint16_t available_page_tag        = 0;
+	uint8_t *page_values_data       = NULL;
+	static char *function           = "libesedb_page_read_page_data";
+	size_t page_values_data_offset  = 0;
+	size_t page_values_data_size    = 0;
+	uint32_t calculated_page_number = 0;
+	uint16_t available_data_size    = 0;
+	uint16_t available_page_tag     = 0;
+	int result                      = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
-	uint64_t value_64bit               = 0;
-	uint16_t value_16bit               = 0;
+	uint64_t value_64bit            = 0;
+	uint32_t value_32bit            = 0;
+	uint16_t value_16bit            = 0;
 #endif
 
 	if( page == NULL )
@@ -317,92 +931,41 @@ int libesedb_page_read(
 
 		return( -1 );
 	}
-	if( page->data != NULL )
+	if( page->data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid page data already set.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page - missing data.",
 		 function );
 
 		return( -1 );
 	}
-	if( io_handle == NULL )
+	if( page->data_size < sizeof( esedb_page_header_t ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page - data size value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	calculated_page_number = (uint32_t) ( ( file_offset - io_handle->page_size ) / io_handle->page_size );
-
-	page->offset = file_offset;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: reading page: %" PRIu32 " at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
-		 function,
-		 calculated_page_number,
-		 page->offset,
-		 page->offset );
-	}
-#endif
-	if( libbfio_handle_seek_offset(
-	     file_io_handle,
-	     page->offset,
-	     SEEK_SET,
-	     error ) == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek page offset: %" PRIi64 ".",
-		 function,
-		 page->offset );
-
-		goto on_error;
-	}
-	page->data = (uint8_t *) memory_allocate(
-	                          (size_t) io_handle->page_size );
-
-	if( page->data == NULL )
+	if( io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create page data.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	page->data_size = (size_t) io_handle->page_size;
-
-	read_count = libbfio_handle_read_buffer(
-	              file_io_handle,
-	              page->data,
-	              page->data_size,
-	              error );
-
-	if( read_count != (ssize_t) page->data_size )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read page data.",
-		 function );
+	calculated_page_number = (uint32_t) ( ( page->offset - io_handle->page_size ) / io_handle->page_size );
 
-		goto on_error;
-	}
 	page_values_data      = page->data;
 	page_values_data_size = page->data_size;
 
@@ -442,31 +1005,19 @@ int libesedb_page_read(
 	 ( (esedb_page_header_t *) page_values_data )->page_flags,
 	 page->flags );
 
-	/* Make sure to read after the page flags
-	 */
 	if( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
 	 && ( io_handle->page_size >= 16384 ) )
 	{
-		/* TODO handle checksum */
-	}
-	else
-	{
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (esedb_page_header_t *) page_values_data )->xor_checksum,
-		 stored_xor32_checksum );
-
-		if( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_NEW_RECORD_FORMAT )
-		 && ( ( page->flags & LIBESEDB_PAGE_FLAG_IS_NEW_RECORD_FORMAT ) != 0 ) )
-		{
-			byte_stream_copy_to_uint32_little_endian(
-			 ( (esedb_page_header_t *) page_values_data )->ecc_checksum,
-			 stored_ecc32_checksum );
-		}
-		else
+		if( page_values_data_size < ( sizeof( esedb_page_header_t ) + sizeof( esedb_extended_page_header_t ) ) )
 		{
-			byte_stream_copy_to_uint32_little_endian(
-			 ( (esedb_page_header_t *) page_values_data )->page_number,
-			 stored_page_number );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid page - data size value out of bounds.",
+			 function );
+
+			goto on_error;
 		}
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -480,8 +1031,6 @@ int libesedb_page_read(
 		if( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
 		 && ( io_handle->page_size >= 16384 ) )
 		{
-			/* TODO handle checksum */
-
 			byte_stream_copy_to_uint64_little_endian(
 			 page_values_data,
 			 value_64bit );
@@ -492,25 +1041,34 @@ int libesedb_page_read(
 		}
 		else
 		{
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (esedb_page_header_t *) page_values_data )->xor_checksum,
+			 value_32bit );
 			libcnotify_printf(
 			 "%s: XOR checksum\t\t\t\t\t: 0x%08" PRIx32 "\n",
 			 function,
-			 stored_xor32_checksum );
+			 value_32bit );
 
 			if( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_NEW_RECORD_FORMAT )
 			 && ( ( page->flags & LIBESEDB_PAGE_FLAG_IS_NEW_RECORD_FORMAT ) != 0 ) )
 			{
+				byte_stream_copy_to_uint32_little_endian(
+				 ( (esedb_page_header_t *) page_values_data )->ecc_checksum,
+				 value_32bit );
 				libcnotify_printf(
 				 "%s: ECC checksum\t\t\t\t\t: 0x%08" PRIx32 "\n",
 				 function,
-				 stored_ecc32_checksum );
+				 value_32bit );
 			}
 			else
 			{
+				byte_stream_copy_to_uint32_little_endian(
+				 ( (esedb_page_header_t *) page_values_data )->page_number,
+				 value_32bit );
 				libcnotify_printf(
 				 "%s: page number\t\t\t\t\t\t: %" PRIu32 "\n",
 				 function,
-				 stored_page_number );
+				 value_32bit );
 			}
 		}
 		libcnotify_printf(
@@ -570,35 +1128,47 @@ int libesedb_page_read(
 		 "\n" );
 	}
 #endif
+	/* The checksum policy determines if the checksum needs to be calculated
+	 */
+	result = libesedb_io_handle_get_page_checksum_verified(
+	          io_handle,
+	          calculated_page_number,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if page checksum was verified.",
+		 function );
+
+		goto on_error;
+	}
 	/* TODO for now don't bother calculating a checksum for uninitialized pages */
 
-	if( ( page_values_data[ 0 ] != 0 )
-	 || ( page_values_data[ 1 ] != 0 )
-	 || ( page_values_data[ 2 ] != 0 )
-	 || ( page_values_data[ 3 ] != 0 ) )
+	if( ( result == 0 )
+	 && ( ( page_values_data[ 0 ] != 0 )
+	  ||  ( page_values_data[ 1 ] != 0 )
+	  ||  ( page_values_data[ 2 ] != 0 )
+	  ||  ( page_values_data[ 3 ] != 0 ) ) )
 	{
-		if( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
-		 && ( io_handle->page_size >= 16384 ) )
-		{
-			/* TODO handle checksum */
-		}
-		else if( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_NEW_RECORD_FORMAT )
-		      && ( ( page->flags & LIBESEDB_PAGE_FLAG_IS_NEW_RECORD_FORMAT ) != 0 ) )
+		if( io_handle->checksum_policy == LIBESEDB_CHECKSUM_POLICY_VERIFY_IN_BACKGROUND )
 		{
-			if( libesedb_checksum_calculate_little_endian_ecc32(
-			     &calculated_ecc32_checksum,
-			     &calculated_xor32_checksum,
+			if( libesedb_io_handle_queue_page_checksum_verification(
+			     io_handle,
+			     calculated_page_number,
+			     page->flags,
 			     page_values_data,
 			     page_values_data_size,
-			     8,
-			     calculated_page_number,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-				 "%s: unable to calculate ECC-32 and XOR-32 checksum.",
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to queue page checksums verification.",
 				 function );
 
 				goto on_error;
@@ -606,70 +1176,56 @@ int libesedb_page_read(
 		}
 		else
 		{
-			if( libesedb_checksum_calculate_little_endian_xor32(
-			     &calculated_xor32_checksum,
-			     &( page_values_data[ 4 ] ),
-			     page_values_data_size - 4,
-			     0x89abcdef,
-			     error ) != 1 )
+			result = libesedb_page_verify_checksums(
+			          io_handle,
+			          calculated_page_number,
+			          page->flags,
+			          page_values_data,
+			          page_values_data_size,
+			          error );
+
+			if( result == -1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-				 "%s: unable to calculate XOR-32 checksum.",
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to verify page checksums.",
 				 function );
 
 				goto on_error;
 			}
-		}
-		if( stored_xor32_checksum != calculated_xor32_checksum )
-		{
-#ifdef TODO
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_INPUT,
-			 LIBCERROR_INPUT_ERROR_CRC_MISMATCH,
-			 "%s: mismatch in page XOR-32 checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).",
-			 function,
-			 stored_xor32_checksum,
-			 calculated_xor32_checksum );
-
-			goto on_error;
-#else
-			if( libcnotify_verbose != 0 )
+			else if( result == 0 )
 			{
-				libcnotify_printf(
-				 "%s: mismatch in page XOR-32 checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).\n",
-				 function,
-				 stored_xor32_checksum,
-				 calculated_xor32_checksum );
+				if( libesedb_io_handle_set_page_checksum_mismatch(
+				     io_handle,
+				     calculated_page_number,
+				     error ) == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to mark page checksum as mismatched.",
+					 function );
+
+					goto on_error;
+				}
 			}
-#endif
 		}
-		if( stored_ecc32_checksum != calculated_ecc32_checksum )
+		if( libesedb_io_handle_set_page_checksum_verified(
+		     io_handle,
+		     calculated_page_number,
+		     error ) != 1 )
 		{
-#ifdef TODO
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_INPUT,
-			 LIBCERROR_INPUT_ERROR_CRC_MISMATCH,
-			 "%s: mismatch in page ECC-32 checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).",
-			 function,
-			 stored_ecc32_checksum,
-			 calculated_ecc32_checksum );
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to mark page checksum as verified.",
+			 function );
 
 			goto on_error;
-#else
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: mismatch in page ECC-32 checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).\n",
-				 function,
-				 stored_ecc32_checksum,
-				 calculated_ecc32_checksum );
-			}
-#endif
 		}
 	}
 	page_values_data        += sizeof( esedb_page_header_t );
@@ -741,24 +1297,8 @@ int libesedb_page_read(
 	}
 	if( available_page_tag > 0 )
 	{
-		/* Create the page tags array
-		 */
-		if( libcdata_array_initialize(
-		     &page_tags_array,
-		     0,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create page tags array.",
-			 function );
-
-			goto on_error;
-		}
 		if( libesedb_page_read_tags(
-		     page_tags_array,
+		     page,
 		     io_handle,
 		     available_page_tag,
 		     page->data,
@@ -779,7 +1319,7 @@ int libesedb_page_read(
 		if( libesedb_page_read_values(
 		     page,
 		     io_handle,
-		     page_tags_array,
+		     available_page_tag,
 		     page_values_data,
 		     page_values_data_size,
 		     page_values_data_offset,
@@ -794,70 +1334,155 @@ int libesedb_page_read(
 
 			goto on_error;
 		}
-		if( libcdata_array_free(
-		     &page_tags_array,
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_page_tags_value_free,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free the page tags array.",
-			 function );
-
-			goto on_error;
-		}
 	}
 	return( 1 );
 
 on_error:
-	if( page_tags_array != NULL )
+	page->number_of_values = 0;
+
+	return( -1 );
+}
+
+/* Resizes the page data buffer
+ * The page data buffer is only reallocated if it is smaller than the requested size
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_resize_data_buffer(
+     libesedb_page_t *page,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_page_resize_data_buffer";
+
+	if( page == NULL )
 	{
-		libcdata_array_free(
-		 &page_tags_array,
-		 (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_page_tags_value_free,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
 	}
-	if( page->data != NULL )
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( page->data_buffer_size >= data_size )
+	{
+		return( 1 );
+	}
+	if( page->data_buffer != NULL )
 	{
 		memory_free(
-		 page->data );
+		 page->data_buffer );
 
-		page->data = NULL;
+		page->data_buffer      = NULL;
+		page->data_buffer_size = 0;
 	}
-	return( -1 );
+	page->data_buffer = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * data_size );
+
+	if( page->data_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create page data buffer.",
+		 function );
+
+		return( -1 );
+	}
+	page->data_buffer_size = data_size;
+
+	return( 1 );
+}
+
+/* Resizes the page values
+ * The page values are only reallocated if there are fewer allocated values than requested
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_resize_values(
+     libesedb_page_t *page,
+     uint16_t number_of_values,
+     libcerror_error_t **error )
+{
+	libesedb_page_value_t *reallocation = NULL;
+	static char *function               = "libesedb_page_resize_values";
+
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( page->number_of_allocated_values >= number_of_values )
+	{
+		return( 1 );
+	}
+	reallocation = (libesedb_page_value_t *) memory_reallocate(
+	                                          page->values,
+	                                          sizeof( libesedb_page_value_t ) * number_of_values );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize page values.",
+		 function );
+
+		return( -1 );
+	}
+	page->values                     = reallocation;
+	page->number_of_allocated_values = number_of_values;
+
+	return( 1 );
 }
 
 /* Reads the page tags
+ * The page tags are stored in the page values, the offsets are relative after the page header
  * Returns 1 if successful or -1 on error
  */
 int libesedb_page_read_tags(
-     libcdata_array_t *page_tags_array,
+     libesedb_page_t *page,
      libesedb_io_handle_t *io_handle,
      uint16_t number_of_page_tags,
      uint8_t *page_data,
      size_t page_data_size,
      libcerror_error_t **error )
 {
-	libesedb_page_tags_value_t *page_tags_value = NULL;
-	uint8_t *page_tags_data                     = NULL;
-	static char *function                       = "libesedb_page_read_tags";
-	uint16_t page_tag_offset                    = 0;
-	uint16_t page_tag_size                      = 0;
-	uint16_t page_tags_index                    = 0;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	size_t page_tags_data_size                  = 0;
-#endif
+	libesedb_page_value_t *page_value = NULL;
+	uint8_t *page_tags_data           = NULL;
+	static char *function             = "libesedb_page_read_tags";
+	size_t page_tags_data_size        = 0;
+	uint16_t page_tag_offset          = 0;
+	uint16_t page_tag_size            = 0;
+	uint16_t page_tags_index          = 0;
 
-	if( page_tags_array == NULL )
+	if( page == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid page tags array.",
+		 "%s: invalid page.",
 		 function );
 
 		return( -1 );
@@ -895,26 +1520,36 @@ int libesedb_page_read_tags(
 
 		return( -1 );
 	}
-	if( libcdata_array_resize(
-	     page_tags_array,
+	page_tags_data_size = 4 * (size_t) number_of_page_tags;
+
+	if( page_tags_data_size > page_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of page tags value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_resize_values(
+	     page,
 	     number_of_page_tags,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_page_tags_value_free,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
-		 "%s: unable to resize page tags array.",
+		 "%s: unable to resize page values.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
-		page_tags_data_size = 4 * number_of_page_tags;
-
 		libcnotify_printf(
 		 "%s: page tags:\n",
 		 function );
@@ -932,19 +1567,8 @@ int libesedb_page_read_tags(
 	     page_tags_index < number_of_page_tags;
 	     page_tags_index++ )
 	{
-		if( libesedb_page_tags_value_initialize(
-		     &page_tags_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create page tags value.",
-			 function );
+		page_value = &( page->values[ page_tags_index ] );
 
-			goto on_error;
-		}
 		byte_stream_copy_to_uint16_little_endian(
 		 page_tags_data,
 		 page_tag_offset );
@@ -957,18 +1581,21 @@ int libesedb_page_read_tags(
 
 		page_tags_data -= 2;
 
+		page_value->data        = NULL;
+		page_value->data_offset = 0;
+
 		if( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
 		 && ( io_handle->page_size >= 16384 ) )
 		{
-			page_tags_value->flags  = 0;
-			page_tags_value->offset = page_tag_offset & 0x7fff;
-			page_tags_value->size   = page_tag_size & 0x7fff;;
+			page_value->flags  = 0;
+			page_value->offset = page_tag_offset & 0x7fff;
+			page_value->size   = page_tag_size & 0x7fff;
 		}
 		else
 		{
-			page_tags_value->flags  = page_tag_offset >> 13;
-			page_tags_value->offset = page_tag_offset & 0x1fff;
-			page_tags_value->size   = page_tag_size & 0x1fff;
+			page_value->flags  = (uint8_t) ( page_tag_offset >> 13 );
+			page_value->offset = page_tag_offset & 0x1fff;
+			page_value->size   = page_tag_size & 0x1fff;
 		}
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
@@ -977,14 +1604,14 @@ int libesedb_page_read_tags(
 			 "%s: page tag: %03" PRIu16 " offset\t\t\t\t: %" PRIu16 " (0x%04" PRIx16 ")\n",
 			 function,
 			 page_tags_index,
-			 page_tags_value->offset,
+			 page_value->offset,
 			 page_tag_offset );
 
 			libcnotify_printf(
 			 "%s: page tag: %03" PRIu16 " size\t\t\t\t: %" PRIu16 " (0x%04" PRIx16 ")\n",
 			 function,
 			 page_tags_index,
-			 page_tags_value->size,
+			 page_value->size,
 			 page_tag_size );
 
 			if( ( io_handle->format_revision < LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
@@ -994,31 +1621,14 @@ int libesedb_page_read_tags(
 				 "%s: page tag: %03" PRIu16 " flags\t\t\t\t: 0x%02" PRIx8 "",
 				 function,
 				 page_tags_index,
-				 page_tags_value->flags );
+				 page_value->flags );
 				libesedb_debug_print_page_tag_flags(
-				 page_tags_value->flags );
+				 page_value->flags );
 				libcnotify_printf(
 				 "\n" );
 			}
 		}
 #endif
-		if( libcdata_array_set_entry_by_index(
-		     page_tags_array,
-		     (int) page_tags_index,
-		     (intptr_t *) page_tags_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set page tag: %" PRIu16 ".",
-			 function,
-			 page_tags_index );
-
-			goto on_error;
-		}
-		page_tags_value = NULL;
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
@@ -1028,34 +1638,27 @@ int libesedb_page_read_tags(
 	}
 #endif
 	return( 1 );
-
-on_error:
-	if( page_tags_value != NULL )
-	{
-		libesedb_page_tags_value_free(
-		 &page_tags_value,
-		 NULL );
-	}
-	return( -1 );
 }
 
 /* Reads the page values
+ * The page tags must have been read into the page values, the page values
+ * are validated and their data is resolved on demand by libesedb_page_get_value
  * Returns 1 if successful or -1 on error
  */
 int libesedb_page_read_values(
      libesedb_page_t *page,
      libesedb_io_handle_t *io_handle,
-     libcdata_array_t *page_tags_array,
+     uint16_t number_of_page_tags,
      uint8_t *page_values_data,
      size_t page_values_data_size,
      size_t page_values_data_offset,
      libcerror_error_t **error )
 {
-	libesedb_page_tags_value_t *page_tags_value = NULL;
-	libesedb_page_value_t *page_value           = NULL;
-	static char *function                       = "libesedb_page_read_values";
-	uint16_t page_tags_index                    = 0;
-	int number_of_page_tags                     = 0;
+	static char *function = "libesedb_page_read_values";
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	uint16_t page_value_index = 0;
+#endif
 
 	if( page == NULL )
 	{
@@ -1068,35 +1671,36 @@ int libesedb_page_read_values(
 
 		return( -1 );
 	}
-	if( page->values_array == NULL )
+	if( page->data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid page  - missing values array.",
+		 "%s: invalid page - missing data.",
 		 function );
 
 		return( -1 );
 	}
-	if( io_handle == NULL )
+	if( ( page->values == NULL )
+	 || ( number_of_page_tags > page->number_of_allocated_values ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page - missing values.",
 		 function );
 
 		return( -1 );
 	}
-	if( page_tags_array == NULL )
+	if( io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid page tags array.",
+		 "%s: invalid IO handle.",
 		 function );
 
 		return( -1 );
@@ -1123,193 +1727,204 @@ int libesedb_page_read_values(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_number_of_entries(
-	     page_tags_array,
-	     &number_of_page_tags,
-	     error ) != 1 )
+	if( ( page_values_data_offset > page->data_size )
+	 || ( page_values_data_size > ( page->data_size - page_values_data_offset ) )
+	 || ( page_values_data != &( page->data[ page_values_data_offset ] ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page values data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	page->values_data_offset = (uint16_t) page_values_data_offset;
+
+	if( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
+	 && ( io_handle->page_size >= 16384 ) )
+	{
+		page->has_extended_page_header = 1;
+	}
+	else
+	{
+		page->has_extended_page_header = 0;
+	}
+	page->number_of_values = number_of_page_tags;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		for( page_value_index = 0;
+		     page_value_index < number_of_page_tags;
+		     page_value_index++ )
+		{
+			if( libesedb_page_read_value(
+			     page,
+			     page_value_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read page value: %" PRIu16 ".",
+				 function,
+				 page_value_index );
+
+				page->number_of_values = 0;
+
+				return( -1 );
+			}
+		}
+		libcnotify_printf(
+		"\n" );
+	}
+#endif
+	return( 1 );
+}
+
+/* Reads a page value
+ * Validates the page tag of the value and resolves the value data
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_read_value(
+     libesedb_page_t *page,
+     uint16_t value_index,
+     libcerror_error_t **error )
+{
+	libesedb_page_value_t *page_value = NULL;
+	uint8_t *page_values_data         = NULL;
+	static char *function             = "libesedb_page_read_value";
+	size_t page_values_data_size      = 0;
+
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( page->data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of page tags.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page - missing data.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_array_resize(
-	     page->values_array,
-	     number_of_page_tags,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_page_value_free,
-	     error ) != 1 )
+	if( (size_t) page->values_data_offset > page->data_size )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
-		 "%s: unable to resize page values array.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page - values data offset value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	for( page_tags_index = 0;
-	     page_tags_index < number_of_page_tags;
-	     page_tags_index++ )
+	if( value_index >= page->number_of_values )
 	{
-		if( libcdata_array_get_entry_by_index(
-		     page_tags_array,
-		     page_tags_index,
-		     (intptr_t **) &page_tags_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve page tag: %" PRIu16 ".",
-			 function,
-			 page_tags_index );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value index value out of bounds.",
+		 function );
 
-			goto on_error;
-		}
-		if( page_tags_value == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-			 "%s: invalid page tags value.",
-			 function );
+		return( -1 );
+	}
+	page_value = &( page->values[ value_index ] );
 
-			goto on_error;
-		}
-		if( libesedb_page_value_initialize(
-		     &page_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create tags value.",
-			 function );
+	if( page_value->data != NULL )
+	{
+		return( 1 );
+	}
+	page_values_data      = &( page->data[ page->values_data_offset ] );
+	page_values_data_size = page->data_size - page->values_data_offset;
 
-			goto on_error;
-		}
-		if( page_tags_value->offset > page->data_size )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: unsupported page tags value offset value out of bounds.",
-			 function );
+	if( (size_t) page_value->offset > page_values_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: unsupported page tags value offset value out of bounds.",
+		 function );
 
 #if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: page value: %03" PRIu16 " offset: % 5" PRIu16 ", size: % 5" PRIu16 "\n",
-				 function,
-				 page_tags_index,
-				 page_tags_value->offset,
-				 page_tags_value->size );
-			}
-#endif
-			goto on_error;
-		}
-		if( page_tags_value->size > ( page->data_size - page_tags_value->offset ) )
+		if( libcnotify_verbose != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: unsupported page tags value size value out of bounds.",
-			 function );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: page value: %03" PRIu16 " offset: % 5" PRIu16 ", size: % 5" PRIu16 "\n",
-				 function,
-				 page_tags_index,
-				 page_tags_value->offset,
-				 page_tags_value->size );
-			}
-#endif
-			goto on_error;
+			libcnotify_printf(
+			 "%s: page value: %03" PRIu16 " offset: % 5" PRIu16 ", size: % 5" PRIu16 "\n",
+			 function,
+			 value_index,
+			 page_value->offset,
+			 page_value->size );
 		}
-		if( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
-		 && ( io_handle->page_size >= 16384 ) )
-		{
-			/* The page tags flags are stored in the upper byte of the first 16-bit value
-			 */
-			page_tags_value->flags = page_values_data[ page_tags_value->offset + 1 ] >> 5;
+#endif
+		return( -1 );
+	}
+	if( (size_t) page_value->size > ( page_values_data_size - page_value->offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: unsupported page tags value size value out of bounds.",
+		 function );
 
-			page_values_data[ page_tags_value->offset + 1 ] &= 0x1f;
-		}
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
 			libcnotify_printf(
-			 "%s: page value: %03" PRIu16 " offset: % 5" PRIu16 ", size: % 5" PRIu16 ", flags: 0x%02" PRIx8 "",
+			 "%s: page value: %03" PRIu16 " offset: % 5" PRIu16 ", size: % 5" PRIu16 "\n",
 			 function,
-			 page_tags_index,
-			 page_tags_value->offset,
-			 page_tags_value->size,
-			 page_tags_value->flags );
-			libesedb_debug_print_page_tag_flags(
-			 page_tags_value->flags );
-			libcnotify_printf(
-			 "\n" );
+			 value_index,
+			 page_value->offset,
+			 page_value->size );
 		}
 #endif
-		page_value->data   = &( page_values_data[ page_tags_value->offset ] );
-		page_value->offset = (uint16_t) ( page_values_data_offset + page_tags_value->offset );
-		page_value->size   = page_tags_value->size;
-		page_value->flags  = page_tags_value->flags;
-
-		if( libcdata_array_set_entry_by_index(
-		     page->values_array,
-		     (int) page_tags_index,
-		     (intptr_t *) page_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set page value: %" PRIu16 ".",
-			 function,
-			 page_tags_index );
-
-			goto on_error;
-		}
-		page_value = NULL;
+		return( -1 );
+	}
+	if( ( page->has_extended_page_header != 0 )
+	 && ( page_value->size >= 2 ) )
+	{
+		/* The page tags flags are stored in the upper byte of the first 16-bit value
+		 * the page data is not modified since it can be memory mapped, hence the
+		 * page tree masks the flags when reading the first 16-bit value
+		 */
+		page_value->flags = page_values_data[ page_value->offset + 1 ] >> 5;
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
 		libcnotify_printf(
-		"\n" );
+		 "%s: page value: %03" PRIu16 " offset: % 5" PRIu16 ", size: % 5" PRIu16 ", flags: 0x%02" PRIx8 "",
+		 function,
+		 value_index,
+		 page_value->offset,
+		 page_value->size,
+		 page_value->flags );
+		libesedb_debug_print_page_tag_flags(
+		 page_value->flags );
+		libcnotify_printf(
+		 "\n" );
 	}
 #endif
-	return( 1 );
-
-on_error:
-	if( page_value != NULL )
-	{
-		libesedb_page_value_free(
-		 &page_value,
-		 NULL );
-	}
-	libcdata_array_empty(
-	 page->values_array,
-	 (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_page_value_free,
-	 NULL );
+	page_value->data        = &( page_values_data[ page_value->offset ] );
+	page_value->data_offset = (uint16_t) ( page->values_data_offset + page_value->offset );
 
-	return( -1 );
+	return( 1 );
 }
 
 /* Retrieves the number of page values
@@ -1320,8 +1935,7 @@ int libesedb_page_get_number_of_values(
      uint16_t *number_of_values,
      libcerror_error_t **error )
 {
-	static char *function     = "libesedb_page_get_number_of_values";
-	int page_number_of_values = 0;
+	static char *function = "libesedb_page_get_number_of_values";
 
 	if( page == NULL )
 	{
@@ -1345,37 +1959,13 @@ int libesedb_page_get_number_of_values(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_number_of_entries(
-	     page->values_array,
-	     &page_number_of_values,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of values.",
-		 function );
-
-		return( -1 );
-	}
-	if( page_number_of_values > (int) UINT16_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid number of page values value exceeds maximum.",
-		 function );
-
-		return( -1 );
-	}
-	*number_of_values = (uint16_t) page_number_of_values;
+	*number_of_values = page->number_of_values;
 
 	return( 1 );
 }
 
 /* Retrieves the page value at the index
+ * The page value is owned by the page and remains valid while the page is not freed
  * Returns 1 if successful or -1 on error
  */
 int libesedb_page_get_value(
@@ -1397,22 +1987,45 @@ int libesedb_page_get_value(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     page->values_array,
-	     (int) value_index,
-	     (intptr_t **) page_value,
+	if( value_index >= page->number_of_values )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_read_value(
+	     page,
+	     value_index,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve page value: %" PRIu16 ".",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read page value: %" PRIu16 ".",
 		 function,
 		 value_index );
 
 		return( -1 );
 	}
+	*page_value = &( page->values[ value_index ] );
+
 	return( 1 );
 }
 
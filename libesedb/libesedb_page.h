@@ -27,7 +27,6 @@
 
 #include "libesedb_io_handle.h"
 #include "libesedb_libbfio.h"
-#include "libesedb_libcdata.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_page_value.h"
 
@@ -35,23 +34,6 @@
 extern "C" {
 #endif
 
-typedef struct libesedb_page_tags_value libesedb_page_tags_value_t;
-
-struct libesedb_page_tags_value
-{
-	/* The offset of the value
-	 */
-	uint16_t offset;
-
-	/* The size of the value
-	 */
-	uint16_t size;
-
-	/* The flags of the value
-	 */
-	uint8_t flags;
-};
-
 typedef struct libesedb_page libesedb_page_t;
 
 struct libesedb_page
@@ -76,7 +58,7 @@ struct libesedb_page
 	 */
 	uint32_t flags;
 
-	/* The page data
+	/* The page data, references the page data buffer or a memory mapping of the file
 	 */
 	uint8_t *data;
 
@@ -84,22 +66,54 @@ struct libesedb_page
 	 */
 	size_t data_size;
 
+	/* Value to indicate the page data references a memory mapping of the file
+	 */
+	uint8_t data_is_mapped;
+
+	/* The page data buffer, retained when the page is reused
+	 */
+	uint8_t *data_buffer;
+
+	/* The page data buffer size
+	 */
+	size_t data_buffer_size;
+
 	/* The file offset of the page
 	 */
 	off64_t offset;
 
-	/* The page values array
+	/* The page values, the value data is resolved on demand
 	 */
-	libcdata_array_t *values_array;
-};
+	libesedb_page_value_t *values;
 
-int libesedb_page_tags_value_initialize(
-     libesedb_page_tags_value_t **page_tags_value,
-     libcerror_error_t **error );
+	/* The offset of the page values data relative to the start of the page data
+	 */
+	uint16_t values_data_offset;
 
-int libesedb_page_tags_value_free(
-     libesedb_page_tags_value_t **page_tags_value,
-     libcerror_error_t **error );
+	/* The number of page values
+	 */
+	uint16_t number_of_values;
+
+	/* The number of allocated page values, retained when the page is reused
+	 */
+	uint16_t number_of_allocated_values;
+
+	/* Value to indicate the page has an extended page header
+	 */
+	uint8_t has_extended_page_header;
+
+	/* Value to indicate the page is resident, stored in a pages cache
+	 */
+	uint8_t is_resident;
+
+	/* The page pool the page is returned to when freed, NULL if the page is not pooled
+	 */
+	struct libesedb_page_pool *page_pool;
+
+	/* The next free page in the page pool
+	 */
+	libesedb_page_t *next_free_page;
+};
 
 int libesedb_page_initialize(
      libesedb_page_t **page,
@@ -109,6 +123,10 @@ int libesedb_page_free(
      libesedb_page_t **page,
      libcerror_error_t **error );
 
+int libesedb_page_clear(
+     libesedb_page_t *page,
+     libcerror_error_t **error );
+
 int libesedb_page_read(
      libesedb_page_t *page,
      libesedb_io_handle_t *io_handle,
@@ -116,8 +134,47 @@ int libesedb_page_read(
      off64_t file_offset,
      libcerror_error_t **error );
 
+int libesedb_page_read_buffer(
+     libesedb_page_t *page,
+     libesedb_io_handle_t *io_handle,
+     off64_t file_offset,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+int libesedb_page_verify_checksums(
+     libesedb_io_handle_t *io_handle,
+     uint32_t page_number,
+     uint32_t page_flags,
+     const uint8_t *page_data,
+     size_t page_data_size,
+     libcerror_error_t **error );
+
+int libesedb_page_verify_data(
+     libesedb_io_handle_t *io_handle,
+     uint32_t page_number,
+     const uint8_t *page_data,
+     size_t page_data_size,
+     uint8_t *page_status,
+     libcerror_error_t **error );
+
+int libesedb_page_read_page_data(
+     libesedb_page_t *page,
+     libesedb_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libesedb_page_resize_data_buffer(
+     libesedb_page_t *page,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libesedb_page_resize_values(
+     libesedb_page_t *page,
+     uint16_t number_of_values,
+     libcerror_error_t **error );
+
 int libesedb_page_read_tags(
-     libcdata_array_t *page_tags_array,
+     libesedb_page_t *page,
      libesedb_io_handle_t *io_handle,
      uint16_t number_of_page_tags,
      uint8_t *page_data,
@@ -127,12 +184,17 @@ int libesedb_page_read_tags(
 int libesedb_page_read_values(
      libesedb_page_t *page,
      libesedb_io_handle_t *io_handle,
-     libcdata_array_t *page_tags_array,
+     uint16_t number_of_page_tags,
      uint8_t *page_values_data,
      size_t page_values_data_size,
      size_t page_values_data_offset,
      libcerror_error_t **error );
 
+int libesedb_page_read_value(
+     libesedb_page_t *page,
+     uint16_t value_index,
+     libcerror_error_t **error );
+
 int libesedb_page_get_number_of_values(
      libesedb_page_t *page,
      uint16_t *number_of_values,
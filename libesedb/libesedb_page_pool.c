@@ -0,0 +1,514 @@
+/*
+ * Page pool functions
+ *
+ * Copyright (C) 2009-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libesedb_libcerror.h"
+#include "libesedb_page.h"
+#include "libesedb_page_pool.h"
+
+/* Creates a page pool
+ * Make sure the value page_pool is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_pool_initialize(
+     libesedb_page_pool_t **page_pool,
+     int maximum_number_of_free_pages,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_page_pool_initialize";
+
+	if( page_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *page_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid page pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_free_pages < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum number of free pages value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	*page_pool = memory_allocate_structure(
+	              libesedb_page_pool_t );
+
+	if( *page_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create page pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *page_pool,
+	     0,
+	     sizeof( libesedb_page_pool_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear page pool.",
+		 function );
+
+		goto on_error;
+	}
+	( *page_pool )->maximum_number_of_free_pages = maximum_number_of_free_pages;
+
+	return( 1 );
+
+on_error:
+	if( *page_pool != NULL )
+	{
+		memory_free(
+		 *page_pool );
+
+		*page_pool = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a page pool
+ * Pages that are in use are not tracked by the page pool and must be freed before the page pool
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_pool_free(
+     libesedb_page_pool_t **page_pool,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_page_pool_free";
+	int result            = 1;
+
+	if( page_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *page_pool != NULL )
+	{
+		if( libesedb_page_pool_empty(
+		     *page_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty page pool.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *page_pool )->resident_pages_bitmap != NULL )
+		{
+			memory_free(
+			 ( *page_pool )->resident_pages_bitmap );
+		}
+		memory_free(
+		 *page_pool );
+
+		*page_pool = NULL;
+	}
+	return( result );
+}
+
+/* Empties a page pool
+ * Frees the free pages
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_pool_empty(
+     libesedb_page_pool_t *page_pool,
+     libcerror_error_t **error )
+{
+	libesedb_page_t *page = NULL;
+	static char *function = "libesedb_page_pool_empty";
+	int result            = 1;
+
+	if( page_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page pool.",
+		 function );
+
+		return( -1 );
+	}
+	while( page_pool->free_pages != NULL )
+	{
+		page                  = page_pool->free_pages;
+		page_pool->free_pages = page->next_free_page;
+
+		page->next_free_page = NULL;
+		page->page_pool      = NULL;
+
+		if( libesedb_page_free(
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free page.",
+			 function );
+
+			result = -1;
+		}
+	}
+	page_pool->number_of_free_pages = 0;
+
+	return( result );
+}
+
+/* Retrieves a page from the page pool
+ * A free page is reused if available, otherwise a new page is created
+ * The page is returned to the page pool when it is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_pool_get_page(
+     libesedb_page_pool_t *page_pool,
+     libesedb_page_t **page,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_page_pool_get_page";
+
+	if( page_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( *page != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid page value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_pool->free_pages != NULL )
+	{
+		*page                 = page_pool->free_pages;
+		page_pool->free_pages = ( *page )->next_free_page;
+
+		page_pool->number_of_free_pages -= 1;
+
+		( *page )->next_free_page = NULL;
+	}
+	else
+	{
+		if( libesedb_page_initialize(
+		     page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create page.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	( *page )->page_pool = page_pool;
+
+	return( 1 );
+}
+
+/* Releases a page to the page pool
+ * The page is no longer resident and is kept as a free page if the page pool
+ * is not full, otherwise it is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_pool_release_page(
+     libesedb_page_pool_t *page_pool,
+     libesedb_page_t **page,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_page_pool_release_page";
+
+	if( page_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( *page == NULL )
+	{
+		return( 1 );
+	}
+	if( ( *page )->is_resident != 0 )
+	{
+		if( (size_t) ( ( *page )->page_number / 8 ) < page_pool->resident_pages_bitmap_size )
+		{
+			page_pool->resident_pages_bitmap[ ( *page )->page_number / 8 ] &= (uint8_t) ~( 1 << ( ( *page )->page_number % 8 ) );
+		}
+		( *page )->is_resident = 0;
+	}
+	( *page )->page_pool = NULL;
+
+	if( page_pool->number_of_free_pages >= page_pool->maximum_number_of_free_pages )
+	{
+		if( libesedb_page_free(
+		     page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free page.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( libesedb_page_clear(
+	     *page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear page.",
+		 function );
+
+		libesedb_page_free(
+		 page,
+		 NULL );
+
+		return( -1 );
+	}
+	( *page )->next_free_page = page_pool->free_pages;
+	page_pool->free_pages     = *page;
+
+	page_pool->number_of_free_pages += 1;
+
+	*page = NULL;
+
+	return( 1 );
+}
+
+/* Marks a page as resident
+ * A page is resident while it is stored in a pages cache, which is tracked by
+ * page number until the page is released to the page pool
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_pool_set_page_resident(
+     libesedb_page_pool_t *page_pool,
+     libesedb_page_t *page,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_page_pool_set_page_resident";
+	void *reallocation    = NULL;
+	size_t bitmap_index   = 0;
+	size_t bitmap_size    = 0;
+
+	if( page_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( page->page_pool != page_pool )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported page - not retrieved from page pool.",
+		 function );
+
+		return( -1 );
+	}
+	bitmap_index = (size_t) ( page->page_number / 8 );
+
+	if( bitmap_index >= page_pool->resident_pages_bitmap_size )
+	{
+		/* Grow the bitmap in steps to limit the number of reallocations
+		 */
+		bitmap_size = ( bitmap_index & ~( (size_t) 1023 ) ) + 1024;
+
+		reallocation = memory_reallocate(
+		                page_pool->resident_pages_bitmap,
+		                sizeof( uint8_t ) * bitmap_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize resident pages bitmap.",
+			 function );
+
+			return( -1 );
+		}
+		page_pool->resident_pages_bitmap = (uint8_t *) reallocation;
+
+		if( memory_set(
+		     &( page_pool->resident_pages_bitmap[ page_pool->resident_pages_bitmap_size ] ),
+		     0,
+		     sizeof( uint8_t ) * ( bitmap_size - page_pool->resident_pages_bitmap_size ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear resident pages bitmap.",
+			 function );
+
+			return( -1 );
+		}
+		page_pool->resident_pages_bitmap_size = bitmap_size;
+	}
+	page_pool->resident_pages_bitmap[ bitmap_index ] |= (uint8_t) ( 1 << ( page->page_number % 8 ) );
+
+	page->is_resident = 1;
+
+	return( 1 );
+}
+
+/* Determines if a page with a specific page number is resident
+ * Returns 1 if resident, 0 if not or -1 on error
+ */
+int libesedb_page_pool_get_page_is_resident(
+     libesedb_page_pool_t *page_pool,
+     uint32_t page_number,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_page_pool_get_page_is_resident";
+	size_t bitmap_index   = 0;
+
+	if( page_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page pool.",
+		 function );
+
+		return( -1 );
+	}
+	bitmap_index = (size_t) ( page_number / 8 );
+
+	if( bitmap_index >= page_pool->resident_pages_bitmap_size )
+	{
+		return( 0 );
+	}
+	if( ( page_pool->resident_pages_bitmap[ bitmap_index ] & ( 1 << ( page_number % 8 ) ) ) == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,98 @@
+/*
+ * Page pool functions
+ *
+ * Copyright (C) 2009-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_PAGE_POOL_H )
+#define _LIBESEDB_PAGE_POOL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_libcerror.h"
+#include "libesedb_page.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libesedb_page_pool libesedb_page_pool_t;
+
+struct libesedb_page_pool
+{
+	/* The free pages, linked by their next free page
+	 */
+	libesedb_page_t *free_pages;
+
+	/* The number of free pages
+	 */
+	int number_of_free_pages;
+
+	/* The maximum number of free pages
+	 */
+	int maximum_number_of_free_pages;
+
+	/* The bitmap of the page numbers of the resident pages
+	 */
+	uint8_t *resident_pages_bitmap;
+
+	/* The resident pages bitmap size
+	 */
+	size_t resident_pages_bitmap_size;
+};
+
+int libesedb_page_pool_initialize(
+     libesedb_page_pool_t **page_pool,
+     int maximum_number_of_free_pages,
+     libcerror_error_t **error );
+
+int libesedb_page_pool_free(
+     libesedb_page_pool_t **page_pool,
+     libcerror_error_t **error );
+
+int libesedb_page_pool_empty(
+     libesedb_page_pool_t *page_pool,
+     libcerror_error_t **error );
+
+int libesedb_page_pool_get_page(
+     libesedb_page_pool_t *page_pool,
+     libesedb_page_t **page,
+     libcerror_error_t **error );
+
+int libesedb_page_pool_release_page(
+     libesedb_page_pool_t *page_pool,
+     libesedb_page_t **page,
+     libcerror_error_t **error );
+
+int libesedb_page_pool_set_page_resident(
+     libesedb_page_pool_t *page_pool,
+     libesedb_page_t *page,
+     libcerror_error_t **error );
+
+int libesedb_page_pool_get_page_is_resident(
+     libesedb_page_pool_t *page_pool,
+     uint32_t page_number,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_PAGE_POOL_H ) */
+
@@ -770,6 +770,10 @@ int libesedb_page_tree_read_space_tree_page(
 			 page_value_data,
 			 key_size );
 
+			/* In large pages the upper 3 bits contain the page tag flags
+			 */
+			key_size &= 0x1fff;
+
 			page_value_data += 2;
 			page_value_size -= 2;
 
@@ -1244,7 +1248,7 @@ int libesedb_page_tree_read_page(
 /* TODO are defunct data definition of any value recovering
  */
 		page_value_data   = page_value->data;
-		page_value_offset = page_value->offset;
+		page_value_offset = page_value->data_offset;
 		page_value_size   = page_value->size;
 
 		if( libesedb_key_initialize(
@@ -1314,6 +1318,10 @@ int libesedb_page_tree_read_page(
 			 page_value_data,
 			 common_key_size );
 
+			/* In large pages the upper 3 bits contain the page tag flags
+			 */
+			common_key_size &= 0x1fff;
+
 			page_value_data   += 2;
 			page_value_offset += 2;
 			page_value_size   -= 2;
@@ -1385,6 +1393,8 @@ int libesedb_page_tree_read_page(
 		 page_value_data,
 		 local_key_size );
 
+		local_key_size &= 0x1fff;
+
 		page_value_data   += 2;
 		page_value_offset += 2;
 		page_value_size   -= 2;
@@ -1911,3 +1921,709 @@ on_error:
 	return( -1 );
 }
 
+
+/* Retrieves a specific page
+ * The page is owned by the pages cache and should not be freed
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_tree_get_page_by_number(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     uint32_t page_number,
+     libesedb_page_t **page,
+     libcerror_error_t **error )
+{
+	static char *function       = "libesedb_page_tree_get_page_by_number";
+	off64_t element_data_offset = 0;
+	off64_t page_offset         = 0;
+
+	if( page_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page tree - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page_number == 0 )
+	 || ( page_number > page_tree->io_handle->last_page_number ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	page_offset  = page_number - 1;
+	page_offset *= page_tree->io_handle->page_size;
+
+	if( libfdata_vector_get_element_value_at_offset(
+	     page_tree->pages_vector,
+	     (intptr_t *) file_io_handle,
+	     page_tree->pages_cache,
+	     page_offset,
+	     &element_data_offset,
+	     (intptr_t **) page,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page: %" PRIu32 " at offset: 0x%08" PRIx64 ".",
+		 function,
+		 page_number,
+		 page_offset );
+
+		return( -1 );
+	}
+	if( *page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing page: %" PRIu32 ".",
+		 function,
+		 page_number );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the key and the location of the data of a specific page value
+ * The key is optional and its data is replaced by the key of the page value
+ * The data offset is relative to the start of the page
+ * Returns 1 if successful, 0 if the page value is defunct or -1 on error
+ */
+int libesedb_page_tree_get_page_value_key(
+     libesedb_page_t *page,
+     uint16_t page_value_index,
+     libesedb_key_t *key,
+     uint16_t *data_offset,
+     uint16_t *data_size,
+     libcerror_error_t **error )
+{
+	libesedb_page_value_t *header_page_value = NULL;
+	libesedb_page_value_t *page_value        = NULL;
+	uint8_t *page_value_data                 = NULL;
+	static char *function                    = "libesedb_page_tree_get_page_value_key";
+	uint16_t common_key_size                 = 0;
+	uint16_t local_key_size                  = 0;
+	uint16_t page_value_offset               = 0;
+	uint16_t page_value_size                 = 0;
+
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_get_value(
+	     page,
+	     page_value_index,
+	     &page_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page value: %" PRIu16 ".",
+		 function,
+		 page_value_index );
+
+		return( -1 );
+	}
+	if( page_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing page value: %" PRIu16 ".",
+		 function,
+		 page_value_index );
+
+		return( -1 );
+	}
+	if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT ) != 0 )
+	{
+		return( 0 );
+	}
+	page_value_data   = page_value->data;
+	page_value_offset = page_value->data_offset;
+	page_value_size   = page_value->size;
+
+	if( key != NULL )
+	{
+		if( key->data != NULL )
+		{
+			memory_free(
+			 key->data );
+
+			key->data = NULL;
+		}
+		key->data_size = 0;
+	}
+	if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_HAS_COMMON_KEY_SIZE ) != 0 )
+	{
+		if( page_value_size < 2 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid page value: %" PRIu16 " size value out of bounds.",
+			 function,
+			 page_value_index );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 page_value_data,
+		 common_key_size );
+
+		/* In large pages the upper 3 bits contain the page tag flags
+		 */
+		common_key_size &= 0x1fff;
+
+		page_value_data   += 2;
+		page_value_offset += 2;
+		page_value_size   -= 2;
+
+		if( key != NULL )
+		{
+			if( libesedb_page_get_value(
+			     page,
+			     0,
+			     &header_page_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve page value: 0.",
+				 function );
+
+				return( -1 );
+			}
+			if( header_page_value == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing page value: 0.",
+				 function );
+
+				return( -1 );
+			}
+			if( common_key_size > header_page_value->size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: common key size exceeds header page value size.",
+				 function );
+
+				return( -1 );
+			}
+			if( libesedb_key_append_data(
+			     key,
+			     header_page_value->data,
+			     common_key_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set common key data in key.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	if( page_value_size < 2 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page value: %" PRIu16 " size value out of bounds.",
+		 function,
+		 page_value_index );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 page_value_data,
+	 local_key_size );
+
+	local_key_size &= 0x1fff;
+
+	page_value_data   += 2;
+	page_value_offset += 2;
+	page_value_size   -= 2;
+
+	if( local_key_size > page_value_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: local key size exceeds page value size.",
+		 function );
+
+		return( -1 );
+	}
+	if( key != NULL )
+	{
+		if( libesedb_key_append_data(
+		     key,
+		     page_value_data,
+		     local_key_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to append local key data to key.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( page->flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) != 0 )
+		{
+			key->type = LIBESEDB_KEY_TYPE_LEAF;
+		}
+		else
+		{
+			key->type = LIBESEDB_KEY_TYPE_BRANCH;
+		}
+	}
+	page_value_offset += local_key_size;
+	page_value_size   -= local_key_size;
+
+	*data_offset = page_value_offset;
+	*data_size   = page_value_size;
+
+	return( 1 );
+}
+
+/* Compares the key of a specific page value with a key
+ * The key of the page value is compared in place, without copying the common key
+ * and local key data, byte by byte like libesedb_key_compare_data
+ * In a branch page a page value without key is greater than any key
+ * Returns 1 if successful, 0 if the page value is defunct or -1 on error
+ */
+int libesedb_page_tree_compare_page_value_key(
+     libesedb_page_t *page,
+     uint16_t page_value_index,
+     libesedb_key_t *key,
+     int *compare_result,
+     libcerror_error_t **error )
+{
+	libesedb_page_value_t *header_page_value = NULL;
+	libesedb_page_value_t *page_value        = NULL;
+	uint8_t *common_key_data                 = NULL;
+	uint8_t *key_data                        = NULL;
+	uint8_t *local_key_data                  = NULL;
+	static char *function                    = "libesedb_page_tree_compare_page_value_key";
+	size_t compare_data_size                 = 0;
+	size_t key_data_size                     = 0;
+	uint16_t common_key_size                 = 0;
+	uint16_t local_key_size                  = 0;
+	uint16_t page_value_size                 = 0;
+	int result                               = 0;
+
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key->data == NULL )
+	 && ( key->data_size > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid key - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compare_result == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compare result.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_get_value(
+	     page,
+	     page_value_index,
+	     &page_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page value: %" PRIu16 ".",
+		 function,
+		 page_value_index );
+
+		return( -1 );
+	}
+	if( page_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing page value: %" PRIu16 ".",
+		 function,
+		 page_value_index );
+
+		return( -1 );
+	}
+	if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT ) != 0 )
+	{
+		return( 0 );
+	}
+	local_key_data  = page_value->data;
+	page_value_size = page_value->size;
+
+	if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_HAS_COMMON_KEY_SIZE ) != 0 )
+	{
+		if( page_value_size < 2 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid page value: %" PRIu16 " size value out of bounds.",
+			 function,
+			 page_value_index );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 local_key_data,
+		 common_key_size );
+
+		/* In large pages the upper 3 bits contain the page tag flags
+		 */
+		common_key_size &= 0x1fff;
+
+		local_key_data  += 2;
+		page_value_size -= 2;
+
+		if( libesedb_page_get_value(
+		     page,
+		     0,
+		     &header_page_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page value: 0.",
+			 function );
+
+			return( -1 );
+		}
+		if( header_page_value == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing page value: 0.",
+			 function );
+
+			return( -1 );
+		}
+		if( common_key_size > header_page_value->size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: common key size exceeds header page value size.",
+			 function );
+
+			return( -1 );
+		}
+		common_key_data = header_page_value->data;
+	}
+	if( page_value_size < 2 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page value: %" PRIu16 " size value out of bounds.",
+		 function,
+		 page_value_index );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 local_key_data,
+	 local_key_size );
+
+	local_key_size &= 0x1fff;
+
+	local_key_data  += 2;
+	page_value_size -= 2;
+
+	if( local_key_size > page_value_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: local key size exceeds page value size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( page->flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) == 0 )
+	 && ( common_key_size == 0 )
+	 && ( local_key_size == 0 ) )
+	{
+		*compare_result = LIBFDATA_COMPARE_GREATER;
+
+		return( 1 );
+	}
+	key_data      = key->data;
+	key_data_size = key->data_size;
+
+	/* The key of the page value consists of the common key followed by the local key
+	 */
+	if( common_key_size > 0 )
+	{
+		if( key_data_size < (size_t) common_key_size )
+		{
+			compare_data_size = key_data_size;
+		}
+		else
+		{
+			compare_data_size = (size_t) common_key_size;
+		}
+		if( compare_data_size > 0 )
+		{
+			result = memory_compare(
+			          common_key_data,
+			          key_data,
+			          compare_data_size );
+		}
+		key_data      += compare_data_size;
+		key_data_size -= compare_data_size;
+	}
+	if( ( result == 0 )
+	 && ( local_key_size > 0 )
+	 && ( key_data_size > 0 ) )
+	{
+		if( key_data_size < (size_t) local_key_size )
+		{
+			compare_data_size = key_data_size;
+		}
+		else
+		{
+			compare_data_size = (size_t) local_key_size;
+		}
+		result = memory_compare(
+		          local_key_data,
+		          key_data,
+		          compare_data_size );
+	}
+	if( result < 0 )
+	{
+		*compare_result = LIBFDATA_COMPARE_LESS;
+	}
+	else if( result > 0 )
+	{
+		*compare_result = LIBFDATA_COMPARE_GREATER;
+	}
+	else if( ( (size_t) common_key_size + (size_t) local_key_size ) < key->data_size )
+	{
+		*compare_result = LIBFDATA_COMPARE_LESS;
+	}
+	else if( ( (size_t) common_key_size + (size_t) local_key_size ) > key->data_size )
+	{
+		*compare_result = LIBFDATA_COMPARE_GREATER;
+	}
+	else
+	{
+		*compare_result = LIBFDATA_COMPARE_EQUAL;
+	}
+	return( 1 );
+}
+
+/* Retrieves the child page number of a specific branch page value
+ * Returns 1 if successful, 0 if the page value is defunct or -1 on error
+ */
+int libesedb_page_tree_get_child_page_number(
+     libesedb_page_t *page,
+     uint16_t page_value_index,
+     uint32_t *child_page_number,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_page_tree_get_child_page_number";
+	uint16_t data_offset  = 0;
+	uint16_t data_size    = 0;
+	int result            = 0;
+
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( child_page_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid child page number.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_page_tree_get_page_value_key(
+	          page,
+	          page_value_index,
+	          NULL,
+	          &data_offset,
+	          &data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page value: %" PRIu16 " key.",
+		 function,
+		 page_value_index );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( ( data_size < 4 )
+	 || ( (size_t) data_offset > ( page->data_size - 4 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page value: %" PRIu16 " data size value out of bounds.",
+		 function,
+		 page_value_index );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( page->data[ data_offset ] ),
+	 *child_page_number );
+
+	return( 1 );
+}
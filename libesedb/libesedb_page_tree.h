@@ -26,10 +26,12 @@
 #include <types.h>
 
 #include "libesedb_io_handle.h"
+#include "libesedb_key.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
+#include "libesedb_page.h"
 #include "libesedb_table_definition.h"
 
 #if defined( __cplusplus )
@@ -126,6 +128,34 @@ int libesedb_page_tree_read_leaf_value(
      uint8_t read_flags,
      libcerror_error_t **error );
 
+int libesedb_page_tree_get_page_by_number(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     uint32_t page_number,
+     libesedb_page_t **page,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_get_page_value_key(
+     libesedb_page_t *page,
+     uint16_t page_value_index,
+     libesedb_key_t *key,
+     uint16_t *data_offset,
+     uint16_t *data_size,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_compare_page_value_key(
+     libesedb_page_t *page,
+     uint16_t page_value_index,
+     libesedb_key_t *key,
+     int *compare_result,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_get_child_page_number(
+     libesedb_page_t *page,
+     uint16_t page_value_index,
+     uint32_t *child_page_number,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,1671 @@
+/*
+ * Page tree cursor functions
+ *
+ * Copyright (C) 2009-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libesedb_data_definition.h"
+#include "libesedb_definitions.h"
+#include "libesedb_io_handle.h"
+#include "libesedb_key.h"
+#include "libesedb_libbfio.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_libfdata.h"
+#include "libesedb_page.h"
+#include "libesedb_page_tree.h"
+#include "libesedb_page_tree_cursor.h"
+
+/* Creates a page tree cursor
+ * Make sure the value page_tree_cursor is referencing, is set to NULL
+ * The page tree is referenced by the cursor and must remain valid while the cursor is used
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_tree_cursor_initialize(
+     libesedb_page_tree_cursor_t **page_tree_cursor,
+     libesedb_page_tree_t *page_tree,
+     uint32_t root_page_number,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_page_tree_cursor_initialize";
+
+	if( page_tree_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *page_tree_cursor != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid page tree cursor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree.",
+		 function );
+
+		return( -1 );
+	}
+	*page_tree_cursor = memory_allocate_structure(
+	                     libesedb_page_tree_cursor_t );
+
+	if( *page_tree_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create page tree cursor.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *page_tree_cursor,
+	     0,
+	     sizeof( libesedb_page_tree_cursor_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear page tree cursor.",
+		 function );
+
+		goto on_error;
+	}
+	( *page_tree_cursor )->page_tree        = page_tree;
+	( *page_tree_cursor )->root_page_number = root_page_number;
+
+	return( 1 );
+
+on_error:
+	if( *page_tree_cursor != NULL )
+	{
+		memory_free(
+		 *page_tree_cursor );
+
+		*page_tree_cursor = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a page tree cursor
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_tree_cursor_free(
+     libesedb_page_tree_cursor_t **page_tree_cursor,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_page_tree_cursor_free";
+
+	if( page_tree_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *page_tree_cursor != NULL )
+	{
+		/* The page_tree reference is freed elsewhere
+		 */
+		memory_free(
+		 *page_tree_cursor );
+
+		*page_tree_cursor = NULL;
+	}
+	return( 1 );
+}
+
+/* Retrieves the page number of the first or last leaf page
+ * Descends from the root page following the first or last child page of every branch page
+ * and sets the parent page number of the cursor to the branch page that references the leaf page
+ * Returns 1 if successful, 0 if the page tree has no leaf page or -1 on error
+ */
+int libesedb_page_tree_cursor_get_outer_leaf_page_number(
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libbfio_handle_t *file_io_handle,
+     uint8_t last_leaf_page,
+     uint32_t *leaf_page_number,
+     libcerror_error_t **error )
+{
+	libesedb_page_t *page          = NULL;
+	static char *function          = "libesedb_page_tree_cursor_get_outer_leaf_page_number";
+	uint32_t child_page_number     = 0;
+	uint32_t page_number           = 0;
+	uint16_t number_of_page_values = 0;
+	int page_tree_depth            = 0;
+	int page_value_index           = 0;
+	int result                     = 0;
+
+	if( page_tree_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( leaf_page_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid leaf page number.",
+		 function );
+
+		return( -1 );
+	}
+	page_number = page_tree_cursor->root_page_number;
+
+	page_tree_cursor->parent_page_number = 0;
+
+	for( page_tree_depth = 0;
+	     page_tree_depth < LIBESEDB_MAXIMUM_PAGE_TREE_DEPTH;
+	     page_tree_depth++ )
+	{
+		if( libesedb_page_tree_get_page_by_number(
+		     page_tree_cursor->page_tree,
+		     file_io_handle,
+		     page_number,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page: %" PRIu32 ".",
+			 function,
+			 page_number );
+
+			return( -1 );
+		}
+		if( ( page->flags & LIBESEDB_PAGE_FLAG_IS_EMPTY ) != 0 )
+		{
+			return( 0 );
+		}
+		if( ( page->flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) != 0 )
+		{
+			*leaf_page_number = page_number;
+
+			return( 1 );
+		}
+		if( libesedb_page_get_number_of_values(
+		     page,
+		     &number_of_page_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of page values.",
+			 function );
+
+			return( -1 );
+		}
+		/* The first page value contains the page header
+		 */
+		result = 0;
+
+		if( last_leaf_page == 0 )
+		{
+			for( page_value_index = 1;
+			     page_value_index < (int) number_of_page_values;
+			     page_value_index++ )
+			{
+				result = libesedb_page_tree_get_child_page_number(
+				          page,
+				          (uint16_t) page_value_index,
+				          &child_page_number,
+				          error );
+
+				if( result != 0 )
+				{
+					break;
+				}
+			}
+		}
+		else
+		{
+			for( page_value_index = (int) number_of_page_values - 1;
+			     page_value_index > 0;
+			     page_value_index-- )
+			{
+				result = libesedb_page_tree_get_child_page_number(
+				          page,
+				          (uint16_t) page_value_index,
+				          &child_page_number,
+				          error );
+
+				if( result != 0 )
+				{
+					break;
+				}
+			}
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve child page number of page: %" PRIu32 " value: %d.",
+			 function,
+			 page_number,
+			 page_value_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		page_tree_cursor->parent_page_number = page_number;
+
+		page_number = child_page_number;
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+	 "%s: invalid page tree depth value exceeds maximum.",
+	 function );
+
+	return( -1 );
+}
+
+/* Retrieves the index of the first page value with a key that is greater than or equal to the key
+ * Uses a binary search over the page values, defunct page values are skipped
+ * In a branch page a page value without key is greater than any key
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_tree_cursor_get_lower_bound_page_value_index(
+     libesedb_page_t *page,
+     libesedb_key_t *key,
+     uint16_t number_of_page_values,
+     int *page_value_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_page_tree_cursor_get_lower_bound_page_value_index";
+	int compare_result    = 0;
+	int lower_index       = 0;
+	int middle_index      = 0;
+	int probe_index       = 0;
+	int result            = 0;
+	int upper_index       = 0;
+
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_value_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page value index.",
+		 function );
+
+		return( -1 );
+	}
+	/* The first page value contains the page header
+	 */
+	lower_index = 1;
+	upper_index = (int) number_of_page_values;
+
+	while( lower_index < upper_index )
+	{
+		middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		for( probe_index = middle_index;
+		     probe_index < upper_index;
+		     probe_index++ )
+		{
+			result = libesedb_page_tree_compare_page_value_key(
+			          page,
+			          (uint16_t) probe_index,
+			          key,
+			          &compare_result,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare key of page value: %d.",
+				 function,
+				 probe_index );
+
+				return( -1 );
+			}
+			else if( result != 0 )
+			{
+				break;
+			}
+		}
+		/* All the page values from the middle index are defunct
+		 */
+		if( probe_index >= upper_index )
+		{
+			upper_index = middle_index;
+
+			continue;
+		}
+		if( compare_result == LIBFDATA_COMPARE_LESS )
+		{
+			lower_index = probe_index + 1;
+		}
+		else
+		{
+			upper_index = middle_index;
+		}
+	}
+	*page_value_index = lower_index;
+
+	return( 1 );
+}
+
+/* Positions the cursor before the first leaf value with a key that is greater than or equal to the key
+ * Descends from the root page using a binary search over the page values of every page
+ * The leaf value is retrieved by a subsequent call to libesedb_page_tree_cursor_get_next_value
+ * Returns 1 if successful, 0 if the page tree has no leaf page or -1 on error
+ */
+int libesedb_page_tree_cursor_seek(
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libbfio_handle_t *file_io_handle,
+     libesedb_key_t *key,
+     libcerror_error_t **error )
+{
+	libesedb_page_t *page          = NULL;
+	static char *function          = "libesedb_page_tree_cursor_seek";
+	uint32_t child_page_number     = 0;
+	uint32_t page_number           = 0;
+	uint32_t parent_page_number    = 0;
+	uint16_t number_of_page_values = 0;
+	int child_page_value_index     = 0;
+	int page_tree_depth            = 0;
+	int page_value_index           = 0;
+	int result                     = 0;
+
+	if( page_tree_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	page_tree_cursor->is_positioned = 0;
+
+	page_number = page_tree_cursor->root_page_number;
+
+	for( page_tree_depth = 0;
+	     page_tree_depth < LIBESEDB_MAXIMUM_PAGE_TREE_DEPTH;
+	     page_tree_depth++ )
+	{
+		if( libesedb_page_tree_get_page_by_number(
+		     page_tree_cursor->page_tree,
+		     file_io_handle,
+		     page_number,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page: %" PRIu32 ".",
+			 function,
+			 page_number );
+
+			return( -1 );
+		}
+		if( ( page->flags & LIBESEDB_PAGE_FLAG_IS_EMPTY ) != 0 )
+		{
+			result = 0;
+
+			break;
+		}
+		if( libesedb_page_get_number_of_values(
+		     page,
+		     &number_of_page_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of page values.",
+			 function );
+
+			return( -1 );
+		}
+		if( libesedb_page_tree_cursor_get_lower_bound_page_value_index(
+		     page,
+		     key,
+		     number_of_page_values,
+		     &page_value_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve lower bound page value index of page: %" PRIu32 ".",
+			 function,
+			 page_number );
+
+			return( -1 );
+		}
+		if( ( page->flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) != 0 )
+		{
+			/* The cursor is positioned on the page value before the lower bound
+			 */
+			page_tree_cursor->page_number                = page_number;
+			page_tree_cursor->page_value_index           = (uint16_t) ( page_value_index - 1 );
+			page_tree_cursor->parent_page_number         = parent_page_number;
+			page_tree_cursor->number_of_read_ahead_pages = 0;
+			page_tree_cursor->is_positioned              = 1;
+
+			result = 1;
+
+			break;
+		}
+		/* If all the keys are less than the key the leaf value can only be
+		 * in the last child page, defunct page values are skipped
+		 */
+		if( page_value_index >= (int) number_of_page_values )
+		{
+			page_value_index = (int) number_of_page_values - 1;
+		}
+		result = 0;
+
+		for( child_page_value_index = page_value_index;
+		     child_page_value_index < (int) number_of_page_values;
+		     child_page_value_index++ )
+		{
+			result = libesedb_page_tree_get_child_page_number(
+			          page,
+			          (uint16_t) child_page_value_index,
+			          &child_page_number,
+			          error );
+
+			if( result != 0 )
+			{
+				break;
+			}
+		}
+		if( result == 0 )
+		{
+			for( child_page_value_index = page_value_index - 1;
+			     child_page_value_index > 0;
+			     child_page_value_index-- )
+			{
+				result = libesedb_page_tree_get_child_page_number(
+				          page,
+				          (uint16_t) child_page_value_index,
+				          &child_page_number,
+				          error );
+
+				if( result != 0 )
+				{
+					break;
+				}
+			}
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve child page number of page: %" PRIu32 " value: %d.",
+			 function,
+			 page_number,
+			 child_page_value_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		parent_page_number = page_number;
+		page_number        = child_page_number;
+	}
+	if( page_tree_depth >= LIBESEDB_MAXIMUM_PAGE_TREE_DEPTH )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page tree depth value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Positions the cursor before the first leaf value with a key that is greater than or equal to the key
+ * If the key lies after the current leaf value the current leaf page is searched if the key lies at
+ * or before its last leaf value, otherwise the next sibling leaf page is searched if the key lies at
+ * or before its last leaf value. In all other cases the cursor descends from the root page
+ * This allows ascending keys to be resolved in a single pass over the leaf pages
+ * Returns 1 if successful, 0 if the page tree has no leaf page or -1 on error
+ */
+int libesedb_page_tree_cursor_seek_forward(
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libbfio_handle_t *file_io_handle,
+     libesedb_key_t *key,
+     libcerror_error_t **error )
+{
+	libesedb_page_t *page          = NULL;
+	static char *function          = "libesedb_page_tree_cursor_seek_forward";
+	uint32_t page_number           = 0;
+	uint16_t number_of_page_values = 0;
+	int compare_result             = 0;
+	int last_page_value_index      = 0;
+	int page_value_index           = 0;
+	int result                     = 0;
+	int sibling_page_index         = 0;
+
+	if( page_tree_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree_cursor->is_positioned != 0 )
+	{
+		page_number = page_tree_cursor->page_number;
+
+		if( libesedb_page_tree_get_page_by_number(
+		     page_tree_cursor->page_tree,
+		     file_io_handle,
+		     page_number,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page: %" PRIu32 ".",
+			 function,
+			 page_tree_cursor->page_number );
+
+			return( -1 );
+		}
+		if( ( ( page->flags & LIBESEDB_PAGE_FLAG_IS_EMPTY ) == 0 )
+		 && ( ( page->flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) != 0 ) )
+		{
+			if( libesedb_page_get_number_of_values(
+			     page,
+			     &number_of_page_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of page values.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		page_value_index = (int) page_tree_cursor->page_value_index;
+	}
+	if( ( page_value_index >= 1 )
+	 && ( page_value_index < (int) number_of_page_values ) )
+	{
+		/* The key must lie after the current leaf value
+		 */
+		result = libesedb_page_tree_compare_page_value_key(
+		          page,
+		          (uint16_t) page_value_index,
+		          key,
+		          &compare_result,
+		          error );
+
+		if( ( result == 1 )
+		 && ( compare_result != LIBFDATA_COMPARE_LESS ) )
+		{
+			result = 0;
+		}
+		/* The key must lie at or before the last leaf value of the page or otherwise
+		 * of its next sibling leaf page, defunct page values are skipped
+		 */
+		for( sibling_page_index = 0;
+		     ( result == 1 ) && ( sibling_page_index < 2 );
+		     sibling_page_index++ )
+		{
+			if( sibling_page_index > 0 )
+			{
+				if( ( page->next_page_number == 0 )
+				 || ( page->next_page_number == page_number ) )
+				{
+					result = 0;
+
+					break;
+				}
+				page_number = page->next_page_number;
+
+				if( libesedb_page_tree_get_page_by_number(
+				     page_tree_cursor->page_tree,
+				     file_io_handle,
+				     page_number,
+				     &page,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve page: %" PRIu32 ".",
+					 function,
+					 page_number );
+
+					return( -1 );
+				}
+				if( ( ( page->flags & LIBESEDB_PAGE_FLAG_IS_EMPTY ) != 0 )
+				 || ( ( page->flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) == 0 ) )
+				{
+					result = 0;
+
+					break;
+				}
+				if( libesedb_page_get_number_of_values(
+				     page,
+				     &number_of_page_values,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve number of page values.",
+					 function );
+
+					return( -1 );
+				}
+				/* The first page value contains the page header
+				 */
+				page_value_index = 0;
+			}
+			result = 0;
+
+			for( last_page_value_index = (int) number_of_page_values - 1;
+			     last_page_value_index > page_value_index;
+			     last_page_value_index-- )
+			{
+				result = libesedb_page_tree_compare_page_value_key(
+				          page,
+				          (uint16_t) last_page_value_index,
+				          key,
+				          &compare_result,
+				          error );
+
+				if( result != 0 )
+				{
+					break;
+				}
+			}
+			if( ( result == 1 )
+			 && ( compare_result != LIBFDATA_COMPARE_LESS ) )
+			{
+				break;
+			}
+			/* The key lies after the last leaf value of the page
+			 */
+			if( result != -1 )
+			{
+				result = 1;
+			}
+		}
+		if( ( result == 1 )
+		 && ( sibling_page_index >= 2 ) )
+		{
+			result = 0;
+		}
+		if( result == 1 )
+		{
+			result = libesedb_page_tree_cursor_get_lower_bound_page_value_index(
+			          page,
+			          key,
+			          number_of_page_values,
+			          &page_value_index,
+			          error );
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to search page: %" PRIu32 ".",
+			 function,
+			 page_number );
+
+			return( -1 );
+		}
+		if( result == 1 )
+		{
+			/* The cursor is positioned on the page value before the lower bound
+			 */
+			page_tree_cursor->page_number      = page_number;
+			page_tree_cursor->page_value_index = (uint16_t) ( page_value_index - 1 );
+
+			return( 1 );
+		}
+	}
+	result = libesedb_page_tree_cursor_seek(
+	          page_tree_cursor,
+	          file_io_handle,
+	          key,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to seek key.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Reads ahead a range of consecutive pages
+ * A read-ahead hint is passed to the operating system if supported,
+ * otherwise the pages are read into the pages cache with a single read
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_tree_cursor_read_ahead_pages(
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libbfio_handle_t *file_io_handle,
+     uint32_t page_number,
+     uint32_t number_of_pages,
+     libcerror_error_t **error )
+{
+	libesedb_io_handle_t *io_handle = NULL;
+	static char *function           = "libesedb_page_tree_cursor_read_ahead_pages";
+	int result                      = 0;
+
+	if( page_tree_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree_cursor->page_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page tree cursor - missing page tree.",
+		 function );
+
+		return( -1 );
+	}
+	io_handle = page_tree_cursor->page_tree->io_handle;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page tree cursor - invalid page tree - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* A corrupt page number is reported when the page is retrieved
+	 */
+	if( ( page_number == 0 )
+	 || ( page_number > io_handle->last_page_number )
+	 || ( number_of_pages == 0 ) )
+	{
+		return( 1 );
+	}
+	result = libesedb_io_handle_read_ahead_pages(
+	          io_handle,
+	          page_number,
+	          number_of_pages,
+	          error );
+
+	if( result == 0 )
+	{
+		result = libesedb_io_handle_read_pages(
+		          io_handle,
+		          file_io_handle,
+		          page_tree_cursor->page_tree->pages_vector,
+		          page_tree_cursor->page_tree->pages_cache,
+		          page_number,
+		          number_of_pages,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read-ahead: %" PRIu32 " pages from page: %" PRIu32 ".",
+		 function,
+		 number_of_pages,
+		 page_number );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads ahead the leaf pages that follow the current leaf page in the read direction
+ * The leaf page numbers are taken from the child page numbers of the parent page,
+ * or from the sibling page number of the current leaf page if the parent page is not known
+ * If read-ahead hints are supported a new set of hints is passed after half of the previous
+ * read-ahead pages have been read, otherwise the next set of pages is read into the pages cache
+ * after all of the previous read-ahead pages have been read
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_tree_cursor_read_ahead(
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libbfio_handle_t *file_io_handle,
+     uint8_t read_backwards,
+     libcerror_error_t **error )
+{
+	uint32_t page_numbers[ LIBESEDB_READ_AHEAD_NUMBER_OF_PAGES ];
+
+	libesedb_io_handle_t *io_handle             = NULL;
+	libesedb_page_t *page                       = NULL;
+	static char *function                       = "libesedb_page_tree_cursor_read_ahead";
+	uint32_t child_page_number                  = 0;
+	uint32_t maximum_number_of_read_ahead_pages = LIBESEDB_READ_AHEAD_NUMBER_OF_PAGES;
+	uint32_t minimum_number_of_read_ahead_pages = LIBESEDB_READ_AHEAD_NUMBER_OF_PAGES / 2;
+	uint32_t number_of_page_numbers             = 0;
+	uint32_t number_of_run_pages                = 0;
+	uint32_t page_number_index                  = 0;
+	uint32_t run_page_number                    = 0;
+	uint32_t sibling_page_number                = 0;
+	uint16_t number_of_page_values              = 0;
+	uint8_t read_into_cache                     = 0;
+	int maximum_number_of_cache_entries         = 0;
+	int page_value_index                        = 0;
+	int result                                  = 0;
+
+	if( page_tree_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree_cursor->page_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page tree cursor - missing page tree.",
+		 function );
+
+		return( -1 );
+	}
+	io_handle = page_tree_cursor->page_tree->io_handle;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page tree cursor - invalid page tree - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( io_handle->mapped_data == NULL )
+	 && ( io_handle->read_ahead_file_descriptor == -1 ) )
+	{
+		/* Make sure the pages read into the pages cache do not cache out each other
+		 */
+		if( libesedb_io_handle_get_maximum_number_of_cache_entries(
+		     io_handle,
+		     LIBESEDB_CACHE_TYPE_PAGES,
+		     &maximum_number_of_cache_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve maximum number of pages cache entries.",
+			 function );
+
+			return( -1 );
+		}
+		if( (uint32_t) ( maximum_number_of_cache_entries / 4 ) < maximum_number_of_read_ahead_pages )
+		{
+			maximum_number_of_read_ahead_pages = (uint32_t) ( maximum_number_of_cache_entries / 4 );
+		}
+		if( maximum_number_of_read_ahead_pages > LIBESEDB_MAXIMUM_NUMBER_OF_BATCH_READ_PAGES )
+		{
+			maximum_number_of_read_ahead_pages = LIBESEDB_MAXIMUM_NUMBER_OF_BATCH_READ_PAGES;
+		}
+		minimum_number_of_read_ahead_pages = 0;
+		read_into_cache                    = 1;
+	}
+	if( page_tree_cursor->number_of_read_ahead_pages > minimum_number_of_read_ahead_pages )
+	{
+		page_tree_cursor->number_of_read_ahead_pages -= 1;
+
+		return( 1 );
+	}
+	page_tree_cursor->number_of_read_ahead_pages = 0;
+
+	if( page_tree_cursor->parent_page_number != 0 )
+	{
+		if( libesedb_page_tree_get_page_by_number(
+		     page_tree_cursor->page_tree,
+		     file_io_handle,
+		     page_tree_cursor->parent_page_number,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve parent page: %" PRIu32 ".",
+			 function,
+			 page_tree_cursor->parent_page_number );
+
+			return( -1 );
+		}
+		if( ( page->flags & ( LIBESEDB_PAGE_FLAG_IS_EMPTY | LIBESEDB_PAGE_FLAG_IS_LEAF ) ) == 0 )
+		{
+			if( libesedb_page_get_number_of_values(
+			     page,
+			     &number_of_page_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of page values.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		/* Find the current leaf page in the child page numbers of the parent page
+		 */
+		result = 0;
+
+		for( page_value_index = 1;
+		     page_value_index < (int) number_of_page_values;
+		     page_value_index++ )
+		{
+			result = libesedb_page_tree_get_child_page_number(
+			          page,
+			          (uint16_t) page_value_index,
+			          &child_page_number,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve child page number of page: %" PRIu32 " value: %d.",
+				 function,
+				 page_tree_cursor->parent_page_number,
+				 page_value_index );
+
+				return( -1 );
+			}
+			else if( ( result != 0 )
+			      && ( child_page_number == page_tree_cursor->page_number ) )
+			{
+				break;
+			}
+			result = 0;
+		}
+		if( result == 0 )
+		{
+			/* The cursor moved beyond the leaf pages of the parent page
+			 */
+			page_tree_cursor->parent_page_number = 0;
+		}
+		else
+		{
+			/* The page numbers are gathered before any pages are read
+			 * since reading pages can cache out the parent page
+			 */
+			while( number_of_page_numbers < maximum_number_of_read_ahead_pages )
+			{
+				if( read_backwards == 0 )
+				{
+					page_value_index++;
+				}
+				else
+				{
+					page_value_index--;
+				}
+				if( ( page_value_index < 1 )
+				 || ( page_value_index >= (int) number_of_page_values ) )
+				{
+					break;
+				}
+				result = libesedb_page_tree_get_child_page_number(
+				          page,
+				          (uint16_t) page_value_index,
+				          &child_page_number,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve child page number of page: %" PRIu32 " value: %d.",
+					 function,
+					 page_tree_cursor->parent_page_number,
+					 page_value_index );
+
+					return( -1 );
+				}
+				else if( result != 0 )
+				{
+					page_numbers[ number_of_page_numbers++ ] = child_page_number;
+				}
+			}
+		}
+	}
+	if( ( number_of_page_numbers == 0 )
+	 && ( read_into_cache == 0 ) )
+	{
+		if( libesedb_page_tree_get_page_by_number(
+		     page_tree_cursor->page_tree,
+		     file_io_handle,
+		     page_tree_cursor->page_number,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page: %" PRIu32 ".",
+			 function,
+			 page_tree_cursor->page_number );
+
+			return( -1 );
+		}
+		if( read_backwards == 0 )
+		{
+			sibling_page_number = page->next_page_number;
+		}
+		else
+		{
+			sibling_page_number = page->previous_page_number;
+		}
+		if( libesedb_io_handle_read_ahead_pages(
+		     io_handle,
+		     sibling_page_number,
+		     1,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read-ahead page: %" PRIu32 ".",
+			 function,
+			 sibling_page_number );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	/* Merge consecutive leaf pages into a single read-ahead
+	 */
+	for( page_number_index = 0;
+	     page_number_index < number_of_page_numbers;
+	     page_number_index++ )
+	{
+		child_page_number = page_numbers[ page_number_index ];
+
+		if( ( number_of_run_pages > 0 )
+		 && ( number_of_run_pages < LIBESEDB_MAXIMUM_NUMBER_OF_BATCH_READ_PAGES )
+		 && ( read_backwards == 0 )
+		 && ( child_page_number == ( run_page_number + number_of_run_pages ) ) )
+		{
+			number_of_run_pages++;
+		}
+		else if( ( number_of_run_pages > 0 )
+		      && ( number_of_run_pages < LIBESEDB_MAXIMUM_NUMBER_OF_BATCH_READ_PAGES )
+		      && ( read_backwards != 0 )
+		      && ( ( child_page_number + 1 ) == run_page_number ) )
+		{
+			run_page_number = child_page_number;
+
+			number_of_run_pages++;
+		}
+		else
+		{
+			if( libesedb_page_tree_cursor_read_ahead_pages(
+			     page_tree_cursor,
+			     file_io_handle,
+			     run_page_number,
+			     number_of_run_pages,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read-ahead pages.",
+				 function );
+
+				return( -1 );
+			}
+			run_page_number     = child_page_number;
+			number_of_run_pages = 1;
+		}
+	}
+	if( libesedb_page_tree_cursor_read_ahead_pages(
+	     page_tree_cursor,
+	     file_io_handle,
+	     run_page_number,
+	     number_of_run_pages,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read-ahead pages.",
+		 function );
+
+		return( -1 );
+	}
+	page_tree_cursor->number_of_read_ahead_pages = number_of_page_numbers;
+
+	return( 1 );
+}
+
+/* Retrieves the next or previous leaf value
+ * Positions the cursor on the first or last leaf page if not positioned yet,
+ * afterwards the cursor follows the sibling page numbers of the leaf pages
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libesedb_page_tree_cursor_get_value(
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libbfio_handle_t *file_io_handle,
+     uint8_t read_backwards,
+     libesedb_key_t *key,
+     libesedb_data_definition_t *data_definition,
+     libcerror_error_t **error )
+{
+	libesedb_page_t *page            = NULL;
+	static char *function            = "libesedb_page_tree_cursor_get_value";
+	uint32_t number_of_visited_pages = 0;
+	uint32_t sibling_page_number     = 0;
+	uint16_t data_offset             = 0;
+	uint16_t data_size               = 0;
+	uint16_t number_of_page_values   = 0;
+	uint8_t is_new_page              = 0;
+	uint8_t start_at_page_end        = 0;
+	int page_value_index             = 0;
+	int result                       = 0;
+
+	if( page_tree_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree_cursor->page_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page tree cursor - missing page tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree_cursor->page_tree->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page tree cursor - invalid page tree - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree_cursor->is_positioned == 0 )
+	{
+		result = libesedb_page_tree_cursor_get_outer_leaf_page_number(
+		          page_tree_cursor,
+		          file_io_handle,
+		          read_backwards,
+		          &( page_tree_cursor->page_number ),
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve outer leaf page number.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		page_tree_cursor->page_value_index           = 0;
+		page_tree_cursor->number_of_read_ahead_pages = 0;
+		page_tree_cursor->is_positioned              = 1;
+
+		is_new_page       = 1;
+		start_at_page_end = read_backwards;
+	}
+	/* Guard against loops in the sibling page numbers
+	 */
+	while( number_of_visited_pages <= page_tree_cursor->page_tree->io_handle->last_page_number )
+	{
+		/* The read-ahead is done before the page is retrieved since it can
+		 * retrieve the parent page which can cache out the current page
+		 */
+		if( is_new_page != 0 )
+		{
+			if( libesedb_page_tree_cursor_read_ahead(
+			     page_tree_cursor,
+			     file_io_handle,
+			     read_backwards,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read-ahead pages.",
+				 function );
+
+				return( -1 );
+			}
+			is_new_page = 0;
+		}
+		if( libesedb_page_tree_get_page_by_number(
+		     page_tree_cursor->page_tree,
+		     file_io_handle,
+		     page_tree_cursor->page_number,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page: %" PRIu32 ".",
+			 function,
+			 page_tree_cursor->page_number );
+
+			return( -1 );
+		}
+		number_of_page_values = 0;
+
+		if( ( page->flags & LIBESEDB_PAGE_FLAG_IS_EMPTY ) == 0 )
+		{
+			if( ( page->flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) == 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported page: %" PRIu32 " - not a leaf page.",
+				 function,
+				 page_tree_cursor->page_number );
+
+				return( -1 );
+			}
+			if( libesedb_page_get_number_of_values(
+			     page,
+			     &number_of_page_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of page values.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( start_at_page_end != 0 )
+		{
+			page_tree_cursor->page_value_index = number_of_page_values;
+		}
+		/* The first page value contains the page header
+		 */
+		if( read_backwards == 0 )
+		{
+			page_value_index = (int) page_tree_cursor->page_value_index + 1;
+
+			if( page_value_index < 1 )
+			{
+				page_value_index = 1;
+			}
+		}
+		else
+		{
+			page_value_index = (int) page_tree_cursor->page_value_index - 1;
+
+			if( page_value_index >= (int) number_of_page_values )
+			{
+				page_value_index = (int) number_of_page_values - 1;
+			}
+		}
+		while( ( page_value_index >= 1 )
+		    && ( page_value_index < (int) number_of_page_values ) )
+		{
+			result = libesedb_page_tree_get_page_value_key(
+			          page,
+			          (uint16_t) page_value_index,
+			          key,
+			          &data_offset,
+			          &data_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve key of page: %" PRIu32 " value: %d.",
+				 function,
+				 page_tree_cursor->page_number,
+				 page_value_index );
+
+				return( -1 );
+			}
+			else if( result != 0 )
+			{
+				page_tree_cursor->page_value_index = (uint16_t) page_value_index;
+
+				data_definition->page_offset  = page_tree_cursor->page_number - 1;
+				data_definition->page_offset *= page_tree_cursor->page_tree->io_handle->page_size;
+
+				data_definition->page_number      = page_tree_cursor->page_number;
+				data_definition->page_value_index = (uint16_t) page_value_index;
+				data_definition->data_offset      = data_offset;
+				data_definition->data_size        = data_size;
+
+				return( 1 );
+			}
+			if( read_backwards == 0 )
+			{
+				page_value_index++;
+			}
+			else
+			{
+				page_value_index--;
+			}
+		}
+		if( read_backwards == 0 )
+		{
+			sibling_page_number = page->next_page_number;
+		}
+		else
+		{
+			sibling_page_number = page->previous_page_number;
+		}
+		if( sibling_page_number == 0 )
+		{
+			/* Keep the cursor past the outer value so the opposite direction still works
+			 */
+			if( read_backwards == 0 )
+			{
+				page_tree_cursor->page_value_index = number_of_page_values;
+			}
+			else
+			{
+				page_tree_cursor->page_value_index = 0;
+			}
+			return( 0 );
+		}
+		if( sibling_page_number == page_tree_cursor->page_number )
+		{
+			break;
+		}
+		page_tree_cursor->page_number      = sibling_page_number;
+		page_tree_cursor->page_value_index = 0;
+
+		is_new_page       = 1;
+		start_at_page_end = read_backwards;
+
+		number_of_visited_pages++;
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: unsupported sibling page number - loop detected.",
+	 function );
+
+	return( -1 );
+}
+
+/* Retrieves the next leaf value
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libesedb_page_tree_cursor_get_next_value(
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libbfio_handle_t *file_io_handle,
+     libesedb_key_t *key,
+     libesedb_data_definition_t *data_definition,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_page_tree_cursor_get_next_value";
+	int result            = 0;
+
+	result = libesedb_page_tree_cursor_get_value(
+	          page_tree_cursor,
+	          file_io_handle,
+	          0,
+	          key,
+	          data_definition,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve next value.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the previous leaf value
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libesedb_page_tree_cursor_get_previous_value(
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libbfio_handle_t *file_io_handle,
+     libesedb_key_t *key,
+     libesedb_data_definition_t *data_definition,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_page_tree_cursor_get_previous_value";
+	int result            = 0;
+
+	result = libesedb_page_tree_cursor_get_value(
+	          page_tree_cursor,
+	          file_io_handle,
+	          1,
+	          key,
+	          data_definition,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve previous value.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
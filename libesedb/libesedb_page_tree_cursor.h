@@ -0,0 +1,148 @@
+/*
+ * Page tree cursor functions
+ *
+ * Copyright (C) 2009-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_PAGE_TREE_CURSOR_H )
+#define _LIBESEDB_PAGE_TREE_CURSOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_data_definition.h"
+#include "libesedb_key.h"
+#include "libesedb_libbfio.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_page.h"
+#include "libesedb_page_tree.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libesedb_page_tree_cursor libesedb_page_tree_cursor_t;
+
+struct libesedb_page_tree_cursor
+{
+	/* The page tree
+	 */
+	libesedb_page_tree_t *page_tree;
+
+	/* The root page number
+	 */
+	uint32_t root_page_number;
+
+	/* The current leaf page number
+	 */
+	uint32_t page_number;
+
+	/* The current page value index
+	 */
+	uint16_t page_value_index;
+
+	/* The page number of the parent page of the current leaf page, 0 if not known
+	 */
+	uint32_t parent_page_number;
+
+	/* The number of leaf pages ahead of the current leaf page that have been read-ahead
+	 */
+	uint32_t number_of_read_ahead_pages;
+
+	/* Value to indicate the cursor is positioned on a leaf page
+	 */
+	uint8_t is_positioned;
+};
+
+int libesedb_page_tree_cursor_initialize(
+     libesedb_page_tree_cursor_t **page_tree_cursor,
+     libesedb_page_tree_t *page_tree,
+     uint32_t root_page_number,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_cursor_free(
+     libesedb_page_tree_cursor_t **page_tree_cursor,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_cursor_get_outer_leaf_page_number(
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libbfio_handle_t *file_io_handle,
+     uint8_t last_leaf_page,
+     uint32_t *leaf_page_number,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_cursor_get_lower_bound_page_value_index(
+     libesedb_page_t *page,
+     libesedb_key_t *key,
+     uint16_t number_of_page_values,
+     int *page_value_index,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_cursor_seek(
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libbfio_handle_t *file_io_handle,
+     libesedb_key_t *key,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_cursor_seek_forward(
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libbfio_handle_t *file_io_handle,
+     libesedb_key_t *key,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_cursor_read_ahead_pages(
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libbfio_handle_t *file_io_handle,
+     uint32_t page_number,
+     uint32_t number_of_pages,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_cursor_read_ahead(
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libbfio_handle_t *file_io_handle,
+     uint8_t read_backwards,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_cursor_get_value(
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libbfio_handle_t *file_io_handle,
+     uint8_t read_backwards,
+     libesedb_key_t *key,
+     libesedb_data_definition_t *data_definition,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_cursor_get_next_value(
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libbfio_handle_t *file_io_handle,
+     libesedb_key_t *key,
+     libesedb_data_definition_t *data_definition,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_cursor_get_previous_value(
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libbfio_handle_t *file_io_handle,
+     libesedb_key_t *key,
+     libesedb_data_definition_t *data_definition,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_PAGE_TREE_CURSOR_H ) */
+
@@ -44,9 +44,17 @@ struct libesedb_page_value
 	uint16_t size;
 
 	/* The offset of the page value
+	 * The offset is relative to the start of the page values data
+	 * as stored in the page tag
 	 */
 	uint16_t offset;
 
+	/* The offset of the page value data
+	 * The offset is relative to the start of the page and is set
+	 * when the page value data is resolved
+	 */
+	uint16_t data_offset;
+
 	/* The flags of the value
 	 */
 	uint8_t flags;
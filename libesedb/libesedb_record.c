@@ -23,6 +23,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libesedb_column_projection.h"
 #include "libesedb_compression.h"
 #include "libesedb_data_definition.h"
 #include "libesedb_data_segment.h"
@@ -45,6 +46,7 @@
 
 /* Creates a record
  * Make sure the value record is referencing, is set to NULL
+ * The record contains only the columns of the column projection if provided
  * Returns 1 if successful or -1 on error
  */
 int libesedb_record_initialize(
@@ -53,6 +55,7 @@ int libesedb_record_initialize(
      libesedb_io_handle_t *io_handle,
      libesedb_table_definition_t *table_definition,
      libesedb_table_definition_t *template_table_definition,
+     libesedb_column_projection_t *column_projection,
      libfdata_vector_t *pages_vector,
      libfcache_cache_t *pages_cache,
      libfdata_vector_t *long_values_pages_vector,
@@ -154,23 +157,16 @@ int libesedb_record_initialize(
 
 		goto on_error;
 	}
-	if( libesedb_data_definition_read_record(
-	     data_definition,
-	     file_io_handle,
-	     io_handle,
-	     pages_vector,
-	     pages_cache,
-	     table_definition,
-	     template_table_definition,
-	     internal_record->values_array,
-	     &( internal_record->flags ),
+	if( libesedb_column_projection_clone(
+	     &( internal_record->column_projection ),
+	     column_projection,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read data definition record.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create column projection.",
 		 function );
 
 		goto on_error;
@@ -186,6 +182,20 @@ int libesedb_record_initialize(
 	internal_record->long_values_tree          = long_values_tree;
 	internal_record->long_values_cache         = long_values_cache;
 
+	if( libesedb_record_read_data_definition(
+	     internal_record,
+	     data_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data definition record.",
+		 function );
+
+		goto on_error;
+	}
 	*record = (libesedb_record_t *) internal_record;
 
 	return( 1 );
@@ -193,6 +203,22 @@ int libesedb_record_initialize(
 on_error:
 	if( internal_record != NULL )
 	{
+		if( internal_record->column_projection != NULL )
+		{
+			libesedb_column_projection_free(
+			 &( internal_record->column_projection ),
+			 NULL );
+		}
+		if( internal_record->data_type_definitions != NULL )
+		{
+			memory_free(
+			 internal_record->data_type_definitions );
+		}
+		if( internal_record->record_data != NULL )
+		{
+			memory_free(
+			 internal_record->record_data );
+		}
 		if( internal_record->values_array != NULL )
 		{
 			libcdata_array_free(
@@ -251,12 +277,304 @@ int libesedb_record_free(
 
 			result = -1;
 		}
+		if( internal_record->column_projection != NULL )
+		{
+			if( libesedb_column_projection_free(
+			     &( internal_record->column_projection ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free column projection.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_record->data_type_definitions != NULL )
+		{
+			memory_free(
+			 internal_record->data_type_definitions );
+		}
+		if( internal_record->record_data != NULL )
+		{
+			memory_free(
+			 internal_record->record_data );
+		}
+		if( internal_record->decompressed_data != NULL )
+		{
+			memory_free(
+			 internal_record->decompressed_data );
+		}
 		memory_free(
 		 internal_record );
 	}
 	return( result );
 }
 
+/* Sets the column projection of a record
+ * The column projection is only replaced if it differs from the current one,
+ * in which case the record values are freed
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_set_column_projection(
+     libesedb_internal_record_t *internal_record,
+     libesedb_column_projection_t *column_projection,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_record_set_column_projection";
+
+	if( internal_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_record->column_projection == NULL )
+	 && ( column_projection == NULL ) )
+	{
+		return( 1 );
+	}
+	if( ( internal_record->column_projection != NULL )
+	 && ( column_projection != NULL )
+	 && ( internal_record->column_projection->number_of_column_indexes == column_projection->number_of_column_indexes )
+	 && ( memory_compare(
+	       internal_record->column_projection->column_indexes,
+	       column_projection->column_indexes,
+	       sizeof( int ) * column_projection->number_of_column_indexes ) == 0 ) )
+	{
+		return( 1 );
+	}
+	/* The record values of the previous column projection cannot be refilled
+	 */
+	if( libcdata_array_clear(
+	     internal_record->values_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_value_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear values array.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record->column_projection != NULL )
+	{
+		if( libesedb_column_projection_free(
+		     &( internal_record->column_projection ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free column projection.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libesedb_column_projection_clone(
+	     &( internal_record->column_projection ),
+	     column_projection,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create column projection.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the record of a data definition into the record
+ * The record values of a previous read are refilled with the new record data,
+ * the record data and data type definitions buffers are reused
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_read_data_definition(
+     libesedb_internal_record_t *internal_record,
+     libesedb_data_definition_t *data_definition,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libfvalue_value_t *record_value                          = NULL;
+	static char *function                                    = "libesedb_record_read_data_definition";
+	int number_of_values                                     = 0;
+	int result                                               = 0;
+	int value_entry                                          = 0;
+
+	if( internal_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record->record_data_size = 0;
+	internal_record->flags            = 0;
+
+	if( libesedb_data_definition_read_record(
+	     data_definition,
+	     internal_record->file_io_handle,
+	     internal_record->io_handle,
+	     internal_record->pages_vector,
+	     internal_record->pages_cache,
+	     internal_record->table_definition,
+	     internal_record->template_table_definition,
+	     internal_record->column_projection,
+	     internal_record->values_array,
+	     &( internal_record->record_data ),
+	     &( internal_record->record_data_size ),
+	     &( internal_record->record_data_allocated_size ),
+	     &( internal_record->data_type_definitions ),
+	     &( internal_record->number_of_allocated_data_type_definitions ),
+	     &( internal_record->flags ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data definition record.",
+		 function );
+
+		goto on_error;
+	}
+	/* The record values of a previous read reference the previous record data
+	 * and are refilled in place, a record value that cannot be refilled is freed
+	 * and read again on next access
+	 */
+	if( libcdata_array_get_number_of_entries(
+	     internal_record->values_array,
+	     &number_of_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of values.",
+		 function );
+
+		goto on_error;
+	}
+	for( value_entry = 0;
+	     value_entry < number_of_values;
+	     value_entry++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_record->values_array,
+		     value_entry,
+		     (intptr_t **) &record_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %d from values array.",
+			 function,
+			 value_entry );
+
+			goto on_error;
+		}
+		if( record_value == NULL )
+		{
+			continue;
+		}
+		result = libesedb_record_get_column_catalog_definition(
+		          internal_record,
+		          value_entry,
+		          &column_catalog_definition,
+		          error );
+
+		if( result == 1 )
+		{
+			result = libesedb_data_definition_refill_record_value(
+			          internal_record->io_handle,
+			          column_catalog_definition,
+			          &( internal_record->data_type_definitions[ value_entry ] ),
+			          internal_record->record_data,
+			          internal_record->record_data_size,
+			          record_value,
+			          error );
+		}
+		if( result != 1 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( ( libcnotify_verbose != 0 )
+			 && ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+#endif
+			libcerror_error_free(
+			 error );
+
+			if( libcdata_array_set_entry_by_index(
+			     internal_record->values_array,
+			     value_entry,
+			     NULL,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set value: %d in values array.",
+				 function,
+				 value_entry );
+
+				goto on_error;
+			}
+			if( libfvalue_value_free(
+			     &record_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free value: %d.",
+				 function,
+				 value_entry );
+
+				goto on_error;
+			}
+		}
+	}
+	return( 1 );
+
+on_error:
+	libcdata_array_empty(
+	 internal_record->values_array,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_value_free,
+	 NULL );
+
+	return( -1 );
+}
+
 /* Retrieves the number of values in the record
  * Returns 1 if successful or -1 on error
  */
@@ -298,17 +616,19 @@ int libesedb_record_get_number_of_values(
 	return( 1 );
 }
 
-/* Retrieves the column catalog definition of the specific entry
+/* Retrieves the record value of the specific entry
+ * The record value is read from the record data on first access
  * Returns 1 if successful or -1 on error
  */
-int libesedb_record_get_column_catalog_definition(
+int libesedb_record_get_record_value(
      libesedb_internal_record_t *internal_record,
      int value_entry,
-     libesedb_catalog_definition_t **column_catalog_definition,
+     libfvalue_value_t **record_value,
      libcerror_error_t **error )
 {
-	static char *function                = "libesedb_record_get_column_identifier";
-	int template_table_number_of_columns = 0;
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libfvalue_value_t *safe_record_value                     = NULL;
+	static char *function                                    = "libesedb_record_get_record_value";
 
 	if( internal_record == NULL )
 	{
@@ -321,70 +641,261 @@ int libesedb_record_get_column_catalog_definition(
 
 		return( -1 );
 	}
-	if( internal_record->table_definition == NULL )
+	if( internal_record->data_type_definitions == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid record - missing table definition.",
+		 "%s: invalid record - missing data type definitions.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record value.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_record->template_table_definition != NULL )
+	if( libcdata_array_get_entry_by_index(
+	     internal_record->values_array,
+	     value_entry,
+	     (intptr_t **) &safe_record_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %d from values array.",
+		 function,
+		 value_entry );
+
+		return( -1 );
+	}
+	if( safe_record_value == NULL )
 	{
-		if( libcdata_list_get_number_of_elements(
-		     internal_record->template_table_definition->column_catalog_definition_list,
-		     &template_table_number_of_columns,
+		if( libesedb_record_get_column_catalog_definition(
+		     internal_record,
+		     value_entry,
+		     &column_catalog_definition,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of columns from template table.",
-			 function );
+			 "%s: unable to retrieve column catalog definition: %d.",
+			 function,
+			 value_entry );
 
-			return( -1 );
+			goto on_error;
 		}
-	}
-	if( value_entry < template_table_number_of_columns )
-	{
-		if( libcdata_list_get_value_by_index(
-		     internal_record->template_table_definition->column_catalog_definition_list,
+		if( libesedb_data_definition_read_record_value(
+		     internal_record->io_handle,
+		     column_catalog_definition,
+		     &( internal_record->data_type_definitions[ value_entry ] ),
+		     internal_record->record_data,
+		     internal_record->record_data_size,
+		     &safe_record_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read record value: %d.",
+			 function,
+			 value_entry );
+
+			goto on_error;
+		}
+		if( libcdata_array_set_entry_by_index(
+		     internal_record->values_array,
 		     value_entry,
-		     (intptr_t **) column_catalog_definition,
+		     (intptr_t *) safe_record_value,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve column catalog definition from template table.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set value: %d in values array.",
+			 function,
+			 value_entry );
 
-			return( -1 );
+			goto on_error;
 		}
 	}
-	else
+	*record_value = safe_record_value;
+
+	return( 1 );
+
+on_error:
+	if( safe_record_value != NULL )
+	{
+		libfvalue_value_free(
+		 &safe_record_value,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the column catalog definition of the specific entry
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_get_column_catalog_definition(
+     libesedb_internal_record_t *internal_record,
+     int value_entry,
+     libesedb_catalog_definition_t **column_catalog_definition,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_record_get_column_catalog_definition";
+	int column_index      = 0;
+
+	if( internal_record == NULL )
 	{
-		if( libcdata_list_get_value_by_index(
-		     internal_record->table_definition->column_catalog_definition_list,
-		     value_entry - template_table_number_of_columns,
-		     (intptr_t **) column_catalog_definition,
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record->table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record->column_projection != NULL )
+	{
+		if( libesedb_column_projection_get_column_index(
+		     internal_record->column_projection,
+		     value_entry,
+		     &column_index,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve column catalog definition from table.",
-			 function );
+			 "%s: unable to retrieve column index of value: %d.",
+			 function,
+			 value_entry );
 
 			return( -1 );
 		}
 	}
+	else
+	{
+		column_index = value_entry;
+	}
+	if( libesedb_table_definition_get_column_catalog_definition_by_index(
+	     internal_record->table_definition,
+	     column_index,
+	     column_catalog_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column catalog definition: %d.",
+		 function,
+		 column_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the data type definition of the specific entry
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_get_data_type_definition(
+     libesedb_internal_record_t *internal_record,
+     int value_entry,
+     libesedb_data_type_definition_t **data_type_definition,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_record_get_data_type_definition";
+	int number_of_values  = 0;
+
+	if( internal_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record->data_type_definitions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing data type definitions.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_type_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data type definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_record->values_array,
+	     &number_of_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_entry < 0 )
+	 || ( value_entry >= number_of_values ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value entry value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*data_type_definition = &( internal_record->data_type_definitions[ value_entry ] );
+
 	return( 1 );
 }
 
@@ -833,17 +1344,17 @@ int libesedb_record_get_value(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
+		 "%s: unable to retrieve value: %d.",
 		 function,
 		 value_entry );
 
@@ -924,17 +1435,17 @@ int libesedb_record_get_value_data_flags(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
+		 "%s: unable to retrieve value: %d.",
 		 function,
 		 value_entry );
 
@@ -986,17 +1497,17 @@ int libesedb_record_get_value_data_size(
 	}
 	internal_record = (libesedb_internal_record_t *) record;
 
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
+		 "%s: unable to retrieve value: %d.",
 		 function,
 		 value_entry );
 
@@ -1030,9 +1541,73 @@ int libesedb_record_get_value_data(
      size_t value_data_size,
      libcerror_error_t **error )
 {
-	libesedb_internal_record_t *internal_record = NULL;
-	libfvalue_value_t *record_value             = NULL;
-	static char *function                       = "libesedb_record_get_value_data";
+	libesedb_internal_record_t *internal_record = NULL;
+	libfvalue_value_t *record_value             = NULL;
+	static char *function                       = "libesedb_record_get_value_data";
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libesedb_internal_record_t *) record;
+
+	if( libesedb_record_get_record_value(
+	     internal_record,
+	     value_entry,
+	     &record_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %d.",
+		 function,
+		 value_entry );
+
+		return( -1 );
+	}
+	if( libfvalue_value_copy_data(
+	     record_value,
+	     value_data,
+	     value_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy value: %d data.",
+		 function,
+		 value_entry );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a reference to the value data of the specific entry
+ * The value data is not copied and remains valid until the record is freed
+ * or refilled by libesedb_table_get_record_into
+ * Returns 1 if successful, 0 if value is NULL or -1 on error
+ */
+int libesedb_record_get_value_data_reference(
+     libesedb_record_t *record,
+     int value_entry,
+     const uint8_t **value_data,
+     size_t *value_data_size,
+     libcerror_error_t **error )
+{
+	libesedb_data_type_definition_t *data_type_definition = NULL;
+	libesedb_internal_record_t *internal_record           = NULL;
+	static char *function                                 = "libesedb_record_get_value_data_reference";
 
 	if( record == NULL )
 	{
@@ -1047,38 +1622,65 @@ int libesedb_record_get_value_data(
 	}
 	internal_record = (libesedb_internal_record_t *) record;
 
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( value_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_record_get_data_type_definition(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &data_type_definition,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
+		 "%s: unable to retrieve data type definition: %d.",
 		 function,
 		 value_entry );
 
 		return( -1 );
 	}
-	if( libfvalue_value_copy_data(
-	     record_value,
-	     value_data,
-	     value_data_size,
-	     error ) != 1 )
+	if( data_type_definition->has_data == 0 )
+	{
+		return( 0 );
+	}
+	if( ( internal_record->record_data == NULL )
+	 || ( (size_t) data_type_definition->data_offset > internal_record->record_data_size )
+	 || ( (size_t) data_type_definition->data_size > ( internal_record->record_data_size - data_type_definition->data_offset ) ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy value: %d data.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data type definition: %d - data value out of bounds.",
 		 function,
 		 value_entry );
 
 		return( -1 );
 	}
+	*value_data      = &( internal_record->record_data[ data_type_definition->data_offset ] );
+	*value_data_size = (size_t) data_type_definition->data_size;
+
 	return( 1 );
 }
 
@@ -1152,17 +1754,17 @@ int libesedb_record_get_value_boolean(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
+		 "%s: unable to retrieve value: %d.",
 		 function,
 		 value_entry );
 
@@ -1275,17 +1877,17 @@ int libesedb_record_get_value_8bit(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
+		 "%s: unable to retrieve value: %d.",
 		 function,
 		 value_entry );
 
@@ -1399,17 +2001,17 @@ int libesedb_record_get_value_16bit(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
+		 "%s: unable to retrieve value: %d.",
 		 function,
 		 value_entry );
 
@@ -1523,17 +2125,17 @@ int libesedb_record_get_value_32bit(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
+		 "%s: unable to retrieve value: %d.",
 		 function,
 		 value_entry );
 
@@ -1648,17 +2250,17 @@ int libesedb_record_get_value_64bit(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
+		 "%s: unable to retrieve value: %d.",
 		 function,
 		 value_entry );
 
@@ -1771,17 +2373,17 @@ int libesedb_record_get_value_filetime(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
+		 "%s: unable to retrieve value: %d.",
 		 function,
 		 value_entry );
 
@@ -1896,17 +2498,17 @@ int libesedb_record_get_value_floating_point_32bit(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
+		 "%s: unable to retrieve value: %d.",
 		 function,
 		 value_entry );
 
@@ -2019,17 +2621,17 @@ int libesedb_record_get_value_floating_point_64bit(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
+		 "%s: unable to retrieve value: %d.",
 		 function,
 		 value_entry );
 
@@ -2144,17 +2746,17 @@ int libesedb_record_get_value_utf8_string_size(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
+		 "%s: unable to retrieve value: %d.",
 		 function,
 		 value_entry );
 
@@ -2254,17 +2856,17 @@ int libesedb_record_get_value_utf8_string(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
+		 "%s: unable to retrieve value: %d.",
 		 function,
 		 value_entry );
 
@@ -2363,17 +2965,17 @@ int libesedb_record_get_value_utf16_string_size(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
+		 "%s: unable to retrieve value: %d.",
 		 function,
 		 value_entry );
 
@@ -2473,17 +3075,17 @@ int libesedb_record_get_value_utf16_string(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
+		 "%s: unable to retrieve value: %d.",
 		 function,
 		 value_entry );
 
@@ -2586,17 +3188,17 @@ int libesedb_record_get_value_binary_data_size(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
+		 "%s: unable to retrieve value: %d.",
 		 function,
 		 value_entry );
 
@@ -2760,17 +3362,17 @@ int libesedb_record_get_value_binary_data(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
+		 "%s: unable to retrieve value: %d.",
 		 function,
 		 value_entry );
 
@@ -2858,6 +3460,214 @@ int libesedb_record_get_value_binary_data(
 	return( result );
 }
 
+/* Retrieves a reference to the binary data value of a specific entry
+ * The binary data is not copied and remains valid until the record is freed
+ * or refilled by libesedb_table_get_record_into
+ * Compressed binary data is decompressed into a buffer of the record that is
+ * reused by the next call to this function
+ * Returns 1 if successful, 0 if value is NULL or -1 on error
+ */
+int libesedb_record_get_value_binary_data_reference(
+     libesedb_record_t *record,
+     int value_entry,
+     const uint8_t **binary_data,
+     size_t *binary_data_size,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_data_type_definition_t *data_type_definition    = NULL;
+	libesedb_internal_record_t *internal_record              = NULL;
+	const uint8_t *entry_data                                = NULL;
+	uint8_t *reallocation                                    = NULL;
+	static char *function                                    = "libesedb_record_get_value_binary_data_reference";
+	size_t entry_data_size                                   = 0;
+	size_t uncompressed_data_size                            = 0;
+	uint32_t column_type                                     = 0;
+	int result                                               = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libesedb_internal_record_t *) record;
+
+	if( binary_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary data.",
+		 function );
+
+		return( -1 );
+	}
+	if( binary_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_record_get_column_catalog_definition(
+	     internal_record,
+	     value_entry,
+	     &column_catalog_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_catalog_definition_get_column_type(
+	     column_catalog_definition,
+	     &column_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve catalog definition column type.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( column_type != LIBESEDB_COLUMN_TYPE_BINARY_DATA )
+	 && ( column_type != LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported column type: %" PRIu32 ".",
+		 function,
+		 column_type );
+
+		return( -1 );
+	}
+	result = libesedb_record_get_value_data_reference(
+	          record,
+	          value_entry,
+	          &entry_data,
+	          &entry_data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %d data reference.",
+		 function,
+		 value_entry );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	/* The data type definition was validated by retrieving the data reference
+	 */
+	data_type_definition = &( internal_record->data_type_definitions[ value_entry ] );
+
+	if( ( data_type_definition->data_flags & LIBESEDB_VALUE_FLAG_COMPRESSED ) == 0 )
+	{
+		*binary_data      = entry_data;
+		*binary_data_size = entry_data_size;
+
+		return( 1 );
+	}
+	if( libesedb_compression_decompress_get_size(
+	     entry_data,
+	     entry_data_size,
+	     &uncompressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to determine uncompressed value: %d data size.",
+		 function,
+		 value_entry );
+
+		return( -1 );
+	}
+	if( ( uncompressed_data_size == 0 )
+	 || ( uncompressed_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed value: %d data size value out of bounds.",
+		 function,
+		 value_entry );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > internal_record->decompressed_data_allocated_size )
+	{
+		reallocation = (uint8_t *) memory_reallocate(
+		                            internal_record->decompressed_data,
+		                            sizeof( uint8_t ) * uncompressed_data_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize decompressed data.",
+			 function );
+
+			return( -1 );
+		}
+		internal_record->decompressed_data                = reallocation;
+		internal_record->decompressed_data_allocated_size = uncompressed_data_size;
+	}
+	if( libesedb_compression_decompress(
+	     entry_data,
+	     entry_data_size,
+	     internal_record->decompressed_data,
+	     uncompressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress value: %d data.",
+		 function,
+		 value_entry );
+
+		return( -1 );
+	}
+	*binary_data      = internal_record->decompressed_data;
+	*binary_data_size = uncompressed_data_size;
+
+	return( 1 );
+}
+
 /* Determines if a specific entry is a long value
  * Returns 1 if true, 0 if not or -1 on error
  */
@@ -2884,17 +3694,17 @@ int libesedb_record_is_long_value(
 	}
 	internal_record = (libesedb_internal_record_t *) record;
 
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
+		 "%s: unable to retrieve value: %d.",
 		 function,
 		 value_entry );
 
@@ -2944,17 +3754,17 @@ int libesedb_record_is_multi_value(
 	}
 	internal_record = (libesedb_internal_record_t *) record;
 
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
+		 "%s: unable to retrieve value: %d.",
 		 function,
 		 value_entry );
 
@@ -3339,17 +4149,17 @@ int libesedb_record_get_long_value(
 
 		goto on_error;
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
+		 "%s: unable to retrieve value: %d.",
 		 function,
 		 value_entry );
 
@@ -3569,17 +4379,17 @@ int libesedb_record_get_multi_value(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
+		 "%s: unable to retrieve value: %d.",
 		 function,
 		 value_entry );
 
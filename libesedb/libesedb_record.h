@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libesedb_column_projection.h"
 #include "libesedb_data_definition.h"
 #include "libesedb_extern.h"
 #include "libesedb_io_handle.h"
@@ -33,6 +34,7 @@
 #include "libesedb_libcerror.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
+#include "libesedb_libfvalue.h"
 #include "libesedb_table_definition.h"
 #include "libesedb_types.h"
 
@@ -60,6 +62,10 @@ struct libesedb_internal_record
 	 */
 	libesedb_table_definition_t *template_table_definition;
 
+	/* The column projection
+	 */
+	libesedb_column_projection_t *column_projection;
+
 	/* The pages vector
 	 */
 	libfdata_vector_t *pages_vector;
@@ -84,7 +90,37 @@ struct libesedb_internal_record
 	 */
 	libfcache_cache_t *long_values_cache;
 
+	/* The record data
+	 */
+	uint8_t *record_data;
+
+	/* The record data size
+	 */
+	size_t record_data_size;
+
+	/* The allocated record data size
+	 */
+	size_t record_data_allocated_size;
+
+	/* The data type definitions
+	 */
+	libesedb_data_type_definition_t *data_type_definitions;
+
+	/* The number of allocated data type definitions
+	 */
+	int number_of_allocated_data_type_definitions;
+
+	/* The decompressed data
+	 * used by the reference value accessors
+	 */
+	uint8_t *decompressed_data;
+
+	/* The allocated decompressed data size
+	 */
+	size_t decompressed_data_allocated_size;
+
 	/* The values array
+	 * The values are read from the record data on first access
 	 */
 	libcdata_array_t *values_array;
 
@@ -99,6 +135,7 @@ int libesedb_record_initialize(
      libesedb_io_handle_t *io_handle,
      libesedb_table_definition_t *table_definition,
      libesedb_table_definition_t *template_table_definition,
+     libesedb_column_projection_t *column_projection,
      libfdata_vector_t *pages_vector,
      libfcache_cache_t *pages_cache,
      libfdata_vector_t *long_values_pages_vector,
@@ -113,18 +150,40 @@ int libesedb_record_free(
      libesedb_record_t **record,
      libcerror_error_t **error );
 
+int libesedb_record_set_column_projection(
+     libesedb_internal_record_t *internal_record,
+     libesedb_column_projection_t *column_projection,
+     libcerror_error_t **error );
+
+int libesedb_record_read_data_definition(
+     libesedb_internal_record_t *internal_record,
+     libesedb_data_definition_t *data_definition,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_record_get_number_of_values(
      libesedb_record_t *record,
      int *number_of_values,
      libcerror_error_t **error );
 
+int libesedb_record_get_record_value(
+     libesedb_internal_record_t *internal_record,
+     int value_entry,
+     libfvalue_value_t **record_value,
+     libcerror_error_t **error );
+
 int libesedb_record_get_column_catalog_definition(
      libesedb_internal_record_t *internal_record,
      int value_entry,
      libesedb_catalog_definition_t **column_catalog_definition,
      libcerror_error_t **error );
 
+int libesedb_record_get_data_type_definition(
+     libesedb_internal_record_t *internal_record,
+     int value_entry,
+     libesedb_data_type_definition_t **data_type_definition,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_record_get_column_identifier(
      libesedb_record_t *record,
@@ -194,6 +253,14 @@ int libesedb_record_get_value_data(
      size_t value_data_size,
      libcerror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_record_get_value_data_reference(
+     libesedb_record_t *record,
+     int value_entry,
+     const uint8_t **value_data,
+     size_t *value_data_size,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_record_get_value_data_flags(
      libesedb_record_t *record,
@@ -302,6 +369,14 @@ int libesedb_record_get_value_binary_data(
      size_t binary_data_size,
      libcerror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_record_get_value_binary_data_reference(
+     libesedb_record_t *record,
+     int value_entry,
+     const uint8_t **binary_data,
+     size_t *binary_data_size,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_record_is_long_value(
      libesedb_record_t *record,
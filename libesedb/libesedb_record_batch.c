@@ -0,0 +1,1227 @@
+/*
+ * Record batch functions
+ *
+ * Copyright (C) 2009-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libesedb_catalog_definition.h"
+#include "libesedb_column_projection.h"
+#include "libesedb_compression.h"
+#include "libesedb_data_definition.h"
+#include "libesedb_definitions.h"
+#include "libesedb_libcdata.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_long_value.h"
+#include "libesedb_record.h"
+#include "libesedb_record_batch.h"
+#include "libesedb_table_definition.h"
+#include "libesedb_types.h"
+
+/* Creates a record batch
+ * Make sure the value record_batch is referencing, is set to NULL
+ * The columns of the record batch are those of the column projection or,
+ * if no column projection is provided, those of the table definition
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_batch_initialize(
+     libesedb_record_batch_t **record_batch,
+     libesedb_table_definition_t *table_definition,
+     libesedb_column_projection_t *column_projection,
+     int maximum_number_of_records,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_internal_record_batch_t *internal_record_batch  = NULL;
+	libesedb_record_batch_column_t *column                   = NULL;
+	static char *function                                    = "libesedb_record_batch_initialize";
+	size_t validity_bitmap_size                              = 0;
+	int column_index                                         = 0;
+	int table_column_index                                   = 0;
+
+	if( record_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_batch != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record batch value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	/* The largest fixed-size value is a 16 byte GUID
+	 */
+	if( ( maximum_number_of_records < 0 )
+	 || ( (size_t) maximum_number_of_records > ( (size_t) SSIZE_MAX / 16 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of records value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_batch = memory_allocate_structure(
+	                         libesedb_internal_record_batch_t );
+
+	if( internal_record_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record batch.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_record_batch,
+	     0,
+	     sizeof( libesedb_internal_record_batch_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear record batch.",
+		 function );
+
+		memory_free(
+		 internal_record_batch );
+
+		return( -1 );
+	}
+	if( column_projection != NULL )
+	{
+		internal_record_batch->number_of_columns = column_projection->number_of_column_indexes;
+	}
+	else
+	{
+		internal_record_batch->number_of_columns = table_definition->number_of_column_catalog_definitions;
+	}
+	if( internal_record_batch->number_of_columns > 0 )
+	{
+		internal_record_batch->columns = (libesedb_record_batch_column_t *) memory_allocate(
+		                                                                     sizeof( libesedb_record_batch_column_t ) * internal_record_batch->number_of_columns );
+
+		if( internal_record_batch->columns == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create columns.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     internal_record_batch->columns,
+		     0,
+		     sizeof( libesedb_record_batch_column_t ) * internal_record_batch->number_of_columns ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear columns.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	validity_bitmap_size = ( (size_t) maximum_number_of_records / 8 ) + 1;
+
+	for( column_index = 0;
+	     column_index < internal_record_batch->number_of_columns;
+	     column_index++ )
+	{
+		column = &( internal_record_batch->columns[ column_index ] );
+
+		if( column_projection != NULL )
+		{
+			if( libesedb_column_projection_get_column_index(
+			     column_projection,
+			     column_index,
+			     &table_column_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve column index of column: %d.",
+				 function,
+				 column_index );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			table_column_index = column_index;
+		}
+		if( libesedb_table_definition_get_column_catalog_definition_by_index(
+		     table_definition,
+		     table_column_index,
+		     &column_catalog_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column catalog definition: %d.",
+			 function,
+			 table_column_index );
+
+			goto on_error;
+		}
+		if( column_catalog_definition == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing column catalog definition: %d.",
+			 function,
+			 table_column_index );
+
+			goto on_error;
+		}
+		column->column_identifier = column_catalog_definition->identifier;
+		column->column_type       = column_catalog_definition->column_type;
+
+		/* Only the values of the fixed-size data type columns, identifiers 1 - 127,
+		 * are stored with the size of the column type, the values of variable-size
+		 * and tagged data type columns can be multi values or of a different size
+		 */
+		if( column->column_identifier > 127 )
+		{
+			column->value_size = 0;
+		}
+		else switch( column->column_type )
+		{
+			case LIBESEDB_COLUMN_TYPE_BOOLEAN:
+			case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
+				column->value_size = 1;
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+			case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
+				column->value_size = 2;
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
+			case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
+			case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
+				column->value_size = 4;
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_CURRENCY:
+			case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
+			case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
+			case LIBESEDB_COLUMN_TYPE_DATE_TIME:
+				column->value_size = 8;
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_GUID:
+				column->value_size = 16;
+				break;
+
+			default:
+				column->value_size = 0;
+				break;
+		}
+		column->validity_bitmap = (uint8_t *) memory_allocate(
+		                                       sizeof( uint8_t ) * validity_bitmap_size );
+
+		if( column->validity_bitmap == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create validity bitmap of column: %d.",
+			 function,
+			 column_index );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     column->validity_bitmap,
+		     0,
+		     sizeof( uint8_t ) * validity_bitmap_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear validity bitmap of column: %d.",
+			 function,
+			 column_index );
+
+			goto on_error;
+		}
+		if( column->value_size != 0 )
+		{
+			/* The value data of a fixed-size column is allocated once
+			 */
+			if( libesedb_record_batch_column_resize_value_data(
+			     column,
+			     column->value_size * (size_t) maximum_number_of_records,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+				 "%s: unable to resize value data of column: %d.",
+				 function,
+				 column_index );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			column->value_offsets = (uint32_t *) memory_allocate(
+			                                      sizeof( uint32_t ) * ( (size_t) maximum_number_of_records + 1 ) );
+
+			if( column->value_offsets == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create value offsets of column: %d.",
+				 function,
+				 column_index );
+
+				goto on_error;
+			}
+			column->value_offsets[ 0 ] = 0;
+		}
+	}
+	internal_record_batch->maximum_number_of_records = maximum_number_of_records;
+
+	*record_batch = (libesedb_record_batch_t *) internal_record_batch;
+
+	return( 1 );
+
+on_error:
+	if( internal_record_batch != NULL )
+	{
+		libesedb_record_batch_free(
+		 (libesedb_record_batch_t **) &internal_record_batch,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a record batch
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_batch_free(
+     libesedb_record_batch_t **record_batch,
+     libcerror_error_t **error )
+{
+	libesedb_internal_record_batch_t *internal_record_batch = NULL;
+	libesedb_record_batch_column_t *column                  = NULL;
+	static char *function                                   = "libesedb_record_batch_free";
+	int column_index                                        = 0;
+
+	if( record_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_batch != NULL )
+	{
+		internal_record_batch = (libesedb_internal_record_batch_t *) *record_batch;
+		*record_batch         = NULL;
+
+		if( internal_record_batch->columns != NULL )
+		{
+			for( column_index = 0;
+			     column_index < internal_record_batch->number_of_columns;
+			     column_index++ )
+			{
+				column = &( internal_record_batch->columns[ column_index ] );
+
+				if( column->validity_bitmap != NULL )
+				{
+					memory_free(
+					 column->validity_bitmap );
+				}
+				if( column->value_offsets != NULL )
+				{
+					memory_free(
+					 column->value_offsets );
+				}
+				if( column->value_data != NULL )
+				{
+					memory_free(
+					 column->value_data );
+				}
+			}
+			memory_free(
+			 internal_record_batch->columns );
+		}
+		memory_free(
+		 internal_record_batch );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific column
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_batch_get_column(
+     libesedb_internal_record_batch_t *internal_record_batch,
+     int column_index,
+     libesedb_record_batch_column_t **column,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_record_batch_get_column";
+
+	if( internal_record_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( column_index < 0 )
+	 || ( column_index >= internal_record_batch->number_of_columns ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid column index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column.",
+		 function );
+
+		return( -1 );
+	}
+	*column = &( internal_record_batch->columns[ column_index ] );
+
+	return( 1 );
+}
+
+/* Resizes the value data of a column to contain at least a specific size
+ * The value data grows by doubling its allocated size
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_batch_column_resize_value_data(
+     libesedb_record_batch_column_t *column,
+     size_t value_data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocation = NULL;
+	static char *function = "libesedb_record_batch_column_resize_value_data";
+	size_t allocated_size = 0;
+
+	if( column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid value data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_data_size == 0 )
+	 || ( value_data_size <= column->value_data_allocated_size ) )
+	{
+		return( 1 );
+	}
+	allocated_size = column->value_data_allocated_size;
+
+	if( allocated_size < 4096 )
+	{
+		allocated_size = 4096;
+	}
+	while( allocated_size < value_data_size )
+	{
+		if( allocated_size > ( (size_t) SSIZE_MAX / 2 ) )
+		{
+			allocated_size = value_data_size;
+
+			break;
+		}
+		allocated_size *= 2;
+	}
+	if( column->value_size != 0 )
+	{
+		/* The value data of a fixed-size column is not grown afterwards
+		 */
+		allocated_size = value_data_size;
+	}
+	reallocation = (uint8_t *) memory_reallocate(
+	                            column->value_data,
+	                            sizeof( uint8_t ) * allocated_size );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize value data.",
+		 function );
+
+		return( -1 );
+	}
+	column->value_data                = reallocation;
+	column->value_data_allocated_size = allocated_size;
+
+	return( 1 );
+}
+
+/* Appends the values of a record to the record batch
+ * The record must have been read with the same columns as the record batch
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_batch_append_record(
+     libesedb_internal_record_batch_t *internal_record_batch,
+     libesedb_internal_record_t *internal_record,
+     libcerror_error_t **error )
+{
+	libesedb_data_type_definition_t *data_type_definition = NULL;
+	libesedb_long_value_t *long_value                     = NULL;
+	libesedb_record_batch_column_t *column                = NULL;
+	const uint8_t *value_data                             = NULL;
+	static char *function                                 = "libesedb_record_batch_append_record";
+	size64_t long_value_data_size                         = 0;
+	size_t append_data_size                               = 0;
+	size_t value_data_size                                = 0;
+	int column_index                                      = 0;
+	int number_of_values                                  = 0;
+	int record_index                                      = 0;
+	int result                                            = 0;
+
+	if( internal_record_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record_batch->number_of_records >= internal_record_batch->maximum_number_of_records )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid record batch - number of records exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_record->values_array,
+	     &number_of_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of values.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values != internal_record_batch->number_of_columns )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported record - number of values does not match number of columns.",
+		 function );
+
+		return( -1 );
+	}
+	record_index = internal_record_batch->number_of_records;
+
+	for( column_index = 0;
+	     column_index < internal_record_batch->number_of_columns;
+	     column_index++ )
+	{
+		column = &( internal_record_batch->columns[ column_index ] );
+
+		if( libesedb_record_get_data_type_definition(
+		     internal_record,
+		     column_index,
+		     &data_type_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data type definition: %d.",
+			 function,
+			 column_index );
+
+			goto on_error;
+		}
+		result = libesedb_record_get_value_data_reference(
+		          (libesedb_record_t *) internal_record,
+		          column_index,
+		          &value_data,
+		          &value_data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %d data reference.",
+			 function,
+			 column_index );
+
+			goto on_error;
+		}
+		if( column->value_size != 0 )
+		{
+			/* Fixed-size values are stored packed, a NULL value is stored as 0-byte values
+			 */
+			if( result == 0 )
+			{
+				if( memory_set(
+				     &( column->value_data[ record_index * column->value_size ] ),
+				     0,
+				     column->value_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+					 "%s: unable to clear value: %d data.",
+					 function,
+					 column_index );
+
+					goto on_error;
+				}
+			}
+			else
+			{
+				if( ( data_type_definition->data_flags != 0 )
+				 || ( value_data_size != column->value_size ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+					 "%s: unsupported value: %d data flags: 0x%02" PRIx8 " or size: %" PRIzd " of fixed-size column.",
+					 function,
+					 column_index,
+					 data_type_definition->data_flags,
+					 value_data_size );
+
+					goto on_error;
+				}
+				if( memory_copy(
+				     &( column->value_data[ record_index * column->value_size ] ),
+				     value_data,
+				     column->value_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy value: %d data.",
+					 function,
+					 column_index );
+
+					goto on_error;
+				}
+			}
+			column->value_data_size += column->value_size;
+		}
+		else if( result != 0 )
+		{
+			/* Long values and compressed values are stored as their data
+			 * multi values are stored as in the record data
+			 */
+			if( ( ( data_type_definition->data_flags & LIBESEDB_VALUE_FLAG_LONG_VALUE ) != 0 )
+			 && ( ( data_type_definition->data_flags & LIBESEDB_VALUE_FLAG_MULTI_VALUE ) == 0 ) )
+			{
+				if( libesedb_record_get_long_value(
+				     (libesedb_record_t *) internal_record,
+				     column_index,
+				     &long_value,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve long value: %d.",
+					 function,
+					 column_index );
+
+					goto on_error;
+				}
+				if( libesedb_long_value_get_data_size(
+				     long_value,
+				     &long_value_data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve long value: %d data size.",
+					 function,
+					 column_index );
+
+					goto on_error;
+				}
+				if( long_value_data_size > (size64_t) UINT32_MAX )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid long value: %d data size value out of bounds.",
+					 function,
+					 column_index );
+
+					goto on_error;
+				}
+				append_data_size = (size_t) long_value_data_size;
+			}
+			else if( ( ( data_type_definition->data_flags & LIBESEDB_VALUE_FLAG_COMPRESSED ) != 0 )
+			      && ( ( data_type_definition->data_flags & LIBESEDB_VALUE_FLAG_MULTI_VALUE ) == 0 ) )
+			{
+				if( libesedb_compression_decompress_get_size(
+				     value_data,
+				     value_data_size,
+				     &append_data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+					 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+					 "%s: unable to determine uncompressed value: %d data size.",
+					 function,
+					 column_index );
+
+					goto on_error;
+				}
+			}
+			else
+			{
+				append_data_size = value_data_size;
+			}
+			/* The value offsets are 32-bit
+			 */
+			if( append_data_size > ( (size_t) UINT32_MAX - column->value_data_size ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid value: %d data size value out of bounds.",
+				 function,
+				 column_index );
+
+				goto on_error;
+			}
+			if( append_data_size > 0 )
+			{
+				if( libesedb_record_batch_column_resize_value_data(
+				     column,
+				     column->value_data_size + append_data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+					 "%s: unable to resize value data of column: %d.",
+					 function,
+					 column_index );
+
+					goto on_error;
+				}
+				if( long_value != NULL )
+				{
+					result = libesedb_long_value_get_data(
+					          long_value,
+					          &( column->value_data[ column->value_data_size ] ),
+					          append_data_size,
+					          error );
+				}
+				else if( ( data_type_definition->data_flags & ( LIBESEDB_VALUE_FLAG_COMPRESSED | LIBESEDB_VALUE_FLAG_MULTI_VALUE ) ) == LIBESEDB_VALUE_FLAG_COMPRESSED )
+				{
+					result = libesedb_compression_decompress(
+					          value_data,
+					          value_data_size,
+					          &( column->value_data[ column->value_data_size ] ),
+					          append_data_size,
+					          error );
+				}
+				else if( memory_copy(
+				          &( column->value_data[ column->value_data_size ] ),
+				          value_data,
+				          append_data_size ) == NULL )
+				{
+					result = -1;
+				}
+				if( result != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+					 "%s: unable to copy value: %d data.",
+					 function,
+					 column_index );
+
+					goto on_error;
+				}
+				column->value_data_size += append_data_size;
+			}
+			if( long_value != NULL )
+			{
+				if( libesedb_long_value_free(
+				     &long_value,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free long value.",
+					 function );
+
+					goto on_error;
+				}
+			}
+		}
+		if( column->value_offsets != NULL )
+		{
+			column->value_offsets[ record_index + 1 ] = (uint32_t) column->value_data_size;
+		}
+		if( result != 0 )
+		{
+			column->validity_bitmap[ record_index / 8 ] |= (uint8_t) ( 1 << ( record_index % 8 ) );
+		}
+	}
+	internal_record_batch->number_of_records += 1;
+
+	return( 1 );
+
+on_error:
+	if( long_value != NULL )
+	{
+		libesedb_long_value_free(
+		 &long_value,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of records
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_batch_get_number_of_records(
+     libesedb_record_batch_t *record_batch,
+     int *number_of_records,
+     libcerror_error_t **error )
+{
+	libesedb_internal_record_batch_t *internal_record_batch = NULL;
+	static char *function                                   = "libesedb_record_batch_get_number_of_records";
+
+	if( record_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record batch.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_batch = (libesedb_internal_record_batch_t *) record_batch;
+
+	if( number_of_records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of records.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_records = internal_record_batch->number_of_records;
+
+	return( 1 );
+}
+
+/* Retrieves the number of columns
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_batch_get_number_of_columns(
+     libesedb_record_batch_t *record_batch,
+     int *number_of_columns,
+     libcerror_error_t **error )
+{
+	libesedb_internal_record_batch_t *internal_record_batch = NULL;
+	static char *function                                   = "libesedb_record_batch_get_number_of_columns";
+
+	if( record_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record batch.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_batch = (libesedb_internal_record_batch_t *) record_batch;
+
+	if( number_of_columns == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of columns.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_columns = internal_record_batch->number_of_columns;
+
+	return( 1 );
+}
+
+/* Retrieves the column identifier of a specific column
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_batch_get_column_identifier(
+     libesedb_record_batch_t *record_batch,
+     int column_index,
+     uint32_t *column_identifier,
+     libcerror_error_t **error )
+{
+	libesedb_record_batch_column_t *column = NULL;
+	static char *function                  = "libesedb_record_batch_get_column_identifier";
+
+	if( column_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_record_batch_get_column(
+	     (libesedb_internal_record_batch_t *) record_batch,
+	     column_index,
+	     &column,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column: %d.",
+		 function,
+		 column_index );
+
+		return( -1 );
+	}
+	*column_identifier = column->column_identifier;
+
+	return( 1 );
+}
+
+/* Retrieves the column type of a specific column
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_batch_get_column_type(
+     libesedb_record_batch_t *record_batch,
+     int column_index,
+     uint32_t *column_type,
+     libcerror_error_t **error )
+{
+	libesedb_record_batch_column_t *column = NULL;
+	static char *function                  = "libesedb_record_batch_get_column_type";
+
+	if( column_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column type.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_record_batch_get_column(
+	     (libesedb_internal_record_batch_t *) record_batch,
+	     column_index,
+	     &column,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column: %d.",
+		 function,
+		 column_index );
+
+		return( -1 );
+	}
+	*column_type = column->column_type;
+
+	return( 1 );
+}
+
+/* Retrieves the value size of a specific column
+ * The value size is 0 for a variable-size or tagged data type column
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_batch_get_column_value_size(
+     libesedb_record_batch_t *record_batch,
+     int column_index,
+     size_t *value_size,
+     libcerror_error_t **error )
+{
+	libesedb_record_batch_column_t *column = NULL;
+	static char *function                  = "libesedb_record_batch_get_column_value_size";
+
+	if( value_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_record_batch_get_column(
+	     (libesedb_internal_record_batch_t *) record_batch,
+	     column_index,
+	     &column,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column: %d.",
+		 function,
+		 column_index );
+
+		return( -1 );
+	}
+	*value_size = column->value_size;
+
+	return( 1 );
+}
+
+/* Retrieves the buffers of a specific column
+ * The validity bitmap contains a bit per record, starting with the least significant bit,
+ * that is set if the value of the record is not NULL
+ * The values of a fixed-size column are stored packed in the value data
+ * and value offsets is set to NULL
+ * The values of a variable-size column are stored consecutively in the value data
+ * and value offsets contains the number of records + 1 offsets of the values
+ * The buffers are owned by the record batch and remain valid until it is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_batch_get_column_buffers(
+     libesedb_record_batch_t *record_batch,
+     int column_index,
+     const uint8_t **validity_bitmap,
+     const uint32_t **value_offsets,
+     const uint8_t **value_data,
+     size_t *value_data_size,
+     libcerror_error_t **error )
+{
+	libesedb_record_batch_column_t *column = NULL;
+	static char *function                  = "libesedb_record_batch_get_column_buffers";
+
+	if( validity_bitmap == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid validity bitmap.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_record_batch_get_column(
+	     (libesedb_internal_record_batch_t *) record_batch,
+	     column_index,
+	     &column,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column: %d.",
+		 function,
+		 column_index );
+
+		return( -1 );
+	}
+	*validity_bitmap = column->validity_bitmap;
+	*value_offsets   = column->value_offsets;
+	*value_data      = column->value_data;
+	*value_data_size = column->value_data_size;
+
+	return( 1 );
+}
@@ -0,0 +1,173 @@
+/*
+ * Record batch functions
+ *
+ * Copyright (C) 2009-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_RECORD_BATCH_H )
+#define _LIBESEDB_RECORD_BATCH_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_column_projection.h"
+#include "libesedb_extern.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_record.h"
+#include "libesedb_table_definition.h"
+#include "libesedb_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libesedb_record_batch_column libesedb_record_batch_column_t;
+typedef struct libesedb_internal_record_batch libesedb_internal_record_batch_t;
+
+struct libesedb_record_batch_column
+{
+	/* The column identifier
+	 */
+	uint32_t column_identifier;
+
+	/* The column type
+	 */
+	uint32_t column_type;
+
+	/* The value size of a fixed-size data type column or 0 for a variable-size or tagged data type column
+	 */
+	size_t value_size;
+
+	/* The validity bitmap, a set bit indicates the value of the corresponding record is not NULL
+	 */
+	uint8_t *validity_bitmap;
+
+	/* The value offsets of a variable-size column
+	 * contains the number of records + 1 offsets
+	 */
+	uint32_t *value_offsets;
+
+	/* The value data
+	 */
+	uint8_t *value_data;
+
+	/* The value data size
+	 */
+	size_t value_data_size;
+
+	/* The allocated value data size
+	 */
+	size_t value_data_allocated_size;
+};
+
+struct libesedb_internal_record_batch
+{
+	/* The columns
+	 */
+	libesedb_record_batch_column_t *columns;
+
+	/* The number of columns
+	 */
+	int number_of_columns;
+
+	/* The number of records
+	 */
+	int number_of_records;
+
+	/* The maximum number of records
+	 */
+	int maximum_number_of_records;
+};
+
+int libesedb_record_batch_initialize(
+     libesedb_record_batch_t **record_batch,
+     libesedb_table_definition_t *table_definition,
+     libesedb_column_projection_t *column_projection,
+     int maximum_number_of_records,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_record_batch_free(
+     libesedb_record_batch_t **record_batch,
+     libcerror_error_t **error );
+
+int libesedb_record_batch_get_column(
+     libesedb_internal_record_batch_t *internal_record_batch,
+     int column_index,
+     libesedb_record_batch_column_t **column,
+     libcerror_error_t **error );
+
+int libesedb_record_batch_column_resize_value_data(
+     libesedb_record_batch_column_t *column,
+     size_t value_data_size,
+     libcerror_error_t **error );
+
+int libesedb_record_batch_append_record(
+     libesedb_internal_record_batch_t *internal_record_batch,
+     libesedb_internal_record_t *internal_record,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_record_batch_get_number_of_records(
+     libesedb_record_batch_t *record_batch,
+     int *number_of_records,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_record_batch_get_number_of_columns(
+     libesedb_record_batch_t *record_batch,
+     int *number_of_columns,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_record_batch_get_column_identifier(
+     libesedb_record_batch_t *record_batch,
+     int column_index,
+     uint32_t *column_identifier,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_record_batch_get_column_type(
+     libesedb_record_batch_t *record_batch,
+     int column_index,
+     uint32_t *column_type,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_record_batch_get_column_value_size(
+     libesedb_record_batch_t *record_batch,
+     int column_index,
+     size_t *value_size,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_record_batch_get_column_buffers(
+     libesedb_record_batch_t *record_batch,
+     int column_index,
+     const uint8_t **validity_bitmap,
+     const uint32_t **value_offsets,
+     const uint8_t **value_data,
+     size_t *value_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_RECORD_BATCH_H ) */
+
@@ -0,0 +1,882 @@
+/*
+ * Record filter functions
+ *
+ * Copyright (C) 2009-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libesedb_catalog_definition.h"
+#include "libesedb_data_definition.h"
+#include "libesedb_definitions.h"
+#include "libesedb_io_handle.h"
+#include "libesedb_libbfio.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_libfcache.h"
+#include "libesedb_libfdata.h"
+#include "libesedb_record_filter.h"
+#include "libesedb_table_definition.h"
+
+#include "esedb_page_values.h"
+
+/* Creates a record filter
+ * Make sure the value record_filter is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_filter_initialize(
+     libesedb_record_filter_t **record_filter,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_record_filter_initialize";
+
+	if( record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_filter != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record filter value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*record_filter = memory_allocate_structure(
+	                  libesedb_record_filter_t );
+
+	if( *record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record filter.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *record_filter,
+	     0,
+	     sizeof( libesedb_record_filter_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear record filter.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *record_filter != NULL )
+	{
+		memory_free(
+		 *record_filter );
+
+		*record_filter = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a record filter
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_filter_free(
+     libesedb_record_filter_t **record_filter,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_record_filter_free";
+	int condition_index   = 0;
+
+	if( record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_filter != NULL )
+	{
+		if( ( *record_filter )->conditions != NULL )
+		{
+			for( condition_index = 0;
+			     condition_index < ( *record_filter )->number_of_conditions;
+			     condition_index++ )
+			{
+				if( ( *record_filter )->conditions[ condition_index ].values != NULL )
+				{
+					memory_free(
+					 ( *record_filter )->conditions[ condition_index ].values );
+				}
+			}
+			memory_free(
+			 ( *record_filter )->conditions );
+		}
+		memory_free(
+		 *record_filter );
+
+		*record_filter = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends a condition to the record filter
+ * The condition compares the value of a fixed-size column with the value, which is
+ * stored in the same (little-endian) format as in the record
+ * For the in set operator the value contains multiple consecutive values
+ * A record where the value of the column is NULL does not match the condition
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_filter_append_condition(
+     libesedb_record_filter_t *record_filter,
+     libesedb_table_definition_t *table_definition,
+     uint32_t column_identifier,
+     int filter_operator,
+     const uint8_t *value,
+     size_t value_size,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_record_filter_condition_t *condition            = NULL;
+	void *reallocation                                       = NULL;
+	uint8_t *values                                          = NULL;
+	static char *function                                    = "libesedb_record_filter_append_condition";
+	size_t column_value_size                                 = 0;
+	size_t value_offset                                      = 0;
+	int column_catalog_definition_index                      = 0;
+	int column_index                                         = 0;
+	int result                                               = 0;
+
+	if( record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( filter_operator < LIBESEDB_FILTER_OPERATOR_EQUAL )
+	 || ( filter_operator > LIBESEDB_FILTER_OPERATOR_IN_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported filter operator: %d.",
+		 function,
+		 filter_operator );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_size == 0 )
+	 || ( value_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_table_definition_get_column_index_by_identifier(
+	          table_definition,
+	          column_identifier,
+	          &column_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column index of column: %" PRIu32 ".",
+		 function,
+		 column_identifier );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported column identifier: %" PRIu32 ".",
+		 function,
+		 column_identifier );
+
+		return( -1 );
+	}
+	/* Only the values of fixed-size columns are stored at a fixed offset in the record data
+	 */
+	if( column_identifier > 127 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported column: %" PRIu32 " - only fixed-size columns are supported.",
+		 function,
+		 column_identifier );
+
+		return( -1 );
+	}
+	value_offset = sizeof( esedb_data_definition_header_t );
+
+	for( column_catalog_definition_index = 0;
+	     column_catalog_definition_index <= column_index;
+	     column_catalog_definition_index++ )
+	{
+		if( libesedb_table_definition_get_column_catalog_definition_by_index(
+		     table_definition,
+		     column_catalog_definition_index,
+		     &column_catalog_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column catalog definition: %d.",
+			 function,
+			 column_catalog_definition_index );
+
+			return( -1 );
+		}
+		if( column_catalog_definition == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing column catalog definition: %d.",
+			 function,
+			 column_catalog_definition_index );
+
+			return( -1 );
+		}
+		if( ( column_catalog_definition_index < column_index )
+		 && ( column_catalog_definition->identifier <= 127 ) )
+		{
+			value_offset += column_catalog_definition->size;
+		}
+	}
+	switch( column_catalog_definition->column_type )
+	{
+		case LIBESEDB_COLUMN_TYPE_BOOLEAN:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
+			column_value_size = 1;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
+			column_value_size = 2;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
+		case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
+			column_value_size = 4;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_CURRENCY:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
+		case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
+		case LIBESEDB_COLUMN_TYPE_DATE_TIME:
+			column_value_size = 8;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_GUID:
+			column_value_size = 16;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported column type: %" PRIu32 ".",
+			 function,
+			 column_catalog_definition->column_type );
+
+			return( -1 );
+	}
+	if( column_catalog_definition->size != (uint32_t) column_value_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported column: %" PRIu32 " size: %" PRIu32 ".",
+		 function,
+		 column_identifier,
+		 column_catalog_definition->size );
+
+		return( -1 );
+	}
+	if( ( value_offset + column_value_size ) > (size_t) UINT16_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid column: %" PRIu32 " value offset value out of bounds.",
+		 function,
+		 column_identifier );
+
+		return( -1 );
+	}
+	if( ( column_catalog_definition->column_type == LIBESEDB_COLUMN_TYPE_GUID )
+	 && ( filter_operator != LIBESEDB_FILTER_OPERATOR_EQUAL )
+	 && ( filter_operator != LIBESEDB_FILTER_OPERATOR_NOT_EQUAL )
+	 && ( filter_operator != LIBESEDB_FILTER_OPERATOR_IN_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported filter operator: %d for GUID column.",
+		 function,
+		 filter_operator );
+
+		return( -1 );
+	}
+	if( ( ( filter_operator != LIBESEDB_FILTER_OPERATOR_IN_SET )
+	  &&  ( value_size != column_value_size ) )
+	 || ( ( value_size % column_value_size ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value size: %" PRIzd " for column: %" PRIu32 ".",
+		 function,
+		 value_size,
+		 column_identifier );
+
+		return( -1 );
+	}
+	values = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * value_size );
+
+	if( values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create values.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     values,
+	     value,
+	     value_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy values.",
+		 function );
+
+		goto on_error;
+	}
+	reallocation = memory_reallocate(
+	                record_filter->conditions,
+	                sizeof( libesedb_record_filter_condition_t ) * ( record_filter->number_of_conditions + 1 ) );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize conditions.",
+		 function );
+
+		goto on_error;
+	}
+	record_filter->conditions = (libesedb_record_filter_condition_t *) reallocation;
+
+	condition = &( record_filter->conditions[ record_filter->number_of_conditions ] );
+
+	condition->column_identifier = column_identifier;
+	condition->column_type       = column_catalog_definition->column_type;
+	condition->value_offset      = (uint16_t) value_offset;
+	condition->value_size        = (uint16_t) column_value_size;
+	condition->filter_operator   = filter_operator;
+	condition->values            = values;
+	condition->number_of_values  = value_size / column_value_size;
+
+	record_filter->number_of_conditions += 1;
+
+	return( 1 );
+
+on_error:
+	if( values != NULL )
+	{
+		memory_free(
+		 values );
+	}
+	return( -1 );
+}
+
+/* Compares a record value with a filter value of a specific column type
+ * Both values are stored in little-endian
+ * Returns -1 if the record value is less than, 0 if equal or 1 if greater than the filter value
+ */
+int libesedb_record_filter_compare_value(
+     uint32_t column_type,
+     const uint8_t *record_value,
+     const uint8_t *filter_value,
+     size_t value_size )
+{
+	union
+	{
+		float value_float;
+		uint32_t value_32bit;
+	} record_float32, filter_float32;
+
+	union
+	{
+		double value_double;
+		uint64_t value_64bit;
+	} record_float64, filter_float64;
+
+	uint64_t filter_value_64bit = 0;
+	uint64_t record_value_64bit = 0;
+	int64_t filter_value_signed = 0;
+	int64_t record_value_signed = 0;
+	int result                  = 0;
+
+	switch( column_type )
+	{
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+			byte_stream_copy_to_uint16_little_endian(
+			 record_value,
+			 record_value_64bit );
+
+			byte_stream_copy_to_uint16_little_endian(
+			 filter_value,
+			 filter_value_64bit );
+
+			record_value_signed = (int64_t) (int16_t) record_value_64bit;
+			filter_value_signed = (int64_t) (int16_t) filter_value_64bit;
+
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
+			byte_stream_copy_to_uint32_little_endian(
+			 record_value,
+			 record_value_64bit );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 filter_value,
+			 filter_value_64bit );
+
+			record_value_signed = (int64_t) (int32_t) record_value_64bit;
+			filter_value_signed = (int64_t) (int32_t) filter_value_64bit;
+
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_CURRENCY:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
+			byte_stream_copy_to_uint64_little_endian(
+			 record_value,
+			 record_value_64bit );
+
+			byte_stream_copy_to_uint64_little_endian(
+			 filter_value,
+			 filter_value_64bit );
+
+			record_value_signed = (int64_t) record_value_64bit;
+			filter_value_signed = (int64_t) filter_value_64bit;
+
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
+			byte_stream_copy_to_uint32_little_endian(
+			 record_value,
+			 record_float32.value_32bit );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 filter_value,
+			 filter_float32.value_32bit );
+
+			if( record_float32.value_float < filter_float32.value_float )
+			{
+				return( -1 );
+			}
+			else if( record_float32.value_float > filter_float32.value_float )
+			{
+				return( 1 );
+			}
+			return( 0 );
+
+		case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
+			byte_stream_copy_to_uint64_little_endian(
+			 record_value,
+			 record_float64.value_64bit );
+
+			byte_stream_copy_to_uint64_little_endian(
+			 filter_value,
+			 filter_float64.value_64bit );
+
+			if( record_float64.value_double < filter_float64.value_double )
+			{
+				return( -1 );
+			}
+			else if( record_float64.value_double > filter_float64.value_double )
+			{
+				return( 1 );
+			}
+			return( 0 );
+
+		case LIBESEDB_COLUMN_TYPE_GUID:
+			result = memory_compare(
+			          record_value,
+			          filter_value,
+			          value_size );
+
+			if( result < 0 )
+			{
+				return( -1 );
+			}
+			else if( result > 0 )
+			{
+				return( 1 );
+			}
+			return( 0 );
+
+		case LIBESEDB_COLUMN_TYPE_DATE_TIME:
+			/* The date and time value is a FILETIME, which is compared as an unsigned 64-bit integer
+			 */
+		default:
+			switch( value_size )
+			{
+				case 1:
+					record_value_64bit = record_value[ 0 ];
+					filter_value_64bit = filter_value[ 0 ];
+					break;
+
+				case 2:
+					byte_stream_copy_to_uint16_little_endian(
+					 record_value,
+					 record_value_64bit );
+
+					byte_stream_copy_to_uint16_little_endian(
+					 filter_value,
+					 filter_value_64bit );
+
+					break;
+
+				case 4:
+					byte_stream_copy_to_uint32_little_endian(
+					 record_value,
+					 record_value_64bit );
+
+					byte_stream_copy_to_uint32_little_endian(
+					 filter_value,
+					 filter_value_64bit );
+
+					break;
+
+				default:
+					byte_stream_copy_to_uint64_little_endian(
+					 record_value,
+					 record_value_64bit );
+
+					byte_stream_copy_to_uint64_little_endian(
+					 filter_value,
+					 filter_value_64bit );
+
+					break;
+			}
+			if( record_value_64bit < filter_value_64bit )
+			{
+				return( -1 );
+			}
+			else if( record_value_64bit > filter_value_64bit )
+			{
+				return( 1 );
+			}
+			return( 0 );
+	}
+	if( record_value_signed < filter_value_signed )
+	{
+		return( -1 );
+	}
+	else if( record_value_signed > filter_value_signed )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Evaluates the record filter on record data
+ * Returns 1 if the record matches the filter, 0 if not or -1 on error
+ */
+int libesedb_record_filter_evaluate(
+     libesedb_record_filter_t *record_filter,
+     const uint8_t *record_data,
+     size_t record_data_size,
+     libcerror_error_t **error )
+{
+	libesedb_record_filter_condition_t *condition = NULL;
+	static char *function                         = "libesedb_record_filter_evaluate";
+	size_t value_index                            = 0;
+	uint8_t last_fixed_size_data_type             = 0;
+	int condition_index                           = 0;
+	int result                                    = 0;
+
+	if( record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_data_size < sizeof( esedb_data_definition_header_t ) )
+	 || ( record_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	last_fixed_size_data_type = ( (esedb_data_definition_header_t *) record_data )->last_fixed_size_data_type;
+
+	for( condition_index = 0;
+	     condition_index < record_filter->number_of_conditions;
+	     condition_index++ )
+	{
+		condition = &( record_filter->conditions[ condition_index ] );
+
+		/* The fixed-size columns after the last fixed-size data type are not stored
+		 * in the record, hence their value is NULL
+		 */
+		if( condition->column_identifier > (uint32_t) last_fixed_size_data_type )
+		{
+			return( 0 );
+		}
+		if( ( (size_t) condition->value_offset + condition->value_size ) > record_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid column: %" PRIu32 " value offset value out of bounds.",
+			 function,
+			 condition->column_identifier );
+
+			return( -1 );
+		}
+		if( condition->filter_operator == LIBESEDB_FILTER_OPERATOR_IN_SET )
+		{
+			for( value_index = 0;
+			     value_index < condition->number_of_values;
+			     value_index++ )
+			{
+				result = libesedb_record_filter_compare_value(
+				          condition->column_type,
+				          &( record_data[ condition->value_offset ] ),
+				          &( condition->values[ value_index * condition->value_size ] ),
+				          (size_t) condition->value_size );
+
+				if( result == 0 )
+				{
+					break;
+				}
+			}
+			if( value_index >= condition->number_of_values )
+			{
+				return( 0 );
+			}
+			continue;
+		}
+		result = libesedb_record_filter_compare_value(
+		          condition->column_type,
+		          &( record_data[ condition->value_offset ] ),
+		          condition->values,
+		          (size_t) condition->value_size );
+
+		switch( condition->filter_operator )
+		{
+			case LIBESEDB_FILTER_OPERATOR_EQUAL:
+				result = (int) ( result == 0 );
+				break;
+
+			case LIBESEDB_FILTER_OPERATOR_NOT_EQUAL:
+				result = (int) ( result != 0 );
+				break;
+
+			case LIBESEDB_FILTER_OPERATOR_LESS:
+				result = (int) ( result < 0 );
+				break;
+
+			case LIBESEDB_FILTER_OPERATOR_LESS_OR_EQUAL:
+				result = (int) ( result <= 0 );
+				break;
+
+			case LIBESEDB_FILTER_OPERATOR_GREATER:
+				result = (int) ( result > 0 );
+				break;
+
+			case LIBESEDB_FILTER_OPERATOR_GREATER_OR_EQUAL:
+				result = (int) ( result >= 0 );
+				break;
+
+			default:
+				result = 0;
+				break;
+		}
+		if( result == 0 )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Evaluates the record filter on the record data of a data definition
+ * The record filter is evaluated on the page value data, before the record is read
+ * Returns 1 if the record matches the filter, 0 if not or -1 on error
+ */
+int libesedb_record_filter_evaluate_data_definition(
+     libesedb_record_filter_t *record_filter,
+     libesedb_data_definition_t *data_definition,
+     libbfio_handle_t *file_io_handle,
+     libesedb_io_handle_t *io_handle,
+     libfdata_vector_t *pages_vector,
+     libfcache_cache_t *pages_cache,
+     libcerror_error_t **error )
+{
+	uint8_t *record_data    = NULL;
+	static char *function   = "libesedb_record_filter_evaluate_data_definition";
+	size_t record_data_size = 0;
+	int result              = 0;
+
+	if( libesedb_data_definition_read_data(
+	     data_definition,
+	     file_io_handle,
+	     io_handle,
+	     pages_vector,
+	     pages_cache,
+	     &record_data,
+	     &record_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data definition data.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_record_filter_evaluate(
+	          record_filter,
+	          record_data,
+	          record_data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to evaluate record filter.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
@@ -0,0 +1,129 @@
+/*
+ * Record filter functions
+ *
+ * Copyright (C) 2009-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_RECORD_FILTER_H )
+#define _LIBESEDB_RECORD_FILTER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_data_definition.h"
+#include "libesedb_io_handle.h"
+#include "libesedb_libbfio.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_libfcache.h"
+#include "libesedb_libfdata.h"
+#include "libesedb_table_definition.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libesedb_record_filter_condition libesedb_record_filter_condition_t;
+typedef struct libesedb_record_filter libesedb_record_filter_t;
+
+struct libesedb_record_filter_condition
+{
+	/* The column identifier
+	 */
+	uint32_t column_identifier;
+
+	/* The column type
+	 */
+	uint32_t column_type;
+
+	/* The value offset relative to the start of the record data
+	 */
+	uint16_t value_offset;
+
+	/* The value size
+	 */
+	uint16_t value_size;
+
+	/* The filter operator
+	 */
+	int filter_operator;
+
+	/* The values to compare with
+	 */
+	uint8_t *values;
+
+	/* The number of values to compare with
+	 */
+	size_t number_of_values;
+};
+
+struct libesedb_record_filter
+{
+	/* The conditions
+	 * a record matches the filter if it matches all the conditions
+	 */
+	libesedb_record_filter_condition_t *conditions;
+
+	/* The number of conditions
+	 */
+	int number_of_conditions;
+};
+
+int libesedb_record_filter_initialize(
+     libesedb_record_filter_t **record_filter,
+     libcerror_error_t **error );
+
+int libesedb_record_filter_free(
+     libesedb_record_filter_t **record_filter,
+     libcerror_error_t **error );
+
+int libesedb_record_filter_append_condition(
+     libesedb_record_filter_t *record_filter,
+     libesedb_table_definition_t *table_definition,
+     uint32_t column_identifier,
+     int filter_operator,
+     const uint8_t *value,
+     size_t value_size,
+     libcerror_error_t **error );
+
+int libesedb_record_filter_compare_value(
+     uint32_t column_type,
+     const uint8_t *record_value,
+     const uint8_t *filter_value,
+     size_t value_size );
+
+int libesedb_record_filter_evaluate(
+     libesedb_record_filter_t *record_filter,
+     const uint8_t *record_data,
+     size_t record_data_size,
+     libcerror_error_t **error );
+
+int libesedb_record_filter_evaluate_data_definition(
+     libesedb_record_filter_t *record_filter,
+     libesedb_data_definition_t *data_definition,
+     libbfio_handle_t *file_io_handle,
+     libesedb_io_handle_t *io_handle,
+     libfdata_vector_t *pages_vector,
+     libfcache_cache_t *pages_cache,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_RECORD_FILTER_H ) */
+
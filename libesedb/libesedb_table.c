@@ -24,18 +24,24 @@
 #include <types.h>
 
 #include "libesedb_column.h"
+#include "libesedb_column_projection.h"
 #include "libesedb_data_definition.h"
 #include "libesedb_definitions.h"
 #include "libesedb_index.h"
 #include "libesedb_io_handle.h"
+#include "libesedb_key.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcdata.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
 #include "libesedb_page_tree.h"
+#include "libesedb_page_tree_cursor.h"
 #include "libesedb_record.h"
+#include "libesedb_record_batch.h"
+#include "libesedb_record_filter.h"
 #include "libesedb_table.h"
+#include "libesedb_table_cursor.h"
 #include "libesedb_table_definition.h"
 #include "libesedb_types.h"
 
@@ -49,6 +55,8 @@ int libesedb_table_initialize(
      libesedb_io_handle_t *io_handle,
      libesedb_table_definition_t *table_definition,
      libesedb_table_definition_t *template_table_definition,
+     libfdata_vector_t *pages_vector,
+     libfcache_cache_t *pages_cache,
      libcerror_error_t **error )
 {
 	libesedb_internal_table_t *internal_table   = NULL;
@@ -56,7 +64,6 @@ int libesedb_table_initialize(
 	libesedb_page_tree_t *table_page_tree       = NULL;
 	static char *function                       = "libesedb_table_initialize";
 	off64_t node_data_offset                    = 0;
-	int segment_index                           = 0;
 
 	if( table == NULL )
 	{
@@ -113,6 +120,20 @@ int libesedb_table_initialize(
 
 		return( -1 );
 	}
+	if( libesedb_table_definition_build_column_catalog_definitions_array(
+	     table_definition,
+	     template_table_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build column catalog definitions array.",
+		 function );
+
+		return( -1 );
+	}
 	internal_table = memory_allocate_structure(
 	                  libesedb_internal_table_t );
 
@@ -144,60 +165,11 @@ int libesedb_table_initialize(
 
 		return( -1 );
 	}
-	/* TODO add clone function ?
+	/* The pages vector and cache are shared by all the tables of the file
 	 */
-	if( libfdata_vector_initialize(
-	     &( internal_table->pages_vector ),
-	     (size64_t) io_handle->page_size,
-	     (intptr_t *) io_handle,
-	     NULL,
-	     NULL,
-	     (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfcache_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libesedb_io_handle_read_page,
-	     NULL,
-	     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create pages vector.",
-		 function );
-
-		goto on_error;
-	}
-	if( libfdata_vector_append_segment(
-	     internal_table->pages_vector,
-	     &segment_index,
-	     0,
-	     io_handle->pages_data_offset,
-	     io_handle->pages_data_size,
-	     0,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to append segment to pages vector.",
-		 function );
-
-		goto on_error;
-	}
-	if( libfcache_cache_initialize(
-	     &( internal_table->pages_cache ),
-	     LIBESEDB_MAXIMUM_CACHE_ENTRIES_PAGES,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create pages cache.",
-		 function );
+	internal_table->pages_vector = pages_vector;
+	internal_table->pages_cache  = pages_cache;
 
-		goto on_error;
-	}
 	if( libesedb_page_tree_initialize(
 	     &table_page_tree,
 	     io_handle,
@@ -242,9 +214,12 @@ int libesedb_table_initialize(
 
 		goto on_error;
 	}
-	if( libfcache_cache_initialize(
+	internal_table->table_page_tree = table_page_tree;
+
+	if( libesedb_io_handle_create_cache(
+	     io_handle,
+	     LIBESEDB_CACHE_TYPE_TABLE_VALUES,
 	     &( internal_table->table_values_cache ),
-	     LIBESEDB_MAXIMUM_CACHE_ENTRIES_TABLE_VALUES,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -278,60 +253,9 @@ int libesedb_table_initialize(
 	}
 	if( table_definition->long_value_catalog_definition != NULL )
 	{
-		/* TODO add clone function ?
-		 */
-		if( libfdata_vector_initialize(
-		     &( internal_table->long_values_pages_vector ),
-		     (size64_t) io_handle->page_size,
-		     (intptr_t *) io_handle,
-		     NULL,
-		     NULL,
-		     (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfcache_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libesedb_io_handle_read_page,
-		     NULL,
-		     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create long values pages vector.",
-			 function );
-
-			goto on_error;
-		}
-		if( libfdata_vector_append_segment(
-		     internal_table->long_values_pages_vector,
-		     &segment_index,
-		     0,
-		     io_handle->pages_data_offset,
-		     io_handle->pages_data_size,
-		     0,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append segment to long values pages vector.",
-			 function );
-
-			goto on_error;
-		}
-		if( libfcache_cache_initialize(
-		     &( internal_table->long_values_pages_cache ),
-		     LIBESEDB_MAXIMUM_CACHE_ENTRIES_PAGES,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create long values pages cache.",
-			 function );
+		internal_table->long_values_pages_vector = pages_vector;
+		internal_table->long_values_pages_cache  = pages_cache;
 
-			goto on_error;
-		}
 		if( libesedb_page_tree_initialize(
 		     &long_values_page_tree,
 		     io_handle,
@@ -376,9 +300,10 @@ int libesedb_table_initialize(
 
 			goto on_error;
 		}
-		if( libfcache_cache_initialize(
+		if( libesedb_io_handle_create_cache(
+		     io_handle,
+		     LIBESEDB_CACHE_TYPE_LONG_VALUES,
 		     &( internal_table->long_values_cache ),
-		     LIBESEDB_MAXIMUM_CACHE_ENTRIES_LONG_VALUES,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -425,7 +350,9 @@ on_error:
 	{
 		if( internal_table->long_values_cache != NULL )
 		{
-			libfcache_cache_free(
+			libesedb_io_handle_free_cache(
+			 io_handle,
+			 LIBESEDB_CACHE_TYPE_LONG_VALUES,
 			 &( internal_table->long_values_cache ),
 			 NULL );
 		}
@@ -435,21 +362,11 @@ on_error:
 			 &( internal_table->long_values_tree ),
 			 NULL );
 		}
-		if( internal_table->long_values_pages_cache != NULL )
-		{
-			libfcache_cache_free(
-			 &( internal_table->long_values_pages_cache ),
-			 NULL );
-		}
-		if( internal_table->long_values_pages_vector != NULL )
-		{
-			libfdata_vector_free(
-			 &( internal_table->long_values_pages_vector ),
-			 NULL );
-		}
 		if( internal_table->table_values_cache != NULL )
 		{
-			libfcache_cache_free(
+			libesedb_io_handle_free_cache(
+			 io_handle,
+			 LIBESEDB_CACHE_TYPE_TABLE_VALUES,
 			 &( internal_table->table_values_cache ),
 			 NULL );
 		}
@@ -459,18 +376,6 @@ on_error:
 			 &( internal_table->table_values_tree ),
 			 NULL );
 		}
-		if( internal_table->pages_cache != NULL )
-		{
-			libfcache_cache_free(
-			 &( internal_table->pages_cache ),
-			 NULL );
-		}
-		if( internal_table->pages_vector != NULL )
-		{
-			libfdata_vector_free(
-			 &( internal_table->pages_vector ),
-			 NULL );
-		}
 		memory_free(
 		 internal_table );
 	}
@@ -504,120 +409,99 @@ int libesedb_table_free(
 		internal_table = (libesedb_internal_table_t *) *table;
 		*table         = NULL;
 
-		/* The io_handle, file_io_handle and table_definition references
-		 * are freed elsewhere
+		/* The io_handle, file_io_handle, table_definition, template_table_definition,
+		 * pages_vector, pages_cache, long_values_pages_vector and long_values_pages_cache
+		 * references are freed elsewhere
 		 */
-		if( libfdata_vector_free(
-		     &( internal_table->pages_vector ),
+		if( libfdata_btree_free(
+		     &( internal_table->table_values_tree ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free pages vector.",
+			 "%s: unable to free table values tree.",
 			 function );
 
 			result = -1;
 		}
-		if( libfcache_cache_free(
-		     &( internal_table->pages_cache ),
+		if( libesedb_io_handle_free_cache(
+		     internal_table->io_handle,
+		     LIBESEDB_CACHE_TYPE_TABLE_VALUES,
+		     &( internal_table->table_values_cache ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free pages cache.",
+			 "%s: unable to free table values cache.",
 			 function );
 
 			result = -1;
 		}
-		if( internal_table->long_values_pages_vector != NULL )
+		if( internal_table->long_values_tree != NULL )
 		{
-			if( libfdata_vector_free(
-			     &( internal_table->long_values_pages_vector ),
+			if( libfdata_btree_free(
+			     &( internal_table->long_values_tree ),
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free long values pages vector.",
+				 "%s: unable to free long values tree.",
 				 function );
 
 				result = -1;
 			}
 		}
-		if( internal_table->long_values_pages_cache != NULL )
+		if( internal_table->long_values_cache != NULL )
 		{
-			if( libfcache_cache_free(
-			     &( internal_table->long_values_pages_cache ),
+			if( libesedb_io_handle_free_cache(
+			     internal_table->io_handle,
+			     LIBESEDB_CACHE_TYPE_LONG_VALUES,
+			     &( internal_table->long_values_cache ),
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free long values pages cache.",
+				 "%s: unable to free long values cache.",
 				 function );
 
 				result = -1;
 			}
 		}
-		if( libfdata_btree_free(
-		     &( internal_table->table_values_tree ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free table values tree.",
-			 function );
-
-			result = -1;
-		}
-		if( libfcache_cache_free(
-		     &( internal_table->table_values_cache ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free table values cache.",
-			 function );
-
-			result = -1;
-		}
-		if( internal_table->long_values_tree != NULL )
+		if( internal_table->column_projection != NULL )
 		{
-			if( libfdata_btree_free(
-			     &( internal_table->long_values_tree ),
+			if( libesedb_column_projection_free(
+			     &( internal_table->column_projection ),
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free long values tree.",
+				 "%s: unable to free column projection.",
 				 function );
 
 				result = -1;
 			}
 		}
-		if( internal_table->long_values_cache != NULL )
+		if( internal_table->record_filter != NULL )
 		{
-			if( libfcache_cache_free(
-			     &( internal_table->long_values_cache ),
+			if( libesedb_record_filter_free(
+			     &( internal_table->record_filter ),
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free long values cache.",
+				 "%s: unable to free record filter.",
 				 function );
 
 				result = -1;
@@ -1224,7 +1108,6 @@ int libesedb_table_get_number_of_columns(
 {
 	libesedb_internal_table_t *internal_table = NULL;
 	static char *function                     = "libesedb_table_get_number_of_columns";
-	int template_table_number_of_columns      = 0;
 
 	if( table == NULL )
 	{
@@ -1283,40 +1166,12 @@ int libesedb_table_get_number_of_columns(
 
 		return( -1 );
 	}
-	if( ( ( flags & LIBESEDB_GET_COLUMN_FLAG_IGNORE_TEMPLATE_TABLE ) == 0 )
-	 && ( internal_table->template_table_definition != NULL ) )
-	{
-		if( libcdata_list_get_number_of_elements(
-		     internal_table->template_table_definition->column_catalog_definition_list,
-		     &template_table_number_of_columns,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of columns from template table.",
-			 function );
+	*number_of_columns = internal_table->table_definition->number_of_column_catalog_definitions;
 
-			return( -1 );
-		}
-	}
-	if( libcdata_list_get_number_of_elements(
-	     internal_table->table_definition->column_catalog_definition_list,
-	     number_of_columns,
-	     error ) != 1 )
+	if( ( flags & LIBESEDB_GET_COLUMN_FLAG_IGNORE_TEMPLATE_TABLE ) != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of columns from table.",
-		 function );
-
-		return( -1 );
+		*number_of_columns -= internal_table->table_definition->number_of_template_table_column_catalog_definitions;
 	}
-	*number_of_columns += template_table_number_of_columns;
-
 	return( 1 );
 }
 
@@ -1337,7 +1192,7 @@ int libesedb_table_get_column(
 	libesedb_catalog_definition_t *column_catalog_definition = NULL;
 	libesedb_internal_table_t *internal_table                = NULL;
 	static char *function                                    = "libesedb_table_get_column";
-	int template_table_number_of_columns                     = 0;
+	int column_index                                         = 0;
 
 	if( table == NULL )
 	{
@@ -1407,61 +1262,30 @@ int libesedb_table_get_column(
 
 		return( -1 );
 	}
-	if( ( flags & LIBESEDB_GET_COLUMN_FLAG_IGNORE_TEMPLATE_TABLE ) == 0 )
-	{
-		if( internal_table->template_table_definition != NULL )
-		{
-			if( libcdata_list_get_number_of_elements(
-			     internal_table->template_table_definition->column_catalog_definition_list,
-			     &template_table_number_of_columns,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve number of columns from template table.",
-				 function );
+	/* The column catalog definitions array contains the columns of the template table
+	 * followed by the columns of the table
+	 */
+	column_index = column_entry;
 
-				return( -1 );
-			}
-		}
-	}
-	if( column_entry < template_table_number_of_columns )
+	if( ( flags & LIBESEDB_GET_COLUMN_FLAG_IGNORE_TEMPLATE_TABLE ) != 0 )
 	{
-		if( libcdata_list_get_value_by_index(
-		     internal_table->template_table_definition->column_catalog_definition_list,
-		     column_entry,
-		     (intptr_t **) &column_catalog_definition,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve column catalog definition from template table.",
-			 function );
-
-			return( -1 );
-		}
+		column_index += internal_table->table_definition->number_of_template_table_column_catalog_definitions;
 	}
-	else
+	if( libesedb_table_definition_get_column_catalog_definition_by_index(
+	     internal_table->table_definition,
+	     column_index,
+	     &column_catalog_definition,
+	     error ) != 1 )
 	{
-		if( libcdata_list_get_value_by_index(
-		     internal_table->table_definition->column_catalog_definition_list,
-		     column_entry - template_table_number_of_columns,
-		     (intptr_t **) &column_catalog_definition,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve column catalog definition from table.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column catalog definition: %d.",
+		 function,
+		 column_entry );
 
-			return( -1 );
-		}
+		return( -1 );
 	}
 	if( column_catalog_definition == NULL )
 	{
@@ -1775,6 +1599,7 @@ int libesedb_table_get_record(
 	     internal_table->io_handle,
 	     internal_table->table_definition,
 	     internal_table->template_table_definition,
+	     internal_table->column_projection,
 	     internal_table->pages_vector,
 	     internal_table->pages_cache,
 	     internal_table->long_values_pages_vector,
@@ -1796,3 +1621,1005 @@ int libesedb_table_get_record(
 	return( 1 );
 }
 
+/* Retrieves the record with a specific primary key
+ * The key consists of the normalized key data as stored in the table
+ * The table page tree is descended using a binary search over the page values of every page
+ * Returns 1 if successful, 0 if no such record or -1 on error
+ */
+int libesedb_table_get_record_by_key(
+     libesedb_table_t *table,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     libesedb_record_t **record,
+     libcerror_error_t **error )
+{
+	libesedb_data_definition_t *record_data_definition = NULL;
+	libesedb_internal_table_t *internal_table          = NULL;
+	libesedb_key_t *key                                = NULL;
+	libesedb_key_t *record_key                         = NULL;
+	libesedb_page_tree_cursor_t *page_tree_cursor      = NULL;
+	static char *function                              = "libesedb_table_get_record_by_key";
+	int result                                         = 0;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( internal_table->table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table - missing table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_table->table_definition->table_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table - invalid table definition - missing table catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_key_initialize(
+	     &key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create key.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_key_set_data(
+	     key,
+	     key_data,
+	     key_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set key data.",
+		 function );
+
+		goto on_error;
+	}
+	key->type = LIBESEDB_KEY_TYPE_INDEX_VALUE;
+
+	if( libesedb_page_tree_cursor_initialize(
+	     &page_tree_cursor,
+	     internal_table->table_page_tree,
+	     internal_table->table_definition->table_catalog_definition->father_data_page_number,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create page tree cursor.",
+		 function );
+
+		goto on_error;
+	}
+	result = libesedb_page_tree_cursor_seek(
+	          page_tree_cursor,
+	          internal_table->file_io_handle,
+	          key,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to seek key in table page tree.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( libesedb_key_initialize(
+		     &record_key,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create record key.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_data_definition_initialize(
+		     &record_data_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create record data definition.",
+			 function );
+
+			goto on_error;
+		}
+		result = libesedb_page_tree_cursor_get_next_value(
+		          page_tree_cursor,
+		          internal_table->file_io_handle,
+		          record_key,
+		          record_data_definition,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve leaf value from page tree cursor.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( result != 0 )
+	{
+		result = libesedb_key_compare_data(
+		          record_key,
+		          key,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare record key.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == LIBFDATA_COMPARE_EQUAL )
+		{
+			if( libesedb_record_initialize(
+			     record,
+			     internal_table->file_io_handle,
+			     internal_table->io_handle,
+			     internal_table->table_definition,
+			     internal_table->template_table_definition,
+			     internal_table->column_projection,
+			     internal_table->pages_vector,
+			     internal_table->pages_cache,
+			     internal_table->long_values_pages_vector,
+			     internal_table->long_values_pages_cache,
+			     record_data_definition,
+			     internal_table->long_values_tree,
+			     internal_table->long_values_cache,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create record.",
+				 function );
+
+				goto on_error;
+			}
+			result = 1;
+		}
+		else
+		{
+			result = 0;
+		}
+	}
+	if( record_data_definition != NULL )
+	{
+		if( libesedb_data_definition_free(
+		     &record_data_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record data definition.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( record_key != NULL )
+	{
+		if( libesedb_key_free(
+		     &record_key,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record key.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libesedb_page_tree_cursor_free(
+	     &page_tree_cursor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free page tree cursor.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_key_free(
+	     &key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free key.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( *record != NULL )
+	{
+		libesedb_record_free(
+		 record,
+		 NULL );
+	}
+	if( record_data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &record_data_definition,
+		 NULL );
+	}
+	if( record_key != NULL )
+	{
+		libesedb_key_free(
+		 &record_key,
+		 NULL );
+	}
+	if( page_tree_cursor != NULL )
+	{
+		libesedb_page_tree_cursor_free(
+		 &page_tree_cursor,
+		 NULL );
+	}
+	if( key != NULL )
+	{
+		libesedb_key_free(
+		 &key,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the record for the specific entry into an existing record
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_get_record_into(
+     libesedb_table_t *table,
+     int record_entry,
+     libesedb_record_t *record,
+     libcerror_error_t **error )
+{
+	libesedb_data_definition_t *record_data_definition = NULL;
+	libesedb_internal_record_t *internal_record        = NULL;
+	libesedb_internal_table_t *internal_table          = NULL;
+	static char *function                              = "libesedb_table_get_record_into";
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libesedb_internal_record_t *) record;
+
+	if( ( internal_record->table_definition != internal_table->table_definition )
+	 || ( internal_record->io_handle != internal_table->io_handle ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported record - record does not belong to table.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_btree_get_leaf_value_by_index(
+	     internal_table->table_values_tree,
+	     (intptr_t *) internal_table->file_io_handle,
+	     internal_table->table_values_cache,
+	     record_entry,
+	     (intptr_t **) &record_data_definition,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve leaf value: %d from table values tree.",
+		 function,
+		 record_entry );
+
+		return( -1 );
+	}
+	if( libesedb_record_set_column_projection(
+	     internal_record,
+	     internal_table->column_projection,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set column projection in record.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_record_read_data_definition(
+	     internal_record,
+	     record_data_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record: %d.",
+		 function,
+		 record_entry );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the values of a range of records into a record batch
+ * The values are stored per column, refer to libesedb_record_batch_get_column_buffers
+ * If column identifiers is NULL the column projection of the table is used
+ * The number of records is limited to the number of records remaining in the table
+ * Records that do not match the record filter are skipped
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_read_batch(
+     libesedb_table_t *table,
+     int first_record_entry,
+     int number_of_records,
+     const uint32_t *column_identifiers,
+     int number_of_column_identifiers,
+     libesedb_record_batch_t **record_batch,
+     libcerror_error_t **error )
+{
+	libesedb_column_projection_t *batch_column_projection = NULL;
+	libesedb_column_projection_t *column_projection       = NULL;
+	libesedb_data_definition_t *record_data_definition    = NULL;
+	libesedb_internal_table_t *internal_table             = NULL;
+	libesedb_record_batch_t *safe_record_batch            = NULL;
+	libesedb_record_t *record                             = NULL;
+	static char *function                                 = "libesedb_table_read_batch";
+	int number_of_table_records                           = 0;
+	int record_entry                                      = 0;
+	int result                                            = 0;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( number_of_records < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of records value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_batch != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record batch value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_table_get_number_of_records(
+	     table,
+	     &number_of_table_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( first_record_entry < 0 )
+	 || ( first_record_entry > number_of_table_records ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first record entry value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_records > ( number_of_table_records - first_record_entry ) )
+	{
+		number_of_records = number_of_table_records - first_record_entry;
+	}
+	if( column_identifiers != NULL )
+	{
+		if( libesedb_column_projection_initialize(
+		     &batch_column_projection,
+		     internal_table->table_definition,
+		     column_identifiers,
+		     number_of_column_identifiers,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create column projection.",
+			 function );
+
+			goto on_error;
+		}
+		column_projection = batch_column_projection;
+	}
+	else
+	{
+		column_projection = internal_table->column_projection;
+	}
+	if( libesedb_record_batch_initialize(
+	     &safe_record_batch,
+	     internal_table->table_definition,
+	     column_projection,
+	     number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record batch.",
+		 function );
+
+		goto on_error;
+	}
+	/* A single record is reused to read the values of all the records
+	 */
+	for( record_entry = first_record_entry;
+	     record_entry < ( first_record_entry + number_of_records );
+	     record_entry++ )
+	{
+		if( libfdata_btree_get_leaf_value_by_index(
+		     internal_table->table_values_tree,
+		     (intptr_t *) internal_table->file_io_handle,
+		     internal_table->table_values_cache,
+		     record_entry,
+		     (intptr_t **) &record_data_definition,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve leaf value: %d from table values tree.",
+			 function,
+			 record_entry );
+
+			goto on_error;
+		}
+		if( internal_table->record_filter != NULL )
+		{
+			result = libesedb_record_filter_evaluate_data_definition(
+			          internal_table->record_filter,
+			          record_data_definition,
+			          internal_table->file_io_handle,
+			          internal_table->io_handle,
+			          internal_table->pages_vector,
+			          internal_table->pages_cache,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to evaluate record filter on record: %d.",
+				 function,
+				 record_entry );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				continue;
+			}
+		}
+		if( record == NULL )
+		{
+			if( libesedb_record_initialize(
+			     &record,
+			     internal_table->file_io_handle,
+			     internal_table->io_handle,
+			     internal_table->table_definition,
+			     internal_table->template_table_definition,
+			     column_projection,
+			     internal_table->pages_vector,
+			     internal_table->pages_cache,
+			     internal_table->long_values_pages_vector,
+			     internal_table->long_values_pages_cache,
+			     record_data_definition,
+			     internal_table->long_values_tree,
+			     internal_table->long_values_cache,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create record.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else if( libesedb_record_read_data_definition(
+		          (libesedb_internal_record_t *) record,
+		          record_data_definition,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read record: %d.",
+			 function,
+			 record_entry );
+
+			goto on_error;
+		}
+		if( libesedb_record_batch_append_record(
+		     (libesedb_internal_record_batch_t *) safe_record_batch,
+		     (libesedb_internal_record_t *) record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append record: %d to record batch.",
+			 function,
+			 record_entry );
+
+			goto on_error;
+		}
+	}
+	if( record != NULL )
+	{
+		if( libesedb_record_free(
+		     &record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( batch_column_projection != NULL )
+	{
+		if( libesedb_column_projection_free(
+		     &batch_column_projection,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free column projection.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	*record_batch = safe_record_batch;
+
+	return( 1 );
+
+on_error:
+	if( record != NULL )
+	{
+		libesedb_record_free(
+		 &record,
+		 NULL );
+	}
+	if( safe_record_batch != NULL )
+	{
+		libesedb_record_batch_free(
+		 &safe_record_batch,
+		 NULL );
+	}
+	if( batch_column_projection != NULL )
+	{
+		libesedb_column_projection_free(
+		 &batch_column_projection,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Sets the column projection
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_set_column_projection(
+     libesedb_table_t *table,
+     const uint32_t *column_identifiers,
+     int number_of_column_identifiers,
+     libcerror_error_t **error )
+{
+	libesedb_column_projection_t *column_projection = NULL;
+	libesedb_internal_table_t *internal_table       = NULL;
+	static char *function                           = "libesedb_table_set_column_projection";
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( column_identifiers != NULL )
+	{
+		if( libesedb_column_projection_initialize(
+		     &column_projection,
+		     internal_table->table_definition,
+		     column_identifiers,
+		     number_of_column_identifiers,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create column projection.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( internal_table->column_projection != NULL )
+	{
+		if( libesedb_column_projection_free(
+		     &( internal_table->column_projection ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free column projection.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_table->column_projection = column_projection;
+
+	return( 1 );
+
+on_error:
+	if( column_projection != NULL )
+	{
+		libesedb_column_projection_free(
+		 &column_projection,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Appends a filter condition
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_append_filter_condition(
+     libesedb_table_t *table,
+     uint32_t column_identifier,
+     int filter_operator,
+     const uint8_t *value,
+     size_t value_size,
+     libcerror_error_t **error )
+{
+	libesedb_internal_table_t *internal_table = NULL;
+	libesedb_record_filter_t *record_filter   = NULL;
+	static char *function                     = "libesedb_table_append_filter_condition";
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	/* The columns of the template table precede the columns of the table in the record
+	 */
+	if( internal_table->template_table_definition != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported table with template table.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_table->record_filter == NULL )
+	{
+		if( libesedb_record_filter_initialize(
+		     &record_filter,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create record filter.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		record_filter = internal_table->record_filter;
+	}
+	if( libesedb_record_filter_append_condition(
+	     record_filter,
+	     internal_table->table_definition,
+	     column_identifier,
+	     filter_operator,
+	     value,
+	     value_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append condition to record filter.",
+		 function );
+
+		goto on_error;
+	}
+	internal_table->record_filter = record_filter;
+
+	return( 1 );
+
+on_error:
+	if( ( record_filter != NULL )
+	 && ( record_filter != internal_table->record_filter ) )
+	{
+		libesedb_record_filter_free(
+		 &record_filter,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Clears the filter conditions
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_clear_filter_conditions(
+     libesedb_table_t *table,
+     libcerror_error_t **error )
+{
+	libesedb_internal_table_t *internal_table = NULL;
+	static char *function                     = "libesedb_table_clear_filter_conditions";
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( internal_table->record_filter != NULL )
+	{
+		if( libesedb_record_filter_free(
+		     &( internal_table->record_filter ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record filter.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves a cursor to sequentially read the records of the table
+ * The cursor reads the records in the order of the leaf pages of the table
+ * and must be freed before the table
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_get_cursor(
+     libesedb_table_t *table,
+     libesedb_table_cursor_t **table_cursor,
+     libcerror_error_t **error )
+{
+	libesedb_internal_table_t *internal_table = NULL;
+	static char *function                     = "libesedb_table_get_cursor";
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( libesedb_table_cursor_initialize(
+	     table_cursor,
+	     internal_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create table cursor.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
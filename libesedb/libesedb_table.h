@@ -25,12 +25,15 @@
 #include <common.h>
 #include <types.h>
 
+#include "libesedb_column_projection.h"
 #include "libesedb_extern.h"
 #include "libesedb_io_handle.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
+#include "libesedb_page_tree.h"
+#include "libesedb_record_filter.h"
 #include "libesedb_table_definition.h"
 #include "libesedb_types.h"
 
@@ -58,6 +61,14 @@ struct libesedb_internal_table
 	 */
 	libesedb_table_definition_t *template_table_definition;
 
+	/* The column projection
+	 */
+	libesedb_column_projection_t *column_projection;
+
+	/* The record filter
+	 */
+	libesedb_record_filter_t *record_filter;
+
 	/* The pages vector
 	 */
 	libfdata_vector_t *pages_vector;
@@ -74,6 +85,10 @@ struct libesedb_internal_table
 	 */
 	libfcache_cache_t *long_values_pages_cache;
 
+	/* The table page tree, managed by the table values tree
+	 */
+	libesedb_page_tree_t *table_page_tree;
+
 	/* The table values tree
 	 */
 	libfdata_btree_t *table_values_tree;
@@ -97,6 +112,8 @@ int libesedb_table_initialize(
      libesedb_io_handle_t *io_handle,
      libesedb_table_definition_t *table_definition,
      libesedb_table_definition_t *template_table_definition,
+     libfdata_vector_t *pages_vector,
+     libfcache_cache_t *pages_cache,
      libcerror_error_t **error );
 
 LIBESEDB_EXTERN \
@@ -203,6 +220,58 @@ int libesedb_table_get_record(
      libesedb_record_t **record,
      libcerror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_table_get_record_by_key(
+     libesedb_table_t *table,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     libesedb_record_t **record,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_table_get_record_into(
+     libesedb_table_t *table,
+     int record_entry,
+     libesedb_record_t *record,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_table_read_batch(
+     libesedb_table_t *table,
+     int first_record_entry,
+     int number_of_records,
+     const uint32_t *column_identifiers,
+     int number_of_column_identifiers,
+     libesedb_record_batch_t **record_batch,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_table_set_column_projection(
+     libesedb_table_t *table,
+     const uint32_t *column_identifiers,
+     int number_of_column_identifiers,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_table_append_filter_condition(
+     libesedb_table_t *table,
+     uint32_t column_identifier,
+     int filter_operator,
+     const uint8_t *value,
+     size_t value_size,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_table_clear_filter_conditions(
+     libesedb_table_t *table,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_table_get_cursor(
+     libesedb_table_t *table,
+     libesedb_table_cursor_t **table_cursor,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
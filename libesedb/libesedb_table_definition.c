@@ -266,6 +266,18 @@ int libesedb_table_definition_free(
 
 			result = -1;
 		}
+		/* The column catalog definitions in the array are references
+		 */
+		if( ( *table_definition )->column_catalog_definitions_array != NULL )
+		{
+			memory_free(
+			 ( *table_definition )->column_catalog_definitions_array );
+		}
+		if( ( *table_definition )->column_indexes_per_identifier != NULL )
+		{
+			memory_free(
+			 ( *table_definition )->column_indexes_per_identifier );
+		}
 		memory_free(
 		 *table_definition );
 
@@ -452,6 +464,26 @@ int libesedb_table_definition_append_column_catalog_definition(
 
 		return( -1 );
 	}
+	/* Make sure the column catalog definitions array is rebuilt
+	 */
+	if( table_definition->column_catalog_definitions_array != NULL )
+	{
+		memory_free(
+		 table_definition->column_catalog_definitions_array );
+
+		table_definition->column_catalog_definitions_array = NULL;
+	}
+	if( table_definition->column_indexes_per_identifier != NULL )
+	{
+		memory_free(
+		 table_definition->column_indexes_per_identifier );
+
+		table_definition->column_indexes_per_identifier = NULL;
+	}
+	table_definition->number_of_column_catalog_definitions                = 0;
+	table_definition->number_of_template_table_column_catalog_definitions = 0;
+	table_definition->number_of_column_indexes_per_identifier             = 0;
+
 	return( 1 );
 }
 
@@ -516,3 +548,424 @@ int libesedb_table_definition_append_index_catalog_definition(
 	return( 1 );
 }
 
+/* Builds the column catalog definitions array
+ * The array contains the column catalog definitions of the template table, if any,
+ * followed by those of the table, in the order of the record values, and is
+ * accompanied by a lookup table of the column index per column identifier
+ * The array is only built once, the template table definition should be the same
+ * on every call
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_definition_build_column_catalog_definitions_array(
+     libesedb_table_definition_t *table_definition,
+     libesedb_table_definition_t *template_table_definition,
+     libcerror_error_t **error )
+{
+	libcdata_list_element_t *column_catalog_definition_list_element  = NULL;
+	libcdata_list_t *column_catalog_definition_list                  = NULL;
+	libesedb_catalog_definition_t **column_catalog_definitions_array = NULL;
+	libesedb_catalog_definition_t *column_catalog_definition         = NULL;
+	int *column_indexes_per_identifier                               = NULL;
+	static char *function                                            = "libesedb_table_definition_build_column_catalog_definitions_array";
+	uint32_t maximum_column_identifier                               = 0;
+	int column_index                                                 = 0;
+	int list_index                                                   = 0;
+	int number_of_column_catalog_definitions                         = 0;
+	int number_of_column_indexes_per_identifier                      = 0;
+	int number_of_table_column_catalog_definitions                   = 0;
+	int number_of_template_table_column_catalog_definitions          = 0;
+
+	if( table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition->column_catalog_definition_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table definition - missing column catalog definition list.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( template_table_definition != NULL )
+	 && ( template_table_definition->column_catalog_definition_list == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid template table definition - missing column catalog definition list.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition->column_catalog_definitions_array != NULL )
+	{
+		return( 1 );
+	}
+	if( template_table_definition != NULL )
+	{
+		if( libcdata_list_get_number_of_elements(
+		     template_table_definition->column_catalog_definition_list,
+		     &number_of_template_table_column_catalog_definitions,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of template table column catalog definitions.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libcdata_list_get_number_of_elements(
+	     table_definition->column_catalog_definition_list,
+	     &number_of_table_column_catalog_definitions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of table column catalog definitions.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_table_column_catalog_definitions > ( INT_MAX - number_of_template_table_column_catalog_definitions ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of column catalog definitions value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	number_of_column_catalog_definitions = number_of_template_table_column_catalog_definitions
+	                                     + number_of_table_column_catalog_definitions;
+
+	if( number_of_column_catalog_definitions == 0 )
+	{
+		return( 1 );
+	}
+	if( (size_t) number_of_column_catalog_definitions > (size_t) ( SSIZE_MAX / sizeof( libesedb_catalog_definition_t * ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of column catalog definitions value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	column_catalog_definitions_array = (libesedb_catalog_definition_t **) memory_allocate(
+	                                                                       sizeof( libesedb_catalog_definition_t * ) * number_of_column_catalog_definitions );
+
+	if( column_catalog_definitions_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create column catalog definitions array.",
+		 function );
+
+		goto on_error;
+	}
+	for( list_index = 0;
+	     list_index < 2;
+	     list_index++ )
+	{
+		if( list_index == 0 )
+		{
+			if( template_table_definition == NULL )
+			{
+				continue;
+			}
+			column_catalog_definition_list = template_table_definition->column_catalog_definition_list;
+		}
+		else
+		{
+			column_catalog_definition_list = table_definition->column_catalog_definition_list;
+		}
+		if( libcdata_list_get_first_element(
+		     column_catalog_definition_list,
+		     &column_catalog_definition_list_element,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve first column catalog definition list element.",
+			 function );
+
+			goto on_error;
+		}
+		while( column_catalog_definition_list_element != NULL )
+		{
+			if( column_index >= number_of_column_catalog_definitions )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid column index value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+			if( libcdata_list_element_get_value(
+			     column_catalog_definition_list_element,
+			     (intptr_t **) &column_catalog_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve column catalog definition: %d.",
+				 function,
+				 column_index );
+
+				goto on_error;
+			}
+			if( column_catalog_definition == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing column catalog definition: %d.",
+				 function,
+				 column_index );
+
+				goto on_error;
+			}
+			if( column_catalog_definition->identifier > maximum_column_identifier )
+			{
+				maximum_column_identifier = column_catalog_definition->identifier;
+			}
+			column_catalog_definitions_array[ column_index++ ] = column_catalog_definition;
+
+			if( libcdata_list_element_get_next_element(
+			     column_catalog_definition_list_element,
+			     &column_catalog_definition_list_element,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve next column catalog definition list element.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	if( column_index != number_of_column_catalog_definitions )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of column catalog definitions value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	/* The column identifiers are stored as 16-bit values in the record data
+	 */
+	if( maximum_column_identifier > (uint32_t) UINT16_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported column identifier: %" PRIu32 ".",
+		 function,
+		 maximum_column_identifier );
+
+		goto on_error;
+	}
+	number_of_column_indexes_per_identifier = (int) maximum_column_identifier + 1;
+
+	column_indexes_per_identifier = (int *) memory_allocate(
+	                                         sizeof( int ) * number_of_column_indexes_per_identifier );
+
+	if( column_indexes_per_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create column indexes per identifier.",
+		 function );
+
+		goto on_error;
+	}
+	for( column_index = 0;
+	     column_index < number_of_column_indexes_per_identifier;
+	     column_index++ )
+	{
+		column_indexes_per_identifier[ column_index ] = -1;
+	}
+	/* If a column identifier is used more than once the first column is used
+	 */
+	for( column_index = 0;
+	     column_index < number_of_column_catalog_definitions;
+	     column_index++ )
+	{
+		column_catalog_definition = column_catalog_definitions_array[ column_index ];
+
+		if( column_indexes_per_identifier[ column_catalog_definition->identifier ] == -1 )
+		{
+			column_indexes_per_identifier[ column_catalog_definition->identifier ] = column_index;
+		}
+	}
+	table_definition->column_catalog_definitions_array                    = column_catalog_definitions_array;
+	table_definition->number_of_column_catalog_definitions                = number_of_column_catalog_definitions;
+	table_definition->number_of_template_table_column_catalog_definitions = number_of_template_table_column_catalog_definitions;
+	table_definition->column_indexes_per_identifier                       = column_indexes_per_identifier;
+	table_definition->number_of_column_indexes_per_identifier             = number_of_column_indexes_per_identifier;
+
+	return( 1 );
+
+on_error:
+	if( column_indexes_per_identifier != NULL )
+	{
+		memory_free(
+		 column_indexes_per_identifier );
+	}
+	if( column_catalog_definitions_array != NULL )
+	{
+		memory_free(
+		 column_catalog_definitions_array );
+	}
+	return( -1 );
+}
+
+/* Retrieves a specific column catalog definition from the column catalog definitions array
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_definition_get_column_catalog_definition_by_index(
+     libesedb_table_definition_t *table_definition,
+     int column_index,
+     libesedb_catalog_definition_t **column_catalog_definition,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_table_definition_get_column_catalog_definition_by_index";
+
+	if( table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition->column_catalog_definitions_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table definition - missing column catalog definitions array.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( column_index < 0 )
+	 || ( column_index >= table_definition->number_of_column_catalog_definitions ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid column index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	*column_catalog_definition = table_definition->column_catalog_definitions_array[ column_index ];
+
+	return( 1 );
+}
+
+/* Retrieves the index of the column with a specific identifier in the column catalog definitions array
+ * Returns 1 if successful, 0 if no such column or -1 on error
+ */
+int libesedb_table_definition_get_column_index_by_identifier(
+     libesedb_table_definition_t *table_definition,
+     uint32_t column_identifier,
+     int *column_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_table_definition_get_column_index_by_identifier";
+
+	if( table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( table_definition->column_indexes_per_identifier == NULL )
+	 || ( column_identifier >= (uint32_t) table_definition->number_of_column_indexes_per_identifier ) )
+	{
+		return( 0 );
+	}
+	if( table_definition->column_indexes_per_identifier[ column_identifier ] == -1 )
+	{
+		return( 0 );
+	}
+	*column_index = table_definition->column_indexes_per_identifier[ column_identifier ];
+
+	return( 1 );
+}
+
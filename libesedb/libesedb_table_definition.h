@@ -56,6 +56,28 @@ struct libesedb_table_definition
 	/* The index catalog definition list
 	 */
 	libcdata_list_t *index_catalog_definition_list;
+
+	/* The column catalog definitions array
+	 * contains references to the column catalog definitions of the template table
+	 * followed by those of the table
+	 */
+	libesedb_catalog_definition_t **column_catalog_definitions_array;
+
+	/* The number of column catalog definitions in the array
+	 */
+	int number_of_column_catalog_definitions;
+
+	/* The number of template table column catalog definitions in the array
+	 */
+	int number_of_template_table_column_catalog_definitions;
+
+	/* The column index per column identifier, -1 if not used
+	 */
+	int *column_indexes_per_identifier;
+
+	/* The number of column indexes per column identifier
+	 */
+	int number_of_column_indexes_per_identifier;
 };
 
 int libesedb_table_definition_initialize(
@@ -87,6 +109,23 @@ int libesedb_table_definition_append_index_catalog_definition(
      libesedb_catalog_definition_t *index_catalog_definition,
      libcerror_error_t **error );
 
+int libesedb_table_definition_build_column_catalog_definitions_array(
+     libesedb_table_definition_t *table_definition,
+     libesedb_table_definition_t *template_table_definition,
+     libcerror_error_t **error );
+
+int libesedb_table_definition_get_column_catalog_definition_by_index(
+     libesedb_table_definition_t *table_definition,
+     int column_index,
+     libesedb_catalog_definition_t **column_catalog_definition,
+     libcerror_error_t **error );
+
+int libesedb_table_definition_get_column_index_by_identifier(
+     libesedb_table_definition_t *table_definition,
+     uint32_t column_identifier,
+     int *column_index,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
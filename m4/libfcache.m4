@@ -69,6 +69,11 @@ AC_DEFUN([AX_LIBFCACHE_CHECK_LIB],
           libfcache_cache_clear,
           [ac_cv_libfcache_dummy=yes],
           [ac_cv_libfcache=no])
+        AC_CHECK_LIB(
+          fcache,
+          libfcache_cache_resize,
+          [ac_cv_libfcache_dummy=yes],
+          [ac_cv_libfcache=no])
         AC_CHECK_LIB(
           fcache,
           libfcache_cache_get_number_of_entries,
@@ -0,0 +1,751 @@
+/*
+ * Library checksum functions testing program
+ *
+ * Copyright (C) 2009-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_unused.h"
+
+#include "../libesedb/libesedb_checksum.h"
+#include "../libesedb/libesedb_definitions.h"
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* The test data, initialized by esedb_test_checksum_initialize_data
+ */
+uint8_t esedb_test_checksum_data[ 8192 ];
+
+/* Initializes the test data with pseudo random values
+ */
+void esedb_test_checksum_initialize_data(
+     void )
+{
+	size_t data_offset = 0;
+	uint32_t seed      = 0x12345678UL;
+
+	for( data_offset = 0;
+	     data_offset < 8192;
+	     data_offset++ )
+	{
+		seed = ( seed * 1103515245UL ) + 12345UL;
+
+		esedb_test_checksum_data[ data_offset ] = (uint8_t) ( seed >> 16 );
+	}
+}
+
+/* Tests the libesedb_checksum_kernel_is_supported function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_checksum_kernel_is_supported(
+     void )
+{
+	int kernel = 0;
+	int result = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_checksum_kernel_is_supported(
+	          LIBESEDB_CHECKSUM_KERNEL_SCALAR );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	kernel = libesedb_checksum_get_kernel();
+
+	result = libesedb_checksum_kernel_is_supported(
+	          kernel );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libesedb_checksum_kernel_is_supported(
+	          -1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libesedb_checksum_calculate_little_endian_ecc32 function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_checksum_calculate_little_endian_ecc32(
+     void )
+{
+	libcerror_error_t *error    = NULL;
+	uint32_t ecc_checksum_value = 0;
+	uint32_t xor_checksum_value = 0;
+	int result                  = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_checksum_calculate_little_endian_ecc32(
+	          &ecc_checksum_value,
+	          &xor_checksum_value,
+	          esedb_test_checksum_data,
+	          4096,
+	          8,
+	          0x89abcdefUL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "ecc_checksum_value",
+	 ecc_checksum_value,
+	 (uint32_t) 0x380d47f2UL );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "xor_checksum_value",
+	 xor_checksum_value,
+	 (uint32_t) 0x433576c7UL );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_checksum_calculate_little_endian_ecc32(
+	          &ecc_checksum_value,
+	          &xor_checksum_value,
+	          esedb_test_checksum_data,
+	          8192,
+	          4,
+	          0x89abcdefUL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "ecc_checksum_value",
+	 ecc_checksum_value,
+	 (uint32_t) 0x468a468aUL );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "xor_checksum_value",
+	 xor_checksum_value,
+	 (uint32_t) 0x3388dcc7UL );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a size that is not a multitude of 16
+	 */
+	result = libesedb_checksum_calculate_little_endian_ecc32(
+	          &ecc_checksum_value,
+	          &xor_checksum_value,
+	          esedb_test_checksum_data,
+	          4100,
+	          0,
+	          0x89abcdefUL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "ecc_checksum_value",
+	 ecc_checksum_value,
+	 (uint32_t) 0x380e47d1UL );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "xor_checksum_value",
+	 xor_checksum_value,
+	 (uint32_t) 0x482f3ca9UL );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_checksum_calculate_little_endian_ecc32(
+	          NULL,
+	          &xor_checksum_value,
+	          esedb_test_checksum_data,
+	          4096,
+	          8,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_checksum_calculate_little_endian_ecc32(
+	          &ecc_checksum_value,
+	          NULL,
+	          esedb_test_checksum_data,
+	          4096,
+	          8,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_checksum_calculate_little_endian_ecc32(
+	          &ecc_checksum_value,
+	          &xor_checksum_value,
+	          NULL,
+	          4096,
+	          8,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_checksum_calculate_little_endian_ecc32(
+	          &ecc_checksum_value,
+	          &xor_checksum_value,
+	          esedb_test_checksum_data,
+	          (size_t) SSIZE_MAX + 1,
+	          8,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_checksum_calculate_little_endian_ecc32(
+	          &ecc_checksum_value,
+	          &xor_checksum_value,
+	          esedb_test_checksum_data,
+	          4096,
+	          4097,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_checksum_calculate_little_endian_ecc32(
+	          &ecc_checksum_value,
+	          &xor_checksum_value,
+	          esedb_test_checksum_data,
+	          4096,
+	          2,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_checksum_calculate_little_endian_ecc32_with_kernel function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_checksum_calculate_little_endian_ecc32_with_kernel(
+     void )
+{
+	size_t offsets[ 4 ] = { 0, 4, 8, 12 };
+	size_t sizes[ 6 ]   = { 8176, 4096, 4100, 4164, 196, 60 };
+
+	libcerror_error_t *error           = NULL;
+	uint32_t ecc_checksum_value        = 0;
+	uint32_t scalar_ecc_checksum_value = 0;
+	uint32_t scalar_xor_checksum_value = 0;
+	uint32_t xor_checksum_value        = 0;
+	int kernel                         = 0;
+	int offset_index                   = 0;
+	int result                         = 0;
+	int size_index                     = 0;
+
+	/* Test that every supported kernel matches the scalar kernel
+	 */
+	for( kernel = LIBESEDB_CHECKSUM_KERNEL_SSE2;
+	     kernel <= LIBESEDB_CHECKSUM_KERNEL_NEON;
+	     kernel++ )
+	{
+		if( libesedb_checksum_kernel_is_supported(
+		     kernel ) == 0 )
+		{
+			continue;
+		}
+		for( size_index = 0;
+		     size_index < 6;
+		     size_index++ )
+		{
+			for( offset_index = 0;
+			     offset_index < 4;
+			     offset_index++ )
+			{
+				result = libesedb_checksum_calculate_little_endian_ecc32_with_kernel(
+				          LIBESEDB_CHECKSUM_KERNEL_SCALAR,
+				          &scalar_ecc_checksum_value,
+				          &scalar_xor_checksum_value,
+				          &( esedb_test_checksum_data[ offset_index * 4 ] ),
+				          sizes[ size_index ],
+				          offsets[ offset_index ],
+				          0x89abcdefUL,
+				          &error );
+
+				ESEDB_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				ESEDB_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+
+				result = libesedb_checksum_calculate_little_endian_ecc32_with_kernel(
+				          kernel,
+				          &ecc_checksum_value,
+				          &xor_checksum_value,
+				          &( esedb_test_checksum_data[ offset_index * 4 ] ),
+				          sizes[ size_index ],
+				          offsets[ offset_index ],
+				          0x89abcdefUL,
+				          &error );
+
+				ESEDB_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				ESEDB_TEST_ASSERT_EQUAL_UINT32(
+				 "ecc_checksum_value",
+				 ecc_checksum_value,
+				 scalar_ecc_checksum_value );
+
+				ESEDB_TEST_ASSERT_EQUAL_UINT32(
+				 "xor_checksum_value",
+				 xor_checksum_value,
+				 scalar_xor_checksum_value );
+
+				ESEDB_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+			}
+		}
+	}
+	/* Test error cases
+	 */
+	result = libesedb_checksum_calculate_little_endian_ecc32_with_kernel(
+	          -1,
+	          &ecc_checksum_value,
+	          &xor_checksum_value,
+	          esedb_test_checksum_data,
+	          4096,
+	          8,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_checksum_calculate_little_endian_xor32 function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_checksum_calculate_little_endian_xor32(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t checksum_value  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_checksum_calculate_little_endian_xor32(
+	          &checksum_value,
+	          esedb_test_checksum_data,
+	          8192,
+	          0x89abcdefUL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum_value",
+	 checksum_value,
+	 (uint32_t) 0xa7959bb6UL );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a size that is not a multitude of 4
+	 */
+	result = libesedb_checksum_calculate_little_endian_xor32(
+	          &checksum_value,
+	          esedb_test_checksum_data,
+	          4094,
+	          0x89abcdefUL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum_value",
+	 checksum_value,
+	 (uint32_t) 0x05a6b85aUL );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_checksum_calculate_little_endian_xor32(
+	          NULL,
+	          esedb_test_checksum_data,
+	          8192,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_checksum_calculate_little_endian_xor32(
+	          &checksum_value,
+	          NULL,
+	          8192,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_checksum_calculate_little_endian_xor32(
+	          &checksum_value,
+	          esedb_test_checksum_data,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_checksum_calculate_little_endian_xor32_with_kernel function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_checksum_calculate_little_endian_xor32_with_kernel(
+     void )
+{
+	size_t sizes[ 6 ] = { 8188, 8184, 4094, 4163, 200, 63 };
+
+	libcerror_error_t *error       = NULL;
+	uint32_t checksum_value        = 0;
+	uint32_t scalar_checksum_value = 0;
+	int data_offset                = 0;
+	int kernel                     = 0;
+	int result                     = 0;
+	int size_index                 = 0;
+
+	/* Test that every supported kernel matches the scalar kernel
+	 */
+	for( kernel = LIBESEDB_CHECKSUM_KERNEL_SSE2;
+	     kernel <= LIBESEDB_CHECKSUM_KERNEL_NEON;
+	     kernel++ )
+	{
+		if( libesedb_checksum_kernel_is_supported(
+		     kernel ) == 0 )
+		{
+			continue;
+		}
+		for( size_index = 0;
+		     size_index < 6;
+		     size_index++ )
+		{
+			for( data_offset = 0;
+			     data_offset <= 4;
+			     data_offset += 4 )
+			{
+				result = libesedb_checksum_calculate_little_endian_xor32_with_kernel(
+				          LIBESEDB_CHECKSUM_KERNEL_SCALAR,
+				          &scalar_checksum_value,
+				          &( esedb_test_checksum_data[ data_offset ] ),
+				          sizes[ size_index ],
+				          0x89abcdefUL,
+				          &error );
+
+				ESEDB_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				ESEDB_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+
+				result = libesedb_checksum_calculate_little_endian_xor32_with_kernel(
+				          kernel,
+				          &checksum_value,
+				          &( esedb_test_checksum_data[ data_offset ] ),
+				          sizes[ size_index ],
+				          0x89abcdefUL,
+				          &error );
+
+				ESEDB_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				ESEDB_TEST_ASSERT_EQUAL_UINT32(
+				 "checksum_value",
+				 checksum_value,
+				 scalar_checksum_value );
+
+				ESEDB_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+			}
+		}
+	}
+	/* Test error cases
+	 */
+	result = libesedb_checksum_calculate_little_endian_xor32_with_kernel(
+	          -1,
+	          &checksum_value,
+	          esedb_test_checksum_data,
+	          8192,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	esedb_test_checksum_initialize_data();
+
+	ESEDB_TEST_RUN(
+	 "libesedb_checksum_kernel_is_supported",
+	 esedb_test_checksum_kernel_is_supported );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_checksum_calculate_little_endian_ecc32",
+	 esedb_test_checksum_calculate_little_endian_ecc32 );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_checksum_calculate_little_endian_ecc32_with_kernel",
+	 esedb_test_checksum_calculate_little_endian_ecc32_with_kernel );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_checksum_calculate_little_endian_xor32",
+	 esedb_test_checksum_calculate_little_endian_xor32 );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_checksum_calculate_little_endian_xor32_with_kernel",
+	 esedb_test_checksum_calculate_little_endian_xor32_with_kernel );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,327 @@
+/*
+ * Library checksum functions benchmark program
+ *
+ * Copyright (C) 2009-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <time.h>
+
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_unused.h"
+
+#include "../libesedb/libesedb_checksum.h"
+#include "../libesedb/libesedb_definitions.h"
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* The page size of the benchmark data
+ */
+#define ESEDB_TEST_CHECKSUM_BENCHMARK_PAGE_SIZE		8192
+
+/* The number of pages of the benchmark data
+ */
+#define ESEDB_TEST_CHECKSUM_BENCHMARK_NUMBER_OF_PAGES	64
+
+/* The number of passes over the benchmark data
+ */
+#define ESEDB_TEST_CHECKSUM_BENCHMARK_NUMBER_OF_PASSES	256
+
+/* The benchmark data, initialized by esedb_test_checksum_benchmark_initialize_data
+ */
+uint8_t esedb_test_checksum_benchmark_data[ ESEDB_TEST_CHECKSUM_BENCHMARK_NUMBER_OF_PAGES * ESEDB_TEST_CHECKSUM_BENCHMARK_PAGE_SIZE ];
+
+/* The kernel names
+ */
+const char *esedb_test_checksum_benchmark_kernel_names[ 4 ] = {
+	"scalar",
+	"sse2",
+	"avx2",
+	"neon" };
+
+/* Initializes the benchmark data with pseudo random values
+ */
+void esedb_test_checksum_benchmark_initialize_data(
+     void )
+{
+	size_t data_offset = 0;
+	uint32_t seed      = 0x12345678UL;
+
+	for( data_offset = 0;
+	     data_offset < sizeof( esedb_test_checksum_benchmark_data );
+	     data_offset++ )
+	{
+		seed = ( seed * 1103515245UL ) + 12345UL;
+
+		esedb_test_checksum_benchmark_data[ data_offset ] = (uint8_t) ( seed >> 16 );
+	}
+}
+
+/* Determines the throughput in MiB/s
+ */
+double esedb_test_checksum_benchmark_get_throughput(
+        clock_t start_time,
+        clock_t end_time )
+{
+	double elapsed_time = 0.0;
+	double size         = 0.0;
+
+	elapsed_time = (double) ( end_time - start_time ) / (double) CLOCKS_PER_SEC;
+
+	if( elapsed_time <= 0.0 )
+	{
+		return( 0.0 );
+	}
+	size = (double) ESEDB_TEST_CHECKSUM_BENCHMARK_NUMBER_OF_PASSES
+	     * (double) sizeof( esedb_test_checksum_benchmark_data );
+
+	return( size / ( elapsed_time * 1024.0 * 1024.0 ) );
+}
+
+/* Benchmarks the ECC-32 and XOR-32 calculation of a specific kernel
+ * The checksums are compared with those of the scalar kernel
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_checksum_benchmark_kernel(
+     int kernel )
+{
+	libcerror_error_t *error    = NULL;
+	uint8_t *page_data          = NULL;
+	clock_t end_time            = 0;
+	clock_t start_time          = 0;
+	uint32_t ecc_checksum_value = 0;
+	uint32_t ecc_sum            = 0;
+	uint32_t scalar_ecc_sum     = 0;
+	uint32_t scalar_xor_sum     = 0;
+	uint32_t xor_checksum_value = 0;
+	uint32_t xor_sum            = 0;
+	double ecc32_throughput     = 0.0;
+	double xor32_throughput     = 0.0;
+	int page_index              = 0;
+	int pass                    = 0;
+	int result                  = 0;
+
+	/* Determine the reference checksums using the scalar kernel
+	 */
+	for( page_index = 0;
+	     page_index < ESEDB_TEST_CHECKSUM_BENCHMARK_NUMBER_OF_PAGES;
+	     page_index++ )
+	{
+		page_data = &( esedb_test_checksum_benchmark_data[ page_index * ESEDB_TEST_CHECKSUM_BENCHMARK_PAGE_SIZE ] );
+
+		result = libesedb_checksum_calculate_little_endian_ecc32_with_kernel(
+		          LIBESEDB_CHECKSUM_KERNEL_SCALAR,
+		          &ecc_checksum_value,
+		          &xor_checksum_value,
+		          page_data,
+		          ESEDB_TEST_CHECKSUM_BENCHMARK_PAGE_SIZE,
+		          8,
+		          (uint32_t) page_index,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		scalar_ecc_sum ^= ecc_checksum_value;
+
+		result = libesedb_checksum_calculate_little_endian_xor32_with_kernel(
+		          LIBESEDB_CHECKSUM_KERNEL_SCALAR,
+		          &xor_checksum_value,
+		          &( page_data[ 4 ] ),
+		          ESEDB_TEST_CHECKSUM_BENCHMARK_PAGE_SIZE - 4,
+		          0x89abcdefUL,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		scalar_xor_sum ^= xor_checksum_value;
+	}
+	/* Benchmark the ECC-32 calculation
+	 */
+	start_time = clock();
+
+	for( pass = 0;
+	     pass < ESEDB_TEST_CHECKSUM_BENCHMARK_NUMBER_OF_PASSES;
+	     pass++ )
+	{
+		ecc_sum = 0;
+
+		for( page_index = 0;
+		     page_index < ESEDB_TEST_CHECKSUM_BENCHMARK_NUMBER_OF_PAGES;
+		     page_index++ )
+		{
+			page_data = &( esedb_test_checksum_benchmark_data[ page_index * ESEDB_TEST_CHECKSUM_BENCHMARK_PAGE_SIZE ] );
+
+			result = libesedb_checksum_calculate_little_endian_ecc32_with_kernel(
+			          kernel,
+			          &ecc_checksum_value,
+			          &xor_checksum_value,
+			          page_data,
+			          ESEDB_TEST_CHECKSUM_BENCHMARK_PAGE_SIZE,
+			          8,
+			          (uint32_t) page_index,
+			          &error );
+
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			ecc_sum ^= ecc_checksum_value;
+		}
+	}
+	end_time = clock();
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "ecc_sum",
+	 ecc_sum,
+	 scalar_ecc_sum );
+
+	ecc32_throughput = esedb_test_checksum_benchmark_get_throughput(
+	                    start_time,
+	                    end_time );
+
+	/* Benchmark the XOR-32 calculation
+	 */
+	start_time = clock();
+
+	for( pass = 0;
+	     pass < ESEDB_TEST_CHECKSUM_BENCHMARK_NUMBER_OF_PASSES;
+	     pass++ )
+	{
+		xor_sum = 0;
+
+		for( page_index = 0;
+		     page_index < ESEDB_TEST_CHECKSUM_BENCHMARK_NUMBER_OF_PAGES;
+		     page_index++ )
+		{
+			page_data = &( esedb_test_checksum_benchmark_data[ page_index * ESEDB_TEST_CHECKSUM_BENCHMARK_PAGE_SIZE ] );
+
+			result = libesedb_checksum_calculate_little_endian_xor32_with_kernel(
+			          kernel,
+			          &xor_checksum_value,
+			          &( page_data[ 4 ] ),
+			          ESEDB_TEST_CHECKSUM_BENCHMARK_PAGE_SIZE - 4,
+			          0x89abcdefUL,
+			          &error );
+
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			xor_sum ^= xor_checksum_value;
+		}
+	}
+	end_time = clock();
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "xor_sum",
+	 xor_sum,
+	 scalar_xor_sum );
+
+	xor32_throughput = esedb_test_checksum_benchmark_get_throughput(
+	                    start_time,
+	                    end_time );
+
+	fprintf(
+	 stdout,
+	 "%-8s ECC-32: %10.1f MiB/s  XOR-32: %10.1f MiB/s\n",
+	 esedb_test_checksum_benchmark_kernel_names[ kernel ],
+	 ecc32_throughput,
+	 xor32_throughput );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+	int kernel = 0;
+#endif
+
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	esedb_test_checksum_benchmark_initialize_data();
+
+	fprintf(
+	 stdout,
+	 "Selected kernel: %s\n",
+	 esedb_test_checksum_benchmark_kernel_names[ libesedb_checksum_get_kernel() ] );
+
+	for( kernel = LIBESEDB_CHECKSUM_KERNEL_SCALAR;
+	     kernel <= LIBESEDB_CHECKSUM_KERNEL_NEON;
+	     kernel++ )
+	{
+		if( libesedb_checksum_kernel_is_supported(
+		     kernel ) == 0 )
+		{
+			continue;
+		}
+		if( esedb_test_checksum_benchmark_kernel(
+		     kernel ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
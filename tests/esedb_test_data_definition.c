@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -34,6 +35,7 @@
 #include "esedb_test_unused.h"
 
 #include "../libesedb/libesedb_data_definition.h"
+#include "../libesedb/libesedb_io_handle.h"
 
 #if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
 
@@ -270,6 +272,304 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libesedb_data_definition_get_tagged_data_type_by_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_data_definition_get_tagged_data_type_by_identifier(
+     void )
+{
+	uint8_t record_data[ 14 ] = {
+		0x00, 0x01, 0x08, 0x00, 0x2c, 0x01, 0x0b, 0x40, 'A', 'B', 'C', 0x01, 'x', 'y' };
+
+	libesedb_data_type_definition_t data_type_definition;
+
+	libcerror_error_t *error        = NULL;
+	libesedb_io_handle_t *io_handle = NULL;
+	int result                      = 0;
+	int tagged_data_type_index      = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->page_size = 4096;
+
+	/* Test regular cases
+	 */
+	memory_set(
+	 &data_type_definition,
+	 0,
+	 sizeof( libesedb_data_type_definition_t ) );
+
+	result = libesedb_data_definition_get_tagged_data_type_by_identifier(
+	          io_handle,
+	          record_data,
+	          14,
+	          0,
+	          300,
+	          &tagged_data_type_index,
+	          &data_type_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "tagged_data_type_index",
+	 tagged_data_type_index,
+	 2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "data_type_definition.data_offset",
+	 data_type_definition.data_offset,
+	 12 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "data_type_definition.data_size",
+	 data_type_definition.data_size,
+	 2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "data_type_definition.data_flags",
+	 data_type_definition.data_flags,
+	 0x01 );
+
+	memory_set(
+	 &data_type_definition,
+	 0,
+	 sizeof( libesedb_data_type_definition_t ) );
+
+	tagged_data_type_index = 0;
+
+	result = libesedb_data_definition_get_tagged_data_type_by_identifier(
+	          io_handle,
+	          record_data,
+	          14,
+	          0,
+	          256,
+	          &tagged_data_type_index,
+	          &data_type_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "tagged_data_type_index",
+	 tagged_data_type_index,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "data_type_definition.data_offset",
+	 data_type_definition.data_offset,
+	 8 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "data_type_definition.data_size",
+	 data_type_definition.data_size,
+	 3 );
+
+	result = libesedb_data_definition_get_tagged_data_type_by_identifier(
+	          io_handle,
+	          record_data,
+	          14,
+	          0,
+	          257,
+	          &tagged_data_type_index,
+	          &data_type_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "tagged_data_type_index",
+	 tagged_data_type_index,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libesedb_data_definition_get_tagged_data_type_by_identifier(
+	          NULL,
+	          record_data,
+	          14,
+	          0,
+	          256,
+	          &tagged_data_type_index,
+	          &data_type_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_data_definition_get_tagged_data_type_by_identifier(
+	          io_handle,
+	          NULL,
+	          14,
+	          0,
+	          256,
+	          &tagged_data_type_index,
+	          &data_type_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_data_definition_get_tagged_data_type_by_identifier(
+	          io_handle,
+	          record_data,
+	          14,
+	          0,
+	          256,
+	          NULL,
+	          &data_type_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_data_definition_get_tagged_data_type_by_identifier(
+	          io_handle,
+	          record_data,
+	          14,
+	          0,
+	          256,
+	          &tagged_data_type_index,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with tagged data type offsets that exceed the record data
+	 */
+	result = libesedb_data_definition_get_tagged_data_type_by_identifier(
+	          io_handle,
+	          record_data,
+	          6,
+	          0,
+	          256,
+	          &tagged_data_type_index,
+	          &data_type_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 /* The main program
@@ -301,6 +601,16 @@ int main(
 
 	/* TODO: add tests for libesedb_data_definition_read_record */
 
+	ESEDB_TEST_RUN(
+	 "libesedb_data_definition_get_tagged_data_type_by_identifier",
+	 esedb_test_data_definition_get_tagged_data_type_by_identifier );
+
+	/* TODO: add tests for libesedb_data_definition_get_record_value_encoding */
+
+	/* TODO: add tests for libesedb_data_definition_read_record_value */
+
+	/* TODO: add tests for libesedb_data_definition_refill_record_value */
+
 	/* TODO: add tests for libesedb_data_definition_read_long_value */
 
 	/* TODO: add tests for libesedb_data_definition_read_long_value_segment */
@@ -1362,6 +1362,22 @@ int main(
 
 		/* TODO: add tests for libesedb_file_get_page_size */
 
+		/* TODO: add tests for libesedb_file_get_number_of_pages */
+
+		/* TODO: add tests for libesedb_file_verify_pages */
+
+		/* TODO: add tests for libesedb_file_get_memory_budget */
+
+		/* TODO: add tests for libesedb_file_set_memory_budget */
+
+		/* TODO: add tests for libesedb_file_get_checksum_policy */
+
+		/* TODO: add tests for libesedb_file_set_checksum_policy */
+
+		/* TODO: add tests for libesedb_file_set_checksum_mismatch_callback */
+
+		/* TODO: add tests for libesedb_file_get_number_of_checksum_mismatches */
+
 		/* TODO: add tests for libesedb_file_get_number_of_tables */
 
 		/* TODO: add tests for libesedb_file_get_table */
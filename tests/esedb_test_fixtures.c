@@ -0,0 +1,730 @@
+/*
+ * Fixtures for testing internal library types
+ *
+ * Copyright (C) 2009-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "esedb_test_fixtures.h"
+#include "esedb_test_libbfio.h"
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_libfdata.h"
+
+#include "../libesedb/libesedb_catalog_definition.h"
+#include "../libesedb/libesedb_definitions.h"
+#include "../libesedb/libesedb_io_handle.h"
+#include "../libesedb/libesedb_libfcache.h"
+#include "../libesedb/libesedb_table.h"
+#include "../libesedb/libesedb_table_definition.h"
+
+#include "../libesedb/esedb_page.h"
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* The table test file data contains a table with FDP 1 and an index with FDP 4
+ *
+ * Page 1 is the root branch page of the table, page value 'd' references leaf page 2
+ * and the last page value, with an empty key, references leaf page 3.
+ * Page 2 and 3 are sibling leaf pages that contain the records, where the record with
+ * key 'b' is defunct. Every record has a 32-bit unsigned integer column with identifier 1
+ * and a binary data column with identifier 128.
+ * Page 4 is the root leaf page of the index, every index value contains the primary key
+ * of a record. The index value with primary key "e\x85" matches the record with key "e\x05"
+ * and the record with key 'a' is referenced twice.
+ */
+uint32_t esedb_test_fixtures_table_column_identifiers[ 2 ] = {
+	1, 128 };
+
+uint32_t esedb_test_fixtures_table_column_types[ 2 ] = {
+	LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED, LIBESEDB_COLUMN_TYPE_BINARY_DATA };
+
+uint32_t esedb_test_fixtures_table_column_sizes[ 2 ] = {
+	4, 0 };
+
+uint8_t esedb_test_fixtures_table_root_page_values_data[ 29 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x00, 'd', 0x02, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00 };
+
+uint16_t esedb_test_fixtures_table_root_page_value_sizes[ 3 ] = {
+	16, 7, 6 };
+
+uint8_t esedb_test_fixtures_table_first_leaf_page_values_data[ 44 ] = {
+	0x01, 0x00, 'a', 0x01, 0x80, 0x08, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 'A',
+	0x01, 0x00, 'b', 0x01, 0x80, 0x08, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 'B',
+	0x01, 0x00, 'c', 0x01, 0x80, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 'C', 'C', 'C' };
+
+uint16_t esedb_test_fixtures_table_first_leaf_page_value_sizes[ 4 ] = {
+	0, 14, 14, 16 };
+
+uint8_t esedb_test_fixtures_table_first_leaf_page_tag_flags[ 4 ] = {
+	0, 0, LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT, 0 };
+
+uint8_t esedb_test_fixtures_table_last_leaf_page_values_data[ 47 ] = {
+	0x01, 0x00, 'e', 0x01, 0x80, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x80,
+	0x02, 0x00, 'e', 0x05, 0x01, 0x80, 0x08, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x00, 'E', 'E', 'E', 'E', 'E',
+	0x01, 0x00, 'g', 0x01, 0x80, 0x08, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 'G', 'G' };
+
+uint16_t esedb_test_fixtures_table_last_leaf_page_value_sizes[ 4 ] = {
+	0, 13, 19, 15 };
+
+uint8_t esedb_test_fixtures_index_root_page_values_data[ 41 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x01, 'g',
+	0x01, 0x00, 0x03, 'c',
+	0x01, 0x00, 0x04, 'e',
+	0x01, 0x00, 0x05, 'a',
+	0x01, 0x00, 0x06, 'e', 0x85,
+	0x01, 0x00, 0x07, 'a' };
+
+uint16_t esedb_test_fixtures_index_root_page_value_sizes[ 7 ] = {
+	16, 4, 4, 4, 4, 5, 4 };
+
+/* The keys, 32-bit values and binary data of the records in table order
+ */
+const uint8_t *esedb_test_fixtures_table_record_keys[ ESEDB_TEST_FIXTURES_TABLE_NUMBER_OF_RECORDS ] = {
+	(uint8_t *) "a", (uint8_t *) "c", (uint8_t *) "e", (uint8_t *) "e\x05", (uint8_t *) "g" };
+
+const size_t esedb_test_fixtures_table_record_key_sizes[ ESEDB_TEST_FIXTURES_TABLE_NUMBER_OF_RECORDS ] = {
+	1, 1, 1, 2, 1 };
+
+const uint32_t esedb_test_fixtures_table_record_values[ ESEDB_TEST_FIXTURES_TABLE_NUMBER_OF_RECORDS ] = {
+	5, 3, 4, 6, 1 };
+
+const uint8_t *esedb_test_fixtures_table_record_binary_data[ ESEDB_TEST_FIXTURES_TABLE_NUMBER_OF_RECORDS ] = {
+	(uint8_t *) "A", (uint8_t *) "CCC", NULL, (uint8_t *) "EEEEE", (uint8_t *) "GG" };
+
+const size_t esedb_test_fixtures_table_record_binary_data_sizes[ ESEDB_TEST_FIXTURES_TABLE_NUMBER_OF_RECORDS ] = {
+	1, 3, 0, 5, 2 };
+
+/* The 32-bit values of the records in index order
+ */
+const uint32_t esedb_test_fixtures_index_record_values[ ESEDB_TEST_FIXTURES_INDEX_NUMBER_OF_RECORDS ] = {
+	1, 3, 4, 5, 6, 5 };
+
+/* Writes the data of a page for testing
+ * The page values data contains the data of the page values, including the page header value,
+ * stored consecutively. The page tag flags are optional
+ * The checksum is left 0 so that it is not verified
+ */
+void esedb_test_fixtures_write_page(
+     uint8_t *page_data,
+     uint32_t page_flags,
+     uint32_t previous_page_number,
+     uint32_t next_page_number,
+     const uint8_t *page_values_data,
+     const uint16_t *page_value_sizes,
+     const uint8_t *page_tag_flags,
+     uint16_t number_of_page_values )
+{
+	uint8_t *page_tag_data     = NULL;
+	uint16_t page_tag_value    = 0;
+	uint16_t page_value_index  = 0;
+	uint16_t page_value_offset = 0;
+
+	memory_set(
+	 page_data,
+	 0,
+	 ESEDB_TEST_FIXTURES_PAGE_SIZE );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_page_header_t *) page_data )->previous_page,
+	 previous_page_number );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_page_header_t *) page_data )->next_page,
+	 next_page_number );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 ( (esedb_page_header_t *) page_data )->available_page_tag,
+	 number_of_page_values );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_page_header_t *) page_data )->page_flags,
+	 page_flags );
+
+	/* The page tags are stored back to front
+	 */
+	page_tag_data = &( page_data[ ESEDB_TEST_FIXTURES_PAGE_SIZE ] );
+
+	for( page_value_index = 0;
+	     page_value_index < number_of_page_values;
+	     page_value_index++ )
+	{
+		memory_copy(
+		 &( page_data[ sizeof( esedb_page_header_t ) + page_value_offset ] ),
+		 &( page_values_data[ page_value_offset ] ),
+		 page_value_sizes[ page_value_index ] );
+
+		page_tag_value = page_value_offset;
+
+		if( page_tag_flags != NULL )
+		{
+			page_tag_value |= (uint16_t) page_tag_flags[ page_value_index ] << 13;
+		}
+		page_tag_data -= 4;
+
+		byte_stream_copy_from_uint16_little_endian(
+		 page_tag_data,
+		 page_value_sizes[ page_value_index ] );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 &( page_tag_data[ 2 ] ),
+		 page_tag_value );
+
+		page_value_offset += page_value_sizes[ page_value_index ];
+	}
+}
+
+/* Opens the pages of test file data
+ * The file data starts with the file header and its backup, followed by the pages
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_fixtures_open_pages(
+     uint8_t *file_data,
+     size_t file_data_size,
+     libesedb_io_handle_t **io_handle,
+     libbfio_handle_t **file_io_handle,
+     libfdata_vector_t **pages_vector,
+     libfcache_cache_t **pages_cache,
+     libcerror_error_t **error )
+{
+	int maximum_number_of_cache_entries = 0;
+	int segment_index                   = 0;
+
+	if( libesedb_io_handle_initialize(
+	     io_handle,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	( *io_handle )->page_size = ESEDB_TEST_FIXTURES_PAGE_SIZE;
+
+	if( libesedb_io_handle_set_pages_data_range(
+	     *io_handle,
+	     (size64_t) file_data_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libbfio_memory_range_initialize(
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libbfio_memory_range_set(
+	     *file_io_handle,
+	     file_data,
+	     file_data_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libbfio_handle_open(
+	     *file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfdata_vector_initialize(
+	     pages_vector,
+	     (size64_t) ( *io_handle )->page_size,
+	     (intptr_t *) *io_handle,
+	     NULL,
+	     NULL,
+	     (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfcache_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libesedb_io_handle_read_page,
+	     NULL,
+	     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfdata_vector_append_segment(
+	     *pages_vector,
+	     &segment_index,
+	     0,
+	     ( *io_handle )->pages_data_offset,
+	     ( *io_handle )->pages_data_size,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libesedb_io_handle_get_maximum_number_of_cache_entries(
+	     *io_handle,
+	     LIBESEDB_CACHE_TYPE_PAGES,
+	     &maximum_number_of_cache_entries,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfcache_cache_initialize(
+	     pages_cache,
+	     maximum_number_of_cache_entries,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	esedb_test_fixtures_close_pages(
+	 io_handle,
+	 file_io_handle,
+	 pages_vector,
+	 pages_cache,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Closes the pages of test file data
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_fixtures_close_pages(
+     libesedb_io_handle_t **io_handle,
+     libbfio_handle_t **file_io_handle,
+     libfdata_vector_t **pages_vector,
+     libfcache_cache_t **pages_cache,
+     libcerror_error_t **error )
+{
+	int result = 1;
+
+	/* The pages in the pages cache are returned to the page pool of the IO handle
+	 */
+	if( *pages_cache != NULL )
+	{
+		if( libfcache_cache_free(
+		     pages_cache,
+		     error ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( *pages_vector != NULL )
+	{
+		if( libfdata_vector_free(
+		     pages_vector,
+		     error ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( *file_io_handle != NULL )
+	{
+		libbfio_handle_close(
+		 *file_io_handle,
+		 NULL );
+
+		if( libbfio_handle_free(
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( *io_handle != NULL )
+	{
+		if( libesedb_io_handle_free(
+		     io_handle,
+		     error ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Creates a table definition with column catalog definitions for testing
+ * The column types and sizes are optional and 0 is used when not provided
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_fixtures_table_definition_initialize(
+     libesedb_table_definition_t **table_definition,
+     const uint32_t *column_identifiers,
+     const uint32_t *column_types,
+     const uint32_t *column_sizes,
+     int number_of_columns,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_catalog_definition_t *table_catalog_definition  = NULL;
+	static char *function                                    = "esedb_test_fixtures_table_definition_initialize";
+	int column_index                                         = 0;
+
+	if( table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_identifiers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column identifiers.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_columns < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of columns value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_catalog_definition_initialize(
+	     &table_catalog_definition,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	table_catalog_definition->type = LIBESEDB_CATALOG_DEFINITION_TYPE_TABLE;
+
+	if( libesedb_table_definition_initialize(
+	     table_definition,
+	     table_catalog_definition,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	/* The table definition takes over management of the table catalog definition
+	 */
+	table_catalog_definition = NULL;
+
+	for( column_index = 0;
+	     column_index < number_of_columns;
+	     column_index++ )
+	{
+		if( libesedb_catalog_definition_initialize(
+		     &column_catalog_definition,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		column_catalog_definition->type       = LIBESEDB_CATALOG_DEFINITION_TYPE_COLUMN;
+		column_catalog_definition->identifier = column_identifiers[ column_index ];
+
+		if( column_types != NULL )
+		{
+			column_catalog_definition->column_type = column_types[ column_index ];
+		}
+		if( column_sizes != NULL )
+		{
+			column_catalog_definition->size = column_sizes[ column_index ];
+		}
+		if( libesedb_table_definition_append_column_catalog_definition(
+		     *table_definition,
+		     column_catalog_definition,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		column_catalog_definition = NULL;
+	}
+	if( libesedb_table_definition_build_column_catalog_definitions_array(
+	     *table_definition,
+	     NULL,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( column_catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &column_catalog_definition,
+		 NULL );
+	}
+	if( *table_definition != NULL )
+	{
+		libesedb_table_definition_free(
+		 table_definition,
+		 NULL );
+	}
+	if( table_catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &table_catalog_definition,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Creates a table of the table test file data
+ * Make sure the value fixtures_table is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_fixtures_table_initialize(
+     esedb_test_fixtures_table_t **fixtures_table,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *index_catalog_definition = NULL;
+	static char *function                                   = "esedb_test_fixtures_table_initialize";
+
+	if( fixtures_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid fixtures table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *fixtures_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid fixtures table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*fixtures_table = memory_allocate_structure(
+	                   esedb_test_fixtures_table_t );
+
+	if( *fixtures_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create fixtures table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *fixtures_table,
+	     0,
+	     sizeof( esedb_test_fixtures_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear fixtures table.",
+		 function );
+
+		memory_free(
+		 *fixtures_table );
+
+		*fixtures_table = NULL;
+
+		return( -1 );
+	}
+	esedb_test_fixtures_write_page(
+	 &( ( *fixtures_table )->file_data[ 2 * ESEDB_TEST_FIXTURES_PAGE_SIZE ] ),
+	 LIBESEDB_PAGE_FLAG_IS_ROOT | LIBESEDB_PAGE_FLAG_IS_PARENT,
+	 0,
+	 0,
+	 esedb_test_fixtures_table_root_page_values_data,
+	 esedb_test_fixtures_table_root_page_value_sizes,
+	 NULL,
+	 3 );
+
+	esedb_test_fixtures_write_page(
+	 &( ( *fixtures_table )->file_data[ 3 * ESEDB_TEST_FIXTURES_PAGE_SIZE ] ),
+	 LIBESEDB_PAGE_FLAG_IS_LEAF,
+	 0,
+	 3,
+	 esedb_test_fixtures_table_first_leaf_page_values_data,
+	 esedb_test_fixtures_table_first_leaf_page_value_sizes,
+	 esedb_test_fixtures_table_first_leaf_page_tag_flags,
+	 4 );
+
+	esedb_test_fixtures_write_page(
+	 &( ( *fixtures_table )->file_data[ 4 * ESEDB_TEST_FIXTURES_PAGE_SIZE ] ),
+	 LIBESEDB_PAGE_FLAG_IS_LEAF,
+	 2,
+	 0,
+	 esedb_test_fixtures_table_last_leaf_page_values_data,
+	 esedb_test_fixtures_table_last_leaf_page_value_sizes,
+	 NULL,
+	 4 );
+
+	esedb_test_fixtures_write_page(
+	 &( ( *fixtures_table )->file_data[ 5 * ESEDB_TEST_FIXTURES_PAGE_SIZE ] ),
+	 LIBESEDB_PAGE_FLAG_IS_ROOT | LIBESEDB_PAGE_FLAG_IS_LEAF | LIBESEDB_PAGE_FLAG_IS_INDEX,
+	 0,
+	 0,
+	 esedb_test_fixtures_index_root_page_values_data,
+	 esedb_test_fixtures_index_root_page_value_sizes,
+	 NULL,
+	 7 );
+
+	if( esedb_test_fixtures_open_pages(
+	     ( *fixtures_table )->file_data,
+	     ESEDB_TEST_FIXTURES_TABLE_FILE_DATA_SIZE,
+	     &( ( *fixtures_table )->io_handle ),
+	     &( ( *fixtures_table )->file_io_handle ),
+	     &( ( *fixtures_table )->pages_vector ),
+	     &( ( *fixtures_table )->pages_cache ),
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( esedb_test_fixtures_table_definition_initialize(
+	     &( ( *fixtures_table )->table_definition ),
+	     esedb_test_fixtures_table_column_identifiers,
+	     esedb_test_fixtures_table_column_types,
+	     esedb_test_fixtures_table_column_sizes,
+	     2,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	( *fixtures_table )->table_definition->table_catalog_definition->identifier              = 2;
+	( *fixtures_table )->table_definition->table_catalog_definition->father_data_page_number = 1;
+
+	if( libesedb_catalog_definition_initialize(
+	     &index_catalog_definition,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	index_catalog_definition->type                    = LIBESEDB_CATALOG_DEFINITION_TYPE_INDEX;
+	index_catalog_definition->identifier              = 3;
+	index_catalog_definition->father_data_page_number = 4;
+
+	if( libesedb_table_definition_append_index_catalog_definition(
+	     ( *fixtures_table )->table_definition,
+	     index_catalog_definition,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	/* The table definition takes over management of the index catalog definition
+	 */
+	index_catalog_definition = NULL;
+
+	if( libesedb_table_initialize(
+	     &( ( *fixtures_table )->table ),
+	     ( *fixtures_table )->file_io_handle,
+	     ( *fixtures_table )->io_handle,
+	     ( *fixtures_table )->table_definition,
+	     NULL,
+	     ( *fixtures_table )->pages_vector,
+	     ( *fixtures_table )->pages_cache,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( index_catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &index_catalog_definition,
+		 NULL );
+	}
+	if( *fixtures_table != NULL )
+	{
+		esedb_test_fixtures_table_free(
+		 fixtures_table,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a table of the table test file data
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_fixtures_table_free(
+     esedb_test_fixtures_table_t **fixtures_table,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_test_fixtures_table_free";
+	int result            = 1;
+
+	if( fixtures_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid fixtures table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *fixtures_table != NULL )
+	{
+		if( ( *fixtures_table )->table != NULL )
+		{
+			if( libesedb_table_free(
+			     &( ( *fixtures_table )->table ),
+			     error ) != 1 )
+			{
+				result = -1;
+			}
+		}
+		if( ( *fixtures_table )->table_definition != NULL )
+		{
+			if( libesedb_table_definition_free(
+			     &( ( *fixtures_table )->table_definition ),
+			     error ) != 1 )
+			{
+				result = -1;
+			}
+		}
+		if( esedb_test_fixtures_close_pages(
+		     &( ( *fixtures_table )->io_handle ),
+		     &( ( *fixtures_table )->file_io_handle ),
+		     &( ( *fixtures_table )->pages_vector ),
+		     &( ( *fixtures_table )->pages_cache ),
+		     error ) != 1 )
+		{
+			result = -1;
+		}
+		memory_free(
+		 *fixtures_table );
+
+		*fixtures_table = NULL;
+	}
+	return( result );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
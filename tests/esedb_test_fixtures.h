@@ -0,0 +1,153 @@
+/*
+ * Fixtures for testing internal library types
+ *
+ * Copyright (C) 2009-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ESEDB_TEST_FIXTURES_H )
+#define _ESEDB_TEST_FIXTURES_H
+
+#include <common.h>
+#include <types.h>
+
+#include "esedb_test_libbfio.h"
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_libfdata.h"
+
+#include "../libesedb/libesedb_io_handle.h"
+#include "../libesedb/libesedb_libfcache.h"
+#include "../libesedb/libesedb_table_definition.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* The page size of the test file data
+ */
+#define ESEDB_TEST_FIXTURES_PAGE_SIZE			4096
+
+/* The size of the table test file data, the file header, its backup and 4 pages
+ */
+#define ESEDB_TEST_FIXTURES_TABLE_FILE_DATA_SIZE	( 6 * ESEDB_TEST_FIXTURES_PAGE_SIZE )
+
+/* The number of records in the table test file data
+ */
+#define ESEDB_TEST_FIXTURES_TABLE_NUMBER_OF_RECORDS	5
+
+/* The number of records in the index of the table test file data
+ */
+#define ESEDB_TEST_FIXTURES_INDEX_NUMBER_OF_RECORDS	6
+
+typedef struct esedb_test_fixtures_table esedb_test_fixtures_table_t;
+
+struct esedb_test_fixtures_table
+{
+	/* The IO handle
+	 */
+	libesedb_io_handle_t *io_handle;
+
+	/* The file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The pages vector
+	 */
+	libfdata_vector_t *pages_vector;
+
+	/* The pages cache
+	 */
+	libfcache_cache_t *pages_cache;
+
+	/* The table definition
+	 */
+	libesedb_table_definition_t *table_definition;
+
+	/* The table
+	 */
+	libesedb_table_t *table;
+
+	/* The file data
+	 */
+	uint8_t file_data[ ESEDB_TEST_FIXTURES_TABLE_FILE_DATA_SIZE ];
+};
+
+extern const uint8_t *esedb_test_fixtures_table_record_keys[ ESEDB_TEST_FIXTURES_TABLE_NUMBER_OF_RECORDS ];
+
+extern const size_t esedb_test_fixtures_table_record_key_sizes[ ESEDB_TEST_FIXTURES_TABLE_NUMBER_OF_RECORDS ];
+
+extern const uint32_t esedb_test_fixtures_table_record_values[ ESEDB_TEST_FIXTURES_TABLE_NUMBER_OF_RECORDS ];
+
+extern const uint8_t *esedb_test_fixtures_table_record_binary_data[ ESEDB_TEST_FIXTURES_TABLE_NUMBER_OF_RECORDS ];
+
+extern const size_t esedb_test_fixtures_table_record_binary_data_sizes[ ESEDB_TEST_FIXTURES_TABLE_NUMBER_OF_RECORDS ];
+
+extern const uint32_t esedb_test_fixtures_index_record_values[ ESEDB_TEST_FIXTURES_INDEX_NUMBER_OF_RECORDS ];
+
+void esedb_test_fixtures_write_page(
+     uint8_t *page_data,
+     uint32_t page_flags,
+     uint32_t previous_page_number,
+     uint32_t next_page_number,
+     const uint8_t *page_values_data,
+     const uint16_t *page_value_sizes,
+     const uint8_t *page_tag_flags,
+     uint16_t number_of_page_values );
+
+int esedb_test_fixtures_open_pages(
+     uint8_t *file_data,
+     size_t file_data_size,
+     libesedb_io_handle_t **io_handle,
+     libbfio_handle_t **file_io_handle,
+     libfdata_vector_t **pages_vector,
+     libfcache_cache_t **pages_cache,
+     libcerror_error_t **error );
+
+int esedb_test_fixtures_close_pages(
+     libesedb_io_handle_t **io_handle,
+     libbfio_handle_t **file_io_handle,
+     libfdata_vector_t **pages_vector,
+     libfcache_cache_t **pages_cache,
+     libcerror_error_t **error );
+
+int esedb_test_fixtures_table_definition_initialize(
+     libesedb_table_definition_t **table_definition,
+     const uint32_t *column_identifiers,
+     const uint32_t *column_types,
+     const uint32_t *column_sizes,
+     int number_of_columns,
+     libcerror_error_t **error );
+
+int esedb_test_fixtures_table_initialize(
+     esedb_test_fixtures_table_t **fixtures_table,
+     libcerror_error_t **error );
+
+int esedb_test_fixtures_table_free(
+     esedb_test_fixtures_table_t **fixtures_table,
+     libcerror_error_t **error );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ESEDB_TEST_FIXTURES_H ) */
+
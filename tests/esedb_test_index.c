@@ -27,6 +27,7 @@
 #include <stdlib.h>
 #endif
 
+#include "esedb_test_fixtures.h"
 #include "esedb_test_libcerror.h"
 #include "esedb_test_libesedb.h"
 #include "esedb_test_macros.h"
@@ -34,6 +35,7 @@
 #include "esedb_test_unused.h"
 
 #include "../libesedb/libesedb_index.h"
+#include "../libesedb/libesedb_key.h"
 
 /* Tests the libesedb_index_free function
  * Returns 1 if successful or 0 if not
@@ -75,6 +77,1196 @@ on_error:
 
 #if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
 
+/* Tests the libesedb_index_sort_keys function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_index_sort_keys(
+     void )
+{
+	uint8_t key_data[ 5 ]     = { 0x03, 0x01, 0x02, 0x01, 0x00 };
+	int expected_entries[ 5 ] = { 4, 1, 3, 2, 0 };
+	libesedb_key_t *keys[ 5 ] = { NULL, NULL, NULL, NULL, NULL };
+	libcerror_error_t *error  = NULL;
+	int sorted_entries[ 5 ];
+	int entry_index           = 0;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	for( entry_index = 0;
+	     entry_index < 5;
+	     entry_index++ )
+	{
+		result = libesedb_key_initialize(
+		          &( keys[ entry_index ] ),
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_key_set_data(
+		          keys[ entry_index ],
+		          &( key_data[ entry_index ] ),
+		          1,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases, equal keys retain their order
+	 */
+	result = libesedb_index_sort_keys(
+	          keys,
+	          5,
+	          sorted_entries,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( entry_index = 0;
+	     entry_index < 5;
+	     entry_index++ )
+	{
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "sorted_entries[ entry_index ]",
+		 sorted_entries[ entry_index ],
+		 expected_entries[ entry_index ] );
+	}
+	result = libesedb_index_sort_keys(
+	          keys,
+	          0,
+	          sorted_entries,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_index_sort_keys(
+	          NULL,
+	          5,
+	          sorted_entries,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_sort_keys(
+	          keys,
+	          -1,
+	          sorted_entries,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_sort_keys(
+	          keys,
+	          5,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	for( entry_index = 0;
+	     entry_index < 5;
+	     entry_index++ )
+	{
+		result = libesedb_key_free(
+		          &( keys[ entry_index ] ),
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( entry_index = 0;
+	     entry_index < 5;
+	     entry_index++ )
+	{
+		if( keys[ entry_index ] != NULL )
+		{
+			libesedb_key_free(
+			 &( keys[ entry_index ] ),
+			 NULL );
+		}
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_index_get_number_of_records function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_index_get_number_of_records(
+     void )
+{
+	esedb_test_fixtures_table_t *fixtures_table = NULL;
+	libcerror_error_t *error                    = NULL;
+	libesedb_index_t *index                     = NULL;
+	int number_of_records                       = 0;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_fixtures_table_initialize(
+	          &fixtures_table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_get_index(
+	          fixtures_table->table,
+	          0,
+	          &index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "index",
+	 index );
+
+	/* Test regular cases
+	 */
+	result = libesedb_index_get_number_of_records(
+	          index,
+	          &number_of_records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 number_of_records,
+	 ESEDB_TEST_FIXTURES_INDEX_NUMBER_OF_RECORDS );
+
+	/* Test error cases
+	 */
+	result = libesedb_index_get_number_of_records(
+	          NULL,
+	          &number_of_records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_index_free(
+	          &index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_fixtures_table_free(
+	          &fixtures_table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index != NULL )
+	{
+		libesedb_index_free(
+		 &index,
+		 NULL );
+	}
+	if( fixtures_table != NULL )
+	{
+		esedb_test_fixtures_table_free(
+		 &fixtures_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_index_get_record function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_index_get_record(
+     void )
+{
+	esedb_test_fixtures_table_t *fixtures_table = NULL;
+	libcerror_error_t *error                    = NULL;
+	libesedb_index_t *index                     = NULL;
+	libesedb_record_t *record                   = NULL;
+	uint32_t value_32bit                        = 0;
+	int record_entry                            = 0;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_fixtures_table_initialize(
+	          &fixtures_table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_get_index(
+	          fixtures_table->table,
+	          0,
+	          &index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "index",
+	 index );
+
+	/* Test regular cases, the index value with primary key "e\x85" is matched
+	 * with the record with key "e\x05"
+	 */
+	for( record_entry = 0;
+	     record_entry < ESEDB_TEST_FIXTURES_INDEX_NUMBER_OF_RECORDS;
+	     record_entry++ )
+	{
+		result = libesedb_index_get_record(
+		          index,
+		          record_entry,
+		          &record,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ESEDB_TEST_ASSERT_IS_NOT_NULL(
+		 "record",
+		 record );
+
+		result = libesedb_record_get_value_32bit(
+		          record,
+		          0,
+		          &value_32bit,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ESEDB_TEST_ASSERT_EQUAL_UINT32(
+		 "value_32bit",
+		 value_32bit,
+		 esedb_test_fixtures_index_record_values[ record_entry ] );
+
+		result = libesedb_record_free(
+		          &record,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libesedb_index_get_record(
+	          NULL,
+	          0,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_get_record(
+	          index,
+	          0,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_get_record(
+	          index,
+	          ESEDB_TEST_FIXTURES_INDEX_NUMBER_OF_RECORDS,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_index_free(
+	          &index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_fixtures_table_free(
+	          &fixtures_table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libesedb_record_free(
+		 &record,
+		 NULL );
+	}
+	if( index != NULL )
+	{
+		libesedb_index_free(
+		 &index,
+		 NULL );
+	}
+	if( fixtures_table != NULL )
+	{
+		esedb_test_fixtures_table_free(
+		 &fixtures_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_index_get_records function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_index_get_records(
+     void )
+{
+	libesedb_record_t *records[ ESEDB_TEST_FIXTURES_INDEX_NUMBER_OF_RECORDS ];
+
+	esedb_test_fixtures_table_t *fixtures_table = NULL;
+	libcerror_error_t *error                    = NULL;
+	libesedb_index_t *index                     = NULL;
+	libesedb_record_t *record                   = NULL;
+	uint32_t expected_value_32bit               = 0;
+	uint32_t value_32bit                        = 0;
+	int record_entry                            = 0;
+	int result                                  = 0;
+
+	for( record_entry = 0;
+	     record_entry < ESEDB_TEST_FIXTURES_INDEX_NUMBER_OF_RECORDS;
+	     record_entry++ )
+	{
+		records[ record_entry ] = NULL;
+	}
+	/* Initialize test
+	 */
+	result = esedb_test_fixtures_table_initialize(
+	          &fixtures_table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_get_index(
+	          fixtures_table->table,
+	          0,
+	          &index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "index",
+	 index );
+
+	/* Test regular cases, the records are resolved in a single pass over both leaf pages
+	 * and must be the same as those retrieved per entry by libesedb_index_get_record
+	 */
+	result = libesedb_index_get_records(
+	          index,
+	          0,
+	          ESEDB_TEST_FIXTURES_INDEX_NUMBER_OF_RECORDS,
+	          records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( record_entry = 0;
+	     record_entry < ESEDB_TEST_FIXTURES_INDEX_NUMBER_OF_RECORDS;
+	     record_entry++ )
+	{
+		ESEDB_TEST_ASSERT_IS_NOT_NULL(
+		 "records[ record_entry ]",
+		 records[ record_entry ] );
+
+		result = libesedb_index_get_record(
+		          index,
+		          record_entry,
+		          &record,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_record_get_value_32bit(
+		          record,
+		          0,
+		          &expected_value_32bit,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ESEDB_TEST_ASSERT_EQUAL_UINT32(
+		 "expected_value_32bit",
+		 expected_value_32bit,
+		 esedb_test_fixtures_index_record_values[ record_entry ] );
+
+		result = libesedb_record_get_value_32bit(
+		          records[ record_entry ],
+		          0,
+		          &value_32bit,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ESEDB_TEST_ASSERT_EQUAL_UINT32(
+		 "value_32bit",
+		 value_32bit,
+		 expected_value_32bit );
+
+		result = libesedb_record_free(
+		          &record,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_record_free(
+		          &( records[ record_entry ] ),
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test a range of entries that starts after the first entry
+	 */
+	result = libesedb_index_get_records(
+	          index,
+	          2,
+	          3,
+	          records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( record_entry = 0;
+	     record_entry < 3;
+	     record_entry++ )
+	{
+		result = libesedb_record_get_value_32bit(
+		          records[ record_entry ],
+		          0,
+		          &value_32bit,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ESEDB_TEST_ASSERT_EQUAL_UINT32(
+		 "value_32bit",
+		 value_32bit,
+		 esedb_test_fixtures_index_record_values[ 2 + record_entry ] );
+
+		result = libesedb_record_free(
+		          &( records[ record_entry ] ),
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libesedb_index_get_records(
+	          index,
+	          ESEDB_TEST_FIXTURES_INDEX_NUMBER_OF_RECORDS,
+	          0,
+	          records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_index_get_records(
+	          NULL,
+	          0,
+	          1,
+	          records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_get_records(
+	          index,
+	          0,
+	          -1,
+	          records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_get_records(
+	          index,
+	          0,
+	          1,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_get_records(
+	          index,
+	          4,
+	          3,
+	          records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libesedb_index_get_records with a record value that is already set
+	 */
+	records[ 0 ] = (libesedb_record_t *) 0x12345678UL;
+
+	result = libesedb_index_get_records(
+	          index,
+	          0,
+	          1,
+	          records,
+	          &error );
+
+	records[ 0 ] = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_index_free(
+	          &index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_fixtures_table_free(
+	          &fixtures_table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libesedb_record_free(
+		 &record,
+		 NULL );
+	}
+	for( record_entry = 0;
+	     record_entry < ESEDB_TEST_FIXTURES_INDEX_NUMBER_OF_RECORDS;
+	     record_entry++ )
+	{
+		if( records[ record_entry ] != NULL )
+		{
+			libesedb_record_free(
+			 &( records[ record_entry ] ),
+			 NULL );
+		}
+	}
+	if( index != NULL )
+	{
+		libesedb_index_free(
+		 &index,
+		 NULL );
+	}
+	if( fixtures_table != NULL )
+	{
+		esedb_test_fixtures_table_free(
+		 &fixtures_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_index_get_record_by_key function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_index_get_record_by_key(
+     void )
+{
+	uint8_t key_data[ 1 ]                       = { 0x04 };
+	uint8_t missing_key_data[ 1 ]               = { 0x02 };
+	esedb_test_fixtures_table_t *fixtures_table = NULL;
+	libcerror_error_t *error                    = NULL;
+	libesedb_index_t *index                     = NULL;
+	libesedb_record_t *record                   = NULL;
+	uint32_t value_32bit                        = 0;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_fixtures_table_initialize(
+	          &fixtures_table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_get_index(
+	          fixtures_table->table,
+	          0,
+	          &index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "index",
+	 index );
+
+	/* Test regular cases
+	 */
+	result = libesedb_index_get_record_by_key(
+	          index,
+	          key_data,
+	          1,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	result = libesedb_record_get_value_32bit(
+	          record,
+	          0,
+	          &value_32bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 4 );
+
+	result = libesedb_record_free(
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_index_get_record_by_key(
+	          index,
+	          missing_key_data,
+	          1,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_index_get_record_by_key(
+	          NULL,
+	          key_data,
+	          1,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_get_record_by_key(
+	          index,
+	          NULL,
+	          1,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_get_record_by_key(
+	          index,
+	          key_data,
+	          1,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_index_free(
+	          &index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_fixtures_table_free(
+	          &fixtures_table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libesedb_record_free(
+		 &record,
+		 NULL );
+	}
+	if( index != NULL )
+	{
+		libesedb_index_free(
+		 &index,
+		 NULL );
+	}
+	if( fixtures_table != NULL )
+	{
+		esedb_test_fixtures_table_free(
+		 &fixtures_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 /* The main program
@@ -114,9 +1306,33 @@ int main(
 
 	/* TODO: add tests for libesedb_index_get_utf16_name */
 
-	/* TODO: add tests for libesedb_index_get_number_of_records */
+	ESEDB_TEST_RUN(
+	 "libesedb_index_get_number_of_records",
+	 esedb_test_index_get_number_of_records );
+
+	/* TODO: add tests for libesedb_index_get_number_of_key_columns */
+
+	/* TODO: add tests for libesedb_index_get_key_column_identifier */
+
+	/* TODO: add tests for libesedb_index_set_column_projection */
+
+	ESEDB_TEST_RUN(
+	 "libesedb_index_get_record",
+	 esedb_test_index_get_record );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_index_sort_keys",
+	 esedb_test_index_sort_keys );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_index_get_records",
+	 esedb_test_index_get_records );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_index_get_record_by_key",
+	 esedb_test_index_get_record_by_key );
 
-	/* TODO: add tests for libesedb_index_get_record */
+	/* TODO: add tests for libesedb_index_get_range_cursor */
 
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
@@ -20,7 +20,9 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -33,7 +35,11 @@
 #include "esedb_test_memory.h"
 #include "esedb_test_unused.h"
 
+#include "../libesedb/libesedb_data_definition.h"
+#include "../libesedb/libesedb_definitions.h"
 #include "../libesedb/libesedb_io_handle.h"
+#include "../libesedb/libesedb_page.h"
+#include "../libesedb/libesedb_page_pool.h"
 
 #if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
 
@@ -48,8 +54,8 @@ int esedb_test_io_handle_initialize(
 	int result                      = 0;
 
 #if defined( HAVE_ESEDB_TEST_MEMORY )
-	int number_of_malloc_fail_tests = 1;
-	int number_of_memset_fail_tests = 1;
+	int number_of_malloc_fail_tests = 2;
+	int number_of_memset_fail_tests = 2;
 	int test_number                 = 0;
 #endif
 
@@ -270,6 +276,1342 @@ on_error:
 	return( 0 );
 }
 
+/* The checksum mismatch callback data
+ */
+typedef struct esedb_test_io_handle_checksum_mismatches esedb_test_io_handle_checksum_mismatches_t;
+
+struct esedb_test_io_handle_checksum_mismatches
+{
+	/* The number of times the callback was called
+	 */
+	int number_of_calls;
+
+	/* The page number of the last call
+	 */
+	uint32_t page_number;
+};
+
+/* Checksum mismatch callback function used by the tests
+ */
+void esedb_test_io_handle_checksum_mismatch_callback(
+     uint32_t page_number,
+     void *callback_data )
+{
+	esedb_test_io_handle_checksum_mismatches_t *checksum_mismatches = NULL;
+
+	checksum_mismatches = (esedb_test_io_handle_checksum_mismatches_t *) callback_data;
+
+	checksum_mismatches->number_of_calls += 1;
+	checksum_mismatches->page_number      = page_number;
+}
+
+/* Tests the libesedb_io_handle_set_page_checksum_mismatch function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_io_handle_set_page_checksum_mismatch(
+     void )
+{
+	esedb_test_io_handle_checksum_mismatches_t checksum_mismatches;
+
+	libcerror_error_t *error        = NULL;
+	libesedb_io_handle_t *io_handle = NULL;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	checksum_mismatches.number_of_calls = 0;
+	checksum_mismatches.page_number     = 0;
+
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->last_page_number                = 8;
+	io_handle->checksum_mismatch_callback      = &esedb_test_io_handle_checksum_mismatch_callback;
+	io_handle->checksum_mismatch_callback_data = &checksum_mismatches;
+
+	/* Test that a page is counted and reported once
+	 */
+	result = libesedb_io_handle_set_page_checksum_mismatch(
+	          io_handle,
+	          3,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_set_page_checksum_mismatch(
+	          io_handle,
+	          3,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "io_handle->number_of_checksum_mismatches",
+	 io_handle->number_of_checksum_mismatches,
+	 (uint32_t) 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "checksum_mismatches.number_of_calls",
+	 checksum_mismatches.number_of_calls,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum_mismatches.page_number",
+	 checksum_mismatches.page_number,
+	 (uint32_t) 3 );
+
+	/* Test that a page beyond the last page number is counted and reported once
+	 */
+	result = libesedb_io_handle_set_page_checksum_mismatch(
+	          io_handle,
+	          20,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_set_page_checksum_mismatch(
+	          io_handle,
+	          20,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_set_page_checksum_mismatch(
+	          io_handle,
+	          3,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "io_handle->number_of_checksum_mismatches",
+	 io_handle->number_of_checksum_mismatches,
+	 (uint32_t) 2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "checksum_mismatches.number_of_calls",
+	 checksum_mismatches.number_of_calls,
+	 2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum_mismatches.page_number",
+	 checksum_mismatches.page_number,
+	 (uint32_t) 20 );
+
+	/* Test error cases
+	 */
+	result = libesedb_io_handle_set_page_checksum_mismatch(
+	          NULL,
+	          3,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_io_handle_queue_page_checksum_verification and
+ * libesedb_io_handle_join_checksum_verification functions
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_io_handle_queue_page_checksum_verification(
+     void )
+{
+	esedb_test_io_handle_checksum_mismatches_t checksum_mismatches;
+	uint8_t page_data[ 4096 ];
+
+	libcerror_error_t *error        = NULL;
+	libesedb_io_handle_t *io_handle = NULL;
+	int page_index                  = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	checksum_mismatches.number_of_calls = 0;
+	checksum_mismatches.page_number     = 0;
+
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->page_size                       = 4096;
+	io_handle->last_page_number                = 8;
+	io_handle->checksum_policy                 = LIBESEDB_CHECKSUM_POLICY_VERIFY_IN_BACKGROUND;
+	io_handle->checksum_mismatch_callback      = &esedb_test_io_handle_checksum_mismatch_callback;
+	io_handle->checksum_mismatch_callback_data = &checksum_mismatches;
+
+	/* The XOR-32 checksum of a page of zero bytes is 0x89abcdef
+	 */
+	result = memory_set(
+	          page_data,
+	          0,
+	          4096 ) != NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test queueing pages 3 and 4, of which the checksum does not match, multiple times
+	 */
+	for( page_index = 0;
+	     page_index < 8;
+	     page_index++ )
+	{
+		result = libesedb_io_handle_queue_page_checksum_verification(
+		          io_handle,
+		          3 + ( page_index % 2 ),
+		          0,
+		          page_data,
+		          4096,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test queueing a page of which the checksum matches
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 page_data,
+	 0x89abcdefUL );
+
+	result = libesedb_io_handle_queue_page_checksum_verification(
+	          io_handle,
+	          2,
+	          0,
+	          page_data,
+	          4096,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_join_checksum_verification(
+	          io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "io_handle->number_of_checksum_mismatches",
+	 io_handle->number_of_checksum_mismatches,
+	 (uint32_t) 2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "checksum_mismatches.number_of_calls",
+	 checksum_mismatches.number_of_calls,
+	 2 );
+
+	/* Test joining when no pages are queued
+	 */
+	result = libesedb_io_handle_join_checksum_verification(
+	          io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_io_handle_queue_page_checksum_verification(
+	          NULL,
+	          1,
+	          0,
+	          page_data,
+	          4096,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_io_handle_queue_page_checksum_verification(
+	          io_handle,
+	          1,
+	          0,
+	          NULL,
+	          4096,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_io_handle_queue_page_checksum_verification(
+	          io_handle,
+	          1,
+	          0,
+	          page_data,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_io_handle_join_checksum_verification(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_io_handle_create_cache and libesedb_io_handle_free_cache functions
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_io_handle_create_cache(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libesedb_io_handle_t *io_handle     = NULL;
+	libfcache_cache_t *first_cache      = NULL;
+	libfcache_cache_t *second_cache     = NULL;
+	int maximum_number_of_cache_entries = 0;
+	int number_of_cache_entries         = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->memory_budget = 1024 * 1024;
+
+	maximum_number_of_cache_entries = (int) ( ( io_handle->memory_budget / 2 ) / ( sizeof( libesedb_data_definition_t ) + LIBESEDB_CACHE_ENTRY_OVERHEAD_SIZE ) );
+
+	/* Test regular cases
+	 */
+	result = libesedb_io_handle_create_cache(
+	          io_handle,
+	          LIBESEDB_CACHE_TYPE_TABLE_VALUES,
+	          &first_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "first_cache",
+	 first_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The first cache gets the half of the budget of the tree values caches
+	 */
+	result = libfcache_cache_get_number_of_entries(
+	          first_cache,
+	          &number_of_cache_entries,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_cache_entries",
+	 number_of_cache_entries,
+	 maximum_number_of_cache_entries );
+
+	result = libesedb_io_handle_create_cache(
+	          io_handle,
+	          LIBESEDB_CACHE_TYPE_INDEX_VALUES,
+	          &second_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "second_cache",
+	 second_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The budget is shared equally by the first and second cache
+	 */
+	result = libfcache_cache_get_number_of_entries(
+	          first_cache,
+	          &number_of_cache_entries,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_cache_entries",
+	 number_of_cache_entries,
+	 maximum_number_of_cache_entries / 2 );
+
+	result = libfcache_cache_get_number_of_entries(
+	          second_cache,
+	          &number_of_cache_entries,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_cache_entries",
+	 number_of_cache_entries,
+	 maximum_number_of_cache_entries / 2 );
+
+	result = libesedb_io_handle_free_cache(
+	          io_handle,
+	          LIBESEDB_CACHE_TYPE_TABLE_VALUES,
+	          &first_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "first_cache",
+	 first_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The second cache gets the budget of the freed first cache
+	 */
+	result = libfcache_cache_get_number_of_entries(
+	          second_cache,
+	          &number_of_cache_entries,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_cache_entries",
+	 number_of_cache_entries,
+	 maximum_number_of_cache_entries );
+
+	result = libesedb_io_handle_free_cache(
+	          io_handle,
+	          LIBESEDB_CACHE_TYPE_INDEX_VALUES,
+	          &second_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "second_cache",
+	 second_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "io_handle->number_of_tree_values_caches",
+	 io_handle->number_of_tree_values_caches,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libesedb_io_handle_create_cache(
+	          NULL,
+	          LIBESEDB_CACHE_TYPE_TABLE_VALUES,
+	          &first_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_io_handle_create_cache(
+	          io_handle,
+	          -1,
+	          &first_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_io_handle_free_cache(
+	          NULL,
+	          LIBESEDB_CACHE_TYPE_TABLE_VALUES,
+	          &first_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_io_handle_free_cache(
+	          io_handle,
+	          LIBESEDB_CACHE_TYPE_TABLE_VALUES,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( second_cache != NULL )
+	{
+		libesedb_io_handle_free_cache(
+		 io_handle,
+		 LIBESEDB_CACHE_TYPE_INDEX_VALUES,
+		 &second_cache,
+		 NULL );
+	}
+	if( first_cache != NULL )
+	{
+		libesedb_io_handle_free_cache(
+		 io_handle,
+		 LIBESEDB_CACHE_TYPE_TABLE_VALUES,
+		 &first_cache,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_io_handle_get_page_is_cached function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_io_handle_get_page_is_cached(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libesedb_io_handle_t *io_handle = NULL;
+	libesedb_page_t *page           = NULL;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_pool_get_page(
+	          io_handle->page_pool,
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page",
+	 page );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	page->page_number = 3;
+
+	/* Test regular cases
+	 */
+	result = libesedb_io_handle_get_page_is_cached(
+	          io_handle,
+	          3,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_pool_set_page_resident(
+	          io_handle->page_pool,
+	          page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_get_page_is_cached(
+	          io_handle,
+	          3,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_get_page_is_cached(
+	          io_handle,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A page is no longer cached after it was released to the page pool
+	 */
+	result = libesedb_page_free(
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_get_page_is_cached(
+	          io_handle,
+	          3,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_io_handle_get_page_is_cached(
+	          NULL,
+	          3,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_io_handle_get_page_is_cached(
+	          io_handle,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( page != NULL )
+	{
+		libesedb_page_free(
+		 &page,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_io_handle_verify_page_range function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_io_handle_verify_page_range(
+     void )
+{
+	uint8_t pages_status[ 8 ];
+
+	libcerror_error_t *error           = NULL;
+	libesedb_io_handle_t *io_handle    = NULL;
+	uint32_t number_of_corrupted_pages = 0;
+	int page_index                     = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->page_size        = 4096;
+	io_handle->last_page_number = 8;
+
+	/* Test error cases
+	 */
+	result = libesedb_io_handle_verify_page_range(
+	          NULL,
+	          NULL,
+	          1,
+	          8,
+	          NULL,
+	          &number_of_corrupted_pages,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_io_handle_verify_page_range(
+	          io_handle,
+	          NULL,
+	          0,
+	          8,
+	          NULL,
+	          &number_of_corrupted_pages,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_io_handle_verify_page_range(
+	          io_handle,
+	          NULL,
+	          5,
+	          4,
+	          NULL,
+	          &number_of_corrupted_pages,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_io_handle_verify_page_range(
+	          io_handle,
+	          NULL,
+	          1,
+	          9,
+	          NULL,
+	          &number_of_corrupted_pages,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_io_handle_verify_page_range(
+	          io_handle,
+	          NULL,
+	          1,
+	          8,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test verify page range when aborted
+	 */
+	for( page_index = 0;
+	     page_index < 8;
+	     page_index++ )
+	{
+		pages_status[ page_index ] = LIBESEDB_PAGE_STATUS_VALID;
+	}
+	io_handle->abort = 1;
+
+	result = libesedb_io_handle_verify_page_range(
+	          io_handle,
+	          NULL,
+	          1,
+	          8,
+	          pages_status,
+	          &number_of_corrupted_pages,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "number_of_corrupted_pages",
+	 number_of_corrupted_pages,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( page_index = 0;
+	     page_index < 8;
+	     page_index++ )
+	{
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "pages_status[ page_index ]",
+		 (int) pages_status[ page_index ],
+		 LIBESEDB_PAGE_STATUS_NOT_VERIFIED );
+	}
+	io_handle->abort = 0;
+
+	/* Clean up
+	 */
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_io_handle_free_verify_pages_workers function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_io_handle_free_verify_pages_workers(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libesedb_verify_pages_worker_t *workers = NULL;
+	int result                              = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_io_handle_free_verify_pages_workers(
+	          &workers,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	workers = (libesedb_verify_pages_worker_t *) memory_allocate(
+	                                              sizeof( libesedb_verify_pages_worker_t ) * 2 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "workers",
+	 workers );
+
+	memory_set(
+	 workers,
+	 0,
+	 sizeof( libesedb_verify_pages_worker_t ) * 2 );
+
+	result = libesedb_io_handle_free_verify_pages_workers(
+	          &workers,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "workers",
+	 workers );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_io_handle_free_verify_pages_workers(
+	          NULL,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( workers != NULL )
+	{
+		memory_free(
+		 workers );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 /* The main program
@@ -299,12 +1641,60 @@ int main(
 
 	/* TODO: add tests for libesedb_io_handle_clear */
 
+	/* TODO: add tests for libesedb_io_handle_get_page_checksum_verified */
+
+	/* TODO: add tests for libesedb_io_handle_set_page_checksum_verified */
+
+	ESEDB_TEST_RUN(
+	 "libesedb_io_handle_set_page_checksum_mismatch",
+	 esedb_test_io_handle_set_page_checksum_mismatch );
+
+	/* TODO: add tests for libesedb_io_handle_verify_page_checksums_callback */
+
+	ESEDB_TEST_RUN(
+	 "libesedb_io_handle_queue_page_checksum_verification",
+	 esedb_test_io_handle_queue_page_checksum_verification );
+
+	/* TODO: add tests for libesedb_io_handle_map_file */
+
+	/* TODO: add tests for libesedb_io_handle_unmap_file */
+
+	/* TODO: add tests for libesedb_io_handle_open_read_ahead */
+
+	/* TODO: add tests for libesedb_io_handle_close_read_ahead */
+
+	/* TODO: add tests for libesedb_io_handle_read_ahead_pages */
+
+	ESEDB_TEST_RUN(
+	 "libesedb_io_handle_create_cache",
+	 esedb_test_io_handle_create_cache );
+
 	/* TODO: add tests for libesedb_io_handle_set_pages_data_range */
 
 	/* TODO: add tests for libesedb_io_handle_read_file_header */
 
 	/* TODO: add tests for libesedb_io_handle_read_page */
 
+	ESEDB_TEST_RUN(
+	 "libesedb_io_handle_get_page_is_cached",
+	 esedb_test_io_handle_get_page_is_cached );
+
+	/* TODO: add tests for libesedb_io_handle_read_pages */
+
+	ESEDB_TEST_RUN(
+	 "libesedb_io_handle_verify_page_range",
+	 esedb_test_io_handle_verify_page_range );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_io_handle_free_verify_pages_workers",
+	 esedb_test_io_handle_free_verify_pages_workers );
+
+	/* TODO: add tests for libesedb_io_handle_verify_pages_worker_callback */
+
+	/* TODO: add tests for libesedb_io_handle_verify_pages_with_workers */
+
+	/* TODO: add tests for libesedb_io_handle_verify_pages */
+
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -20,7 +20,9 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -33,6 +35,8 @@
 #include "esedb_test_memory.h"
 #include "esedb_test_unused.h"
 
+#include "../libesedb/libesedb_definitions.h"
+#include "../libesedb/libesedb_io_handle.h"
 #include "../libesedb/libesedb_page.h"
 
 #if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
@@ -254,6 +258,529 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libesedb_page_verify_data function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_verify_data(
+     void )
+{
+	uint8_t page_data[ 4096 ];
+
+	libcerror_error_t *error        = NULL;
+	libesedb_io_handle_t *io_handle = NULL;
+	uint8_t page_status             = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->page_size = 4096;
+
+	memory_set(
+	 page_data,
+	 0,
+	 4096 );
+
+	/* Test regular cases
+	 */
+	page_status = 0xff;
+
+	result = libesedb_page_verify_data(
+	          io_handle,
+	          1,
+	          page_data,
+	          4096,
+	          &page_status,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "page_status",
+	 page_status,
+	 LIBESEDB_PAGE_STATUS_EMPTY );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a page with a checksum mismatch
+	 */
+	page_data[ 128 ] = 0xff;
+
+	result = libesedb_page_verify_data(
+	          io_handle,
+	          1,
+	          page_data,
+	          4096,
+	          &page_status,
+	          &error );
+
+	page_data[ 128 ] = 0;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "page_status",
+	 page_status,
+	 LIBESEDB_PAGE_STATUS_CHECKSUM_MISMATCH );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_page_verify_data(
+	          NULL,
+	          1,
+	          page_data,
+	          4096,
+	          &page_status,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_verify_data(
+	          io_handle,
+	          1,
+	          NULL,
+	          4096,
+	          &page_status,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_verify_data(
+	          io_handle,
+	          1,
+	          page_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &page_status,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_verify_data(
+	          io_handle,
+	          1,
+	          page_data,
+	          4096,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The extended page header test data, initialized by esedb_test_page_initialize_extended_page_data
+ */
+uint8_t esedb_test_page_extended_page_data[ 32768 ];
+
+/* The XOR-32 and ECC-32 checksums of the 4 blocks of page 5 of the extended page header test data
+ * of 16 KiB, calculated with a reference implementation of the ESE ECC-32 and XOR-32 checksums
+ */
+uint32_t esedb_test_page_extended_page_checksums_16k[ 8 ] = {
+	0xda8e1977UL, 0x46114611UL, 0xb72e23e9UL, 0x01490149UL, 0x1296ea63UL, 0x26d4592bUL, 0x2966918fUL, 0x296f5690UL };
+
+/* The XOR-32 and ECC-32 checksums of the 4 blocks of page 5 of the extended page header test data
+ * of 32 KiB, calculated with a reference implementation of the ESE ECC-32 and XOR-32 checksums
+ */
+uint32_t esedb_test_page_extended_page_checksums_32k[ 8 ] = {
+	0xd84ced30UL, 0xb92846d7UL, 0x3bf07be9UL, 0x8fbb8fbbUL, 0xa41725daUL, 0xc22a3dd5UL, 0xd4955c22UL, 0x31233123UL };
+
+/* Initializes the extended page header test data with pseudo random values
+ * and the checksums of the blocks of the page
+ */
+void esedb_test_page_initialize_extended_page_data(
+     size_t page_size,
+     const uint32_t *checksums )
+{
+	size_t data_offset  = 0;
+	uint32_t seed       = 0x12345678UL;
+	uint8_t block_index = 0;
+
+	for( data_offset = 0;
+	     data_offset < page_size;
+	     data_offset++ )
+	{
+		seed = ( seed * 1103515245UL ) + 12345UL;
+
+		esedb_test_page_extended_page_data[ data_offset ] = (uint8_t) ( seed >> 16 );
+	}
+	/* The checksums of the first block are stored at the start of the page header
+	 * and those of the other blocks in the extended page header
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 &( esedb_test_page_extended_page_data[ 0 ] ),
+	 checksums[ 0 ] );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( esedb_test_page_extended_page_data[ 4 ] ),
+	 checksums[ 1 ] );
+
+	for( block_index = 1;
+	     block_index < 4;
+	     block_index++ )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 &( esedb_test_page_extended_page_data[ 40 + ( ( block_index - 1 ) * 8 ) ] ),
+		 checksums[ block_index * 2 ] );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( esedb_test_page_extended_page_data[ 40 + ( ( block_index - 1 ) * 8 ) + 4 ] ),
+		 checksums[ ( block_index * 2 ) + 1 ] );
+	}
+}
+
+/* Tests the libesedb_page_verify_checksums function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_verify_checksums(
+     void )
+{
+	const uint32_t *checksums       = NULL;
+	libcerror_error_t *error        = NULL;
+	libesedb_io_handle_t *io_handle = NULL;
+	size_t block_offset             = 0;
+	size_t page_size                = 0;
+	uint8_t block_index             = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->format_revision = LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER;
+
+	for( page_size = 16384;
+	     page_size <= 32768;
+	     page_size *= 2 )
+	{
+		if( page_size == 16384 )
+		{
+			checksums = esedb_test_page_extended_page_checksums_16k;
+		}
+		else
+		{
+			checksums = esedb_test_page_extended_page_checksums_32k;
+		}
+		io_handle->page_size = (uint32_t) page_size;
+
+		esedb_test_page_initialize_extended_page_data(
+		 page_size,
+		 checksums );
+
+		/* Test regular cases
+		 */
+		result = libesedb_page_verify_checksums(
+		          io_handle,
+		          5,
+		          0,
+		          esedb_test_page_extended_page_data,
+		          page_size,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test a page number that differs from the one used as XOR-32 initial value
+		 */
+		result = libesedb_page_verify_checksums(
+		          io_handle,
+		          6,
+		          0,
+		          esedb_test_page_extended_page_data,
+		          page_size,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test a single-bit error in each of the blocks
+		 */
+		for( block_index = 0;
+		     block_index < 4;
+		     block_index++ )
+		{
+			block_offset = ( block_index * ( page_size / 4 ) ) + 128;
+
+			esedb_test_page_extended_page_data[ block_offset ] ^= 0x01;
+
+			result = libesedb_page_verify_checksums(
+			          io_handle,
+			          5,
+			          0,
+			          esedb_test_page_extended_page_data,
+			          page_size,
+			          &error );
+
+			esedb_test_page_extended_page_data[ block_offset ] ^= 0x01;
+
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		/* Test a mismatch in the stored checksums of each of the blocks
+		 */
+		for( block_index = 0;
+		     block_index < 4;
+		     block_index++ )
+		{
+			if( block_index == 0 )
+			{
+				block_offset = 4;
+			}
+			else
+			{
+				block_offset = 40 + ( ( block_index - 1 ) * 8 ) + 4;
+			}
+			esedb_test_page_extended_page_data[ block_offset ] ^= 0x01;
+
+			result = libesedb_page_verify_checksums(
+			          io_handle,
+			          5,
+			          0,
+			          esedb_test_page_extended_page_data,
+			          page_size,
+			          &error );
+
+			esedb_test_page_extended_page_data[ block_offset ] ^= 0x01;
+
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+	}
+	/* Test error cases
+	 */
+	result = libesedb_page_verify_checksums(
+	          NULL,
+	          5,
+	          0,
+	          esedb_test_page_extended_page_data,
+	          32768,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_verify_checksums(
+	          io_handle,
+	          5,
+	          0,
+	          NULL,
+	          32768,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a page that is too small to contain the extended page header
+	 */
+	result = libesedb_page_verify_checksums(
+	          io_handle,
+	          5,
+	          0,
+	          esedb_test_page_extended_page_data,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 /* The main program
@@ -281,6 +808,14 @@ int main(
 	 "libesedb_page_free",
 	 esedb_test_page_free );
 
+	ESEDB_TEST_RUN(
+	 "libesedb_page_verify_checksums",
+	 esedb_test_page_verify_checksums );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_verify_data",
+	 esedb_test_page_verify_data );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
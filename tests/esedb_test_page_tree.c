@@ -20,7 +20,9 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -29,12 +31,19 @@
 
 #include "esedb_test_libcerror.h"
 #include "esedb_test_libesedb.h"
+#include "esedb_test_libfdata.h"
 #include "esedb_test_macros.h"
 #include "esedb_test_memory.h"
 #include "esedb_test_unused.h"
 
+#include "../libesedb/libesedb_definitions.h"
+#include "../libesedb/libesedb_io_handle.h"
+#include "../libesedb/libesedb_key.h"
+#include "../libesedb/libesedb_page.h"
 #include "../libesedb/libesedb_page_tree.h"
 
+#include "../libesedb/esedb_page.h"
+
 #if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
 
 /* Tests the libesedb_page_tree_free function
@@ -75,6 +84,414 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libesedb_page_tree_compare_page_value_key function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_tree_compare_page_value_key(
+     void )
+{
+	uint8_t page_data[ 4096 ];
+
+	/* The page values data contains the common key: "ab" in the page header value,
+	 * a page value with key: "ab" + "c" that uses the common key,
+	 * a page value with key: "ad" and a defunct page value with key: "z"
+	 */
+	uint8_t page_values_data[ 26 ] = {
+		'a', 'b',
+		0x02, 0x00, 0x01, 0x00, 'c', 0x01, 0x02, 0x03, 0x04,
+		0x02, 0x00, 'a', 'd', 0x01, 0x02, 0x03, 0x04,
+		0x01, 0x00, 'z', 0x01, 0x02, 0x03, 0x04 };
+
+	uint16_t page_value_offsets[ 4 ]      = { 0, 2, 11, 19 };
+	uint16_t page_value_sizes[ 4 ]        = { 2, 9, 8, 7 };
+	uint8_t page_value_tag_flags[ 4 ]     = { 0, LIBESEDB_PAGE_TAG_FLAG_HAS_COMMON_KEY_SIZE, 0, LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT };
+
+	const char *search_keys[ 6 ]          = { "abc", "abb", "abd", "ab", "abcd", "" };
+	size_t search_key_sizes[ 6 ]          = { 3, 3, 3, 2, 4, 0 };
+	int page_value_compare_results[ 6 ]   = { LIBFDATA_COMPARE_EQUAL, LIBFDATA_COMPARE_GREATER, LIBFDATA_COMPARE_LESS, LIBFDATA_COMPARE_GREATER, LIBFDATA_COMPARE_LESS, LIBFDATA_COMPARE_GREATER };
+
+	libcerror_error_t *error              = NULL;
+	libesedb_io_handle_t *io_handle       = NULL;
+	libesedb_key_t *key                   = NULL;
+	libesedb_page_t *page                 = NULL;
+	uint8_t *page_tag_data                = NULL;
+	uint16_t page_value_index             = 0;
+	int compare_result                    = 0;
+	int result                            = 0;
+	int search_key_index                  = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 page_data,
+	 0,
+	 4096 );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 ( (esedb_page_header_t *) page_data )->available_page_tag,
+	 4 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_page_header_t *) page_data )->page_flags,
+	 LIBESEDB_PAGE_FLAG_IS_LEAF );
+
+	memory_copy(
+	 &( page_data[ sizeof( esedb_page_header_t ) ] ),
+	 page_values_data,
+	 26 );
+
+	/* The page tags are stored back to front
+	 */
+	page_tag_data = &( page_data[ 4096 ] );
+
+	for( page_value_index = 0;
+	     page_value_index < 4;
+	     page_value_index++ )
+	{
+		page_tag_data -= 4;
+
+		byte_stream_copy_from_uint16_little_endian(
+		 page_tag_data,
+		 page_value_sizes[ page_value_index ] );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 &( page_tag_data[ 2 ] ),
+		 page_value_offsets[ page_value_index ] | ( (uint16_t) page_value_tag_flags[ page_value_index ] << 13 ) );
+	}
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->page_size = 4096;
+
+	result = libesedb_page_initialize(
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page",
+	 page );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_read_buffer(
+	          page,
+	          io_handle,
+	          8192,
+	          page_data,
+	          4096,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_key_initialize(
+	          &key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "key",
+	 key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The key of the page value that uses the common key is compared with an equal key,
+	 * a lesser key, a greater key, a shorter key, a longer key and an empty key
+	 */
+	for( search_key_index = 0;
+	     search_key_index < 6;
+	     search_key_index++ )
+	{
+		result = libesedb_key_set_data(
+		          key,
+		          (uint8_t *) search_keys[ search_key_index ],
+		          search_key_sizes[ search_key_index ],
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		compare_result = -1;
+
+		result = libesedb_page_tree_compare_page_value_key(
+		          page,
+		          1,
+		          key,
+		          &compare_result,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "compare_result",
+		 compare_result,
+		 page_value_compare_results[ search_key_index ] );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test a page value without common key
+	 */
+	result = libesedb_key_set_data(
+	          key,
+	          (uint8_t *) "ac",
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	compare_result = -1;
+
+	result = libesedb_page_tree_compare_page_value_key(
+	          page,
+	          2,
+	          key,
+	          &compare_result,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "compare_result",
+	 compare_result,
+	 LIBFDATA_COMPARE_GREATER );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a defunct page value
+	 */
+	result = libesedb_page_tree_compare_page_value_key(
+	          page,
+	          3,
+	          key,
+	          &compare_result,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_page_tree_compare_page_value_key(
+	          NULL,
+	          1,
+	          key,
+	          &compare_result,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_compare_page_value_key(
+	          page,
+	          4,
+	          key,
+	          &compare_result,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_compare_page_value_key(
+	          page,
+	          1,
+	          NULL,
+	          &compare_result,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_compare_page_value_key(
+	          page,
+	          1,
+	          key,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_key_free(
+	          &key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "key",
+	 key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_free(
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "page",
+	 page );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( key != NULL )
+	{
+		libesedb_key_free(
+		 &key,
+		 NULL );
+	}
+	if( page != NULL )
+	{
+		libesedb_page_free(
+		 &page,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 /* The main program
@@ -110,6 +527,16 @@ int main(
 
 	/* TODO: add tests for libesedb_page_tree_read_leaf_value */
 
+	/* TODO: add tests for libesedb_page_tree_get_page_by_number */
+
+	/* TODO: add tests for libesedb_page_tree_get_page_value_key */
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_tree_compare_page_value_key",
+	 esedb_test_page_tree_compare_page_value_key );
+
+	/* TODO: add tests for libesedb_page_tree_get_child_page_number */
+
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -0,0 +1,2855 @@
+/*
+ * Library page_tree_cursor type testing program
+ *
+ * Copyright (C) 2009-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_test_fixtures.h"
+#include "esedb_test_libbfio.h"
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_libfdata.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_memory.h"
+#include "esedb_test_unused.h"
+
+#include "../libesedb/libesedb_data_definition.h"
+#include "../libesedb/libesedb_definitions.h"
+#include "../libesedb/libesedb_io_handle.h"
+#include "../libesedb/libesedb_key.h"
+#include "../libesedb/libesedb_page.h"
+#include "../libesedb/libesedb_page_tree.h"
+#include "../libesedb/libesedb_page_tree_cursor.h"
+
+#include "../libesedb/esedb_page.h"
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* The keys of the root branch page, the key of the last page value is empty
+ */
+uint8_t esedb_test_page_tree_cursor_branch_page_keys[ 2 ] = {
+	'c', 0 };
+
+uint32_t esedb_test_page_tree_cursor_branch_page_values[ 2 ] = {
+	2, 3 };
+
+uint8_t esedb_test_page_tree_cursor_branch_page_tag_flags[ 2 ] = {
+	0, 0 };
+
+/* The keys of the first leaf page, the page value with key 'b' is defunct
+ */
+uint8_t esedb_test_page_tree_cursor_first_leaf_page_keys[ 3 ] = {
+	'a', 'b', 'c' };
+
+uint8_t esedb_test_page_tree_cursor_first_leaf_page_tag_flags[ 3 ] = {
+	0, LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT, 0 };
+
+/* The keys of the last leaf page
+ */
+uint8_t esedb_test_page_tree_cursor_last_leaf_page_keys[ 2 ] = {
+	'e', 'g' };
+
+uint8_t esedb_test_page_tree_cursor_last_leaf_page_tag_flags[ 2 ] = {
+	0, 0 };
+
+/* The keys of a leaf page, the page value with key 'z' is defunct and out of order
+ */
+uint8_t esedb_test_page_tree_cursor_leaf_page_keys[ 5 ] = {
+	'b', 'd', 'z', 'f', 'h' };
+
+uint8_t esedb_test_page_tree_cursor_leaf_page_tag_flags[ 5 ] = {
+	0, 0, LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT, 0, 0 };
+
+/* The test file data, initialized by esedb_test_page_tree_cursor_initialize_file_data
+ */
+uint8_t esedb_test_page_tree_cursor_file_data[ 20480 ];
+
+/* Writes the data of a page of 4096 bytes for testing
+ * Every page value has a key of a single byte, where a key of 0 is stored as an empty key,
+ * followed by 4 bytes of value data, which contain the child page number in a branch page
+ */
+void esedb_test_page_tree_cursor_write_page(
+     uint8_t *page_data,
+     uint32_t page_flags,
+     uint32_t previous_page_number,
+     uint32_t next_page_number,
+     const uint8_t *keys,
+     const uint32_t *values,
+     const uint8_t *page_tag_flags,
+     uint16_t number_of_keys )
+{
+	uint8_t *page_tag_data   = NULL;
+	uint8_t *page_value_data = NULL;
+	uint16_t key_index       = 0;
+	uint16_t key_size        = 0;
+	uint16_t value_offset    = 0;
+	uint16_t value_size      = 0;
+	uint32_t value           = 0;
+
+	memory_set(
+	 page_data,
+	 0,
+	 4096 );
+
+	/* The checksum is left 0 so that it is not verified
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_page_header_t *) page_data )->previous_page,
+	 previous_page_number );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_page_header_t *) page_data )->next_page,
+	 next_page_number );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 ( (esedb_page_header_t *) page_data )->available_page_tag,
+	 number_of_keys + 1 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_page_header_t *) page_data )->page_flags,
+	 page_flags );
+
+	/* The page tags are stored back to front, the first page tag
+	 * contains an empty page header value
+	 */
+	page_tag_data = &( page_data[ 4096 - 4 ] );
+
+	for( key_index = 0;
+	     key_index < number_of_keys;
+	     key_index++ )
+	{
+		page_value_data = &( page_data[ sizeof( esedb_page_header_t ) + value_offset ] );
+
+		if( keys[ key_index ] == 0 )
+		{
+			key_size = 0;
+		}
+		else
+		{
+			key_size = 1;
+		}
+		if( values != NULL )
+		{
+			value = values[ key_index ];
+		}
+		byte_stream_copy_from_uint16_little_endian(
+		 page_value_data,
+		 key_size );
+
+		page_value_data[ 2 ] = keys[ key_index ];
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( page_value_data[ 2 + key_size ] ),
+		 value );
+
+		value_size = 2 + key_size + 4;
+
+		page_tag_data -= 4;
+
+		byte_stream_copy_from_uint16_little_endian(
+		 page_tag_data,
+		 value_size );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 &( page_tag_data[ 2 ] ),
+		 value_offset | ( (uint16_t) page_tag_flags[ key_index ] << 13 ) );
+
+		value_offset += value_size;
+	}
+}
+
+/* Initializes the test file data
+ * The file data contains a root branch page 1 that references leaf pages 2 and 3
+ */
+void esedb_test_page_tree_cursor_initialize_file_data(
+     void )
+{
+	/* The file header and its backup
+	 */
+	memory_set(
+	 esedb_test_page_tree_cursor_file_data,
+	 0,
+	 8192 );
+
+	esedb_test_page_tree_cursor_write_page(
+	 &( esedb_test_page_tree_cursor_file_data[ 8192 ] ),
+	 LIBESEDB_PAGE_FLAG_IS_ROOT | LIBESEDB_PAGE_FLAG_IS_PARENT,
+	 0,
+	 0,
+	 esedb_test_page_tree_cursor_branch_page_keys,
+	 esedb_test_page_tree_cursor_branch_page_values,
+	 esedb_test_page_tree_cursor_branch_page_tag_flags,
+	 2 );
+
+	esedb_test_page_tree_cursor_write_page(
+	 &( esedb_test_page_tree_cursor_file_data[ 12288 ] ),
+	 LIBESEDB_PAGE_FLAG_IS_LEAF,
+	 0,
+	 3,
+	 esedb_test_page_tree_cursor_first_leaf_page_keys,
+	 NULL,
+	 esedb_test_page_tree_cursor_first_leaf_page_tag_flags,
+	 3 );
+
+	esedb_test_page_tree_cursor_write_page(
+	 &( esedb_test_page_tree_cursor_file_data[ 16384 ] ),
+	 LIBESEDB_PAGE_FLAG_IS_LEAF,
+	 2,
+	 0,
+	 esedb_test_page_tree_cursor_last_leaf_page_keys,
+	 NULL,
+	 esedb_test_page_tree_cursor_last_leaf_page_tag_flags,
+	 2 );
+}
+
+/* Closes a page tree of the test file data
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_page_tree_cursor_close_page_tree(
+     libesedb_io_handle_t **io_handle,
+     libbfio_handle_t **file_io_handle,
+     libfdata_vector_t **pages_vector,
+     libfcache_cache_t **pages_cache,
+     libesedb_page_tree_t **page_tree,
+     libcerror_error_t **error )
+{
+	int result = 1;
+
+	if( *page_tree != NULL )
+	{
+		if( libesedb_page_tree_free(
+		     page_tree,
+		     error ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( esedb_test_fixtures_close_pages(
+	     io_handle,
+	     file_io_handle,
+	     pages_vector,
+	     pages_cache,
+	     error ) != 1 )
+	{
+		result = -1;
+	}
+	return( result );
+}
+
+/* Opens a page tree of the test file data
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_page_tree_cursor_open_page_tree(
+     libesedb_io_handle_t **io_handle,
+     libbfio_handle_t **file_io_handle,
+     libfdata_vector_t **pages_vector,
+     libfcache_cache_t **pages_cache,
+     libesedb_page_tree_t **page_tree,
+     libcerror_error_t **error )
+{
+	esedb_test_page_tree_cursor_initialize_file_data();
+
+	if( esedb_test_fixtures_open_pages(
+	     esedb_test_page_tree_cursor_file_data,
+	     20480,
+	     io_handle,
+	     file_io_handle,
+	     pages_vector,
+	     pages_cache,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libesedb_page_tree_initialize(
+	     page_tree,
+	     *io_handle,
+	     *pages_vector,
+	     *pages_cache,
+	     0,
+	     NULL,
+	     NULL,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	esedb_test_page_tree_cursor_close_page_tree(
+	 io_handle,
+	 file_io_handle,
+	 pages_vector,
+	 pages_cache,
+	 page_tree,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Tests the libesedb_page_tree_cursor_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_tree_cursor_initialize(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libesedb_io_handle_t *io_handle               = NULL;
+	libesedb_page_tree_t *page_tree               = NULL;
+	libesedb_page_tree_cursor_t *page_tree_cursor = NULL;
+	int result                                    = 0;
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests               = 1;
+	int number_of_memset_fail_tests               = 1;
+	int test_number                               = 0;
+#endif
+
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_initialize(
+	          &page_tree,
+	          io_handle,
+	          NULL,
+	          NULL,
+	          0,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page_tree",
+	 page_tree );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_page_tree_cursor_initialize(
+	          &page_tree_cursor,
+	          page_tree,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page_tree_cursor",
+	 page_tree_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_free(
+	          &page_tree_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "page_tree_cursor",
+	 page_tree_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_page_tree_cursor_initialize(
+	          NULL,
+	          page_tree,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	page_tree_cursor = (libesedb_page_tree_cursor_t *) 0x12345678UL;
+
+	result = libesedb_page_tree_cursor_initialize(
+	          &page_tree_cursor,
+	          page_tree,
+	          1,
+	          &error );
+
+	page_tree_cursor = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_cursor_initialize(
+	          &page_tree_cursor,
+	          NULL,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libesedb_page_tree_cursor_initialize with malloc failing
+		 */
+		esedb_test_malloc_attempts_before_fail = test_number;
+
+		result = libesedb_page_tree_cursor_initialize(
+		          &page_tree_cursor,
+		          page_tree,
+		          1,
+		          &error );
+
+		if( esedb_test_malloc_attempts_before_fail != -1 )
+		{
+			esedb_test_malloc_attempts_before_fail = -1;
+
+			if( page_tree_cursor != NULL )
+			{
+				libesedb_page_tree_cursor_free(
+				 &page_tree_cursor,
+				 NULL );
+			}
+		}
+		else
+		{
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "page_tree_cursor",
+			 page_tree_cursor );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libesedb_page_tree_cursor_initialize with memset failing
+		 */
+		esedb_test_memset_attempts_before_fail = test_number;
+
+		result = libesedb_page_tree_cursor_initialize(
+		          &page_tree_cursor,
+		          page_tree,
+		          1,
+		          &error );
+
+		if( esedb_test_memset_attempts_before_fail != -1 )
+		{
+			esedb_test_memset_attempts_before_fail = -1;
+
+			if( page_tree_cursor != NULL )
+			{
+				libesedb_page_tree_cursor_free(
+				 &page_tree_cursor,
+				 NULL );
+			}
+		}
+		else
+		{
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "page_tree_cursor",
+			 page_tree_cursor );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_ESEDB_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libesedb_page_tree_free(
+	          &page_tree,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "page_tree",
+	 page_tree );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( page_tree_cursor != NULL )
+	{
+		libesedb_page_tree_cursor_free(
+		 &page_tree_cursor,
+		 NULL );
+	}
+	if( page_tree != NULL )
+	{
+		libesedb_page_tree_free(
+		 &page_tree,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_page_tree_cursor_free function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_tree_cursor_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_page_tree_cursor_free(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_page_tree_cursor_get_outer_leaf_page_number function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_tree_cursor_get_outer_leaf_page_number(
+     void )
+{
+	libbfio_handle_t *file_io_handle              = NULL;
+	libcerror_error_t *error                      = NULL;
+	libesedb_io_handle_t *io_handle               = NULL;
+	libesedb_page_tree_t *page_tree               = NULL;
+	libesedb_page_tree_cursor_t *page_tree_cursor = NULL;
+	libfcache_cache_t *pages_cache                = NULL;
+	libfdata_vector_t *pages_vector               = NULL;
+	uint32_t leaf_page_number                     = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_page_tree_cursor_open_page_tree(
+	          &io_handle,
+	          &file_io_handle,
+	          &pages_vector,
+	          &pages_cache,
+	          &page_tree,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_initialize(
+	          &page_tree_cursor,
+	          page_tree,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page_tree_cursor",
+	 page_tree_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_page_tree_cursor_get_outer_leaf_page_number(
+	          page_tree_cursor,
+	          file_io_handle,
+	          0,
+	          &leaf_page_number,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "leaf_page_number",
+	 leaf_page_number,
+	 2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "page_tree_cursor->parent_page_number",
+	 page_tree_cursor->parent_page_number,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_get_outer_leaf_page_number(
+	          page_tree_cursor,
+	          file_io_handle,
+	          1,
+	          &leaf_page_number,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "leaf_page_number",
+	 leaf_page_number,
+	 3 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "page_tree_cursor->parent_page_number",
+	 page_tree_cursor->parent_page_number,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_page_tree_cursor_get_outer_leaf_page_number(
+	          NULL,
+	          file_io_handle,
+	          0,
+	          &leaf_page_number,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_cursor_get_outer_leaf_page_number(
+	          page_tree_cursor,
+	          file_io_handle,
+	          0,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_page_tree_cursor_free(
+	          &page_tree_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "page_tree_cursor",
+	 page_tree_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_page_tree_cursor_close_page_tree(
+	          &io_handle,
+	          &file_io_handle,
+	          &pages_vector,
+	          &pages_cache,
+	          &page_tree,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( page_tree_cursor != NULL )
+	{
+		libesedb_page_tree_cursor_free(
+		 &page_tree_cursor,
+		 NULL );
+	}
+	esedb_test_page_tree_cursor_close_page_tree(
+	 &io_handle,
+	 &file_io_handle,
+	 &pages_vector,
+	 &pages_cache,
+	 &page_tree,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libesedb_page_tree_cursor_get_lower_bound_page_value_index function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_tree_cursor_get_lower_bound_page_value_index(
+     void )
+{
+	uint8_t page_data[ 4096 ];
+
+	uint8_t branch_page_search_keys[ 4 ] = { 'b', 'c', 'd', 'z' };
+	uint8_t leaf_page_search_keys[ 6 ]   = { 'a', 'b', 'd', 'g', 'h', 'i' };
+	int branch_page_value_indexes[ 4 ]   = { 1, 1, 2, 2 };
+	int leaf_page_value_indexes[ 6 ]     = { 1, 1, 2, 5, 5, 6 };
+
+	libcerror_error_t *error        = NULL;
+	libesedb_io_handle_t *io_handle = NULL;
+	libesedb_key_t *key             = NULL;
+	libesedb_page_t *branch_page    = NULL;
+	libesedb_page_t *leaf_page      = NULL;
+	int page_value_index            = 0;
+	int result                      = 0;
+	int search_key_index            = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->page_size = 4096;
+
+	esedb_test_page_tree_cursor_write_page(
+	 page_data,
+	 LIBESEDB_PAGE_FLAG_IS_LEAF,
+	 0,
+	 0,
+	 esedb_test_page_tree_cursor_leaf_page_keys,
+	 NULL,
+	 esedb_test_page_tree_cursor_leaf_page_tag_flags,
+	 5 );
+
+	result = libesedb_page_initialize(
+	          &leaf_page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "leaf_page",
+	 leaf_page );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_read_buffer(
+	          leaf_page,
+	          io_handle,
+	          8192,
+	          page_data,
+	          4096,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	esedb_test_page_tree_cursor_write_page(
+	 page_data,
+	 LIBESEDB_PAGE_FLAG_IS_ROOT | LIBESEDB_PAGE_FLAG_IS_PARENT,
+	 0,
+	 0,
+	 esedb_test_page_tree_cursor_branch_page_keys,
+	 esedb_test_page_tree_cursor_branch_page_values,
+	 esedb_test_page_tree_cursor_branch_page_tag_flags,
+	 2 );
+
+	result = libesedb_page_initialize(
+	          &branch_page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "branch_page",
+	 branch_page );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_read_buffer(
+	          branch_page,
+	          io_handle,
+	          8192,
+	          page_data,
+	          4096,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_key_initialize(
+	          &key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "key",
+	 key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The search keys of the leaf page are less than all keys, an exact match of the first key,
+	 * an exact match, a key after the defunct page value, an exact match of the last key
+	 * and greater than all keys
+	 */
+	for( search_key_index = 0;
+	     search_key_index < 6;
+	     search_key_index++ )
+	{
+		result = libesedb_key_set_data(
+		          key,
+		          &( leaf_page_search_keys[ search_key_index ] ),
+		          1,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		page_value_index = -1;
+
+		result = libesedb_page_tree_cursor_get_lower_bound_page_value_index(
+		          leaf_page,
+		          key,
+		          6,
+		          &page_value_index,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "page_value_index",
+		 page_value_index,
+		 leaf_page_value_indexes[ search_key_index ] );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* The last page value of the branch page has an empty key which is greater than all keys
+	 */
+	for( search_key_index = 0;
+	     search_key_index < 4;
+	     search_key_index++ )
+	{
+		result = libesedb_key_set_data(
+		          key,
+		          &( branch_page_search_keys[ search_key_index ] ),
+		          1,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		page_value_index = -1;
+
+		result = libesedb_page_tree_cursor_get_lower_bound_page_value_index(
+		          branch_page,
+		          key,
+		          3,
+		          &page_value_index,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "page_value_index",
+		 page_value_index,
+		 branch_page_value_indexes[ search_key_index ] );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test a page without page values other than the page header
+	 */
+	page_value_index = -1;
+
+	result = libesedb_page_tree_cursor_get_lower_bound_page_value_index(
+	          leaf_page,
+	          key,
+	          1,
+	          &page_value_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page_value_index",
+	 page_value_index,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_page_tree_cursor_get_lower_bound_page_value_index(
+	          NULL,
+	          key,
+	          6,
+	          &page_value_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_cursor_get_lower_bound_page_value_index(
+	          leaf_page,
+	          NULL,
+	          6,
+	          &page_value_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_cursor_get_lower_bound_page_value_index(
+	          leaf_page,
+	          key,
+	          6,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a number of page values that exceeds the page values of the page
+	 */
+	result = libesedb_page_tree_cursor_get_lower_bound_page_value_index(
+	          leaf_page,
+	          key,
+	          8,
+	          &page_value_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_key_free(
+	          &key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "key",
+	 key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_free(
+	          &branch_page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "branch_page",
+	 branch_page );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_free(
+	          &leaf_page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "leaf_page",
+	 leaf_page );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( key != NULL )
+	{
+		libesedb_key_free(
+		 &key,
+		 NULL );
+	}
+	if( branch_page != NULL )
+	{
+		libesedb_page_free(
+		 &branch_page,
+		 NULL );
+	}
+	if( leaf_page != NULL )
+	{
+		libesedb_page_free(
+		 &leaf_page,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_page_tree_cursor_seek function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_tree_cursor_seek(
+     void )
+{
+	uint8_t expected_keys[ 3 ]          = { 'a', 'c', 'e' };
+	uint8_t seek_keys[ 4 ]              = { 'a', 'b', 'd', 'z' };
+	uint32_t expected_page_numbers[ 3 ] = { 2, 2, 3 };
+
+	libbfio_handle_t *file_io_handle              = NULL;
+	libcerror_error_t *error                      = NULL;
+	libesedb_data_definition_t *data_definition   = NULL;
+	libesedb_io_handle_t *io_handle               = NULL;
+	libesedb_key_t *key                           = NULL;
+	libesedb_page_tree_t *page_tree               = NULL;
+	libesedb_page_tree_cursor_t *page_tree_cursor = NULL;
+	libfcache_cache_t *pages_cache                = NULL;
+	libfdata_vector_t *pages_vector               = NULL;
+	int result                                    = 0;
+	int seek_key_index                            = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_page_tree_cursor_open_page_tree(
+	          &io_handle,
+	          &file_io_handle,
+	          &pages_vector,
+	          &pages_cache,
+	          &page_tree,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_initialize(
+	          &page_tree_cursor,
+	          page_tree,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page_tree_cursor",
+	 page_tree_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_key_initialize(
+	          &key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "key",
+	 key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_data_definition_initialize(
+	          &data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "data_definition",
+	 data_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The cursor is positioned before the lower bound, hence the next value is the first
+	 * value with a key that is greater than or equal to the seek key, defunct values are
+	 * skipped and a seek key greater than all keys positions the cursor after the last value
+	 */
+	for( seek_key_index = 0;
+	     seek_key_index < 3;
+	     seek_key_index++ )
+	{
+		result = libesedb_key_set_data(
+		          key,
+		          &( seek_keys[ seek_key_index ] ),
+		          1,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_page_tree_cursor_seek(
+		          page_tree_cursor,
+		          file_io_handle,
+		          key,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_page_tree_cursor_get_next_value(
+		          page_tree_cursor,
+		          file_io_handle,
+		          key,
+		          data_definition,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ESEDB_TEST_ASSERT_EQUAL_SIZE(
+		 "key->data_size",
+		 key->data_size,
+		 (size_t) 1 );
+
+		ESEDB_TEST_ASSERT_EQUAL_UINT8(
+		 "key->data[ 0 ]",
+		 key->data[ 0 ],
+		 expected_keys[ seek_key_index ] );
+
+		ESEDB_TEST_ASSERT_EQUAL_UINT32(
+		 "data_definition->page_number",
+		 data_definition->page_number,
+		 expected_page_numbers[ seek_key_index ] );
+	}
+	result = libesedb_key_set_data(
+	          key,
+	          &( seek_keys[ 3 ] ),
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_seek(
+	          page_tree_cursor,
+	          file_io_handle,
+	          key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "page_tree_cursor->page_number",
+	 page_tree_cursor->page_number,
+	 3 );
+
+	result = libesedb_page_tree_cursor_get_next_value(
+	          page_tree_cursor,
+	          file_io_handle,
+	          key,
+	          data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_page_tree_cursor_seek(
+	          NULL,
+	          file_io_handle,
+	          key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_cursor_seek(
+	          page_tree_cursor,
+	          file_io_handle,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_data_definition_free(
+	          &data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "data_definition",
+	 data_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_key_free(
+	          &key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "key",
+	 key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_free(
+	          &page_tree_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "page_tree_cursor",
+	 page_tree_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_page_tree_cursor_close_page_tree(
+	          &io_handle,
+	          &file_io_handle,
+	          &pages_vector,
+	          &pages_cache,
+	          &page_tree,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &data_definition,
+		 NULL );
+	}
+	if( key != NULL )
+	{
+		libesedb_key_free(
+		 &key,
+		 NULL );
+	}
+	if( page_tree_cursor != NULL )
+	{
+		libesedb_page_tree_cursor_free(
+		 &page_tree_cursor,
+		 NULL );
+	}
+	esedb_test_page_tree_cursor_close_page_tree(
+	 &io_handle,
+	 &file_io_handle,
+	 &pages_vector,
+	 &pages_cache,
+	 &page_tree,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libesedb_page_tree_cursor_seek_forward function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_tree_cursor_seek_forward(
+     void )
+{
+	uint8_t expected_keys[ 4 ]          = { 'a', 'c', 'g', 'a' };
+	uint8_t seek_keys[ 4 ]              = { 'a', 'c', 'f', 'a' };
+	uint32_t expected_page_numbers[ 4 ] = { 2, 2, 3, 2 };
+	uint8_t sibling_seek_key            = 'e';
+
+	libbfio_handle_t *file_io_handle              = NULL;
+	libcerror_error_t *error                      = NULL;
+	libesedb_data_definition_t *data_definition   = NULL;
+	libesedb_io_handle_t *io_handle               = NULL;
+	libesedb_key_t *key                           = NULL;
+	libesedb_page_tree_t *page_tree               = NULL;
+	libesedb_page_tree_cursor_t *page_tree_cursor = NULL;
+	libfcache_cache_t *pages_cache                = NULL;
+	libfdata_vector_t *pages_vector               = NULL;
+	int result                                    = 0;
+	int seek_key_index                            = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_page_tree_cursor_open_page_tree(
+	          &io_handle,
+	          &file_io_handle,
+	          &pages_vector,
+	          &pages_cache,
+	          &page_tree,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_initialize(
+	          &page_tree_cursor,
+	          page_tree,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page_tree_cursor",
+	 page_tree_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_key_initialize(
+	          &key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "key",
+	 key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_data_definition_initialize(
+	          &data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "data_definition",
+	 data_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The seek keys are resolved on the current leaf page, on the next leaf page
+	 * and before the current leaf value, which requires a seek from the root page
+	 */
+	for( seek_key_index = 0;
+	     seek_key_index < 4;
+	     seek_key_index++ )
+	{
+		result = libesedb_key_set_data(
+		          key,
+		          &( seek_keys[ seek_key_index ] ),
+		          1,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_page_tree_cursor_seek_forward(
+		          page_tree_cursor,
+		          file_io_handle,
+		          key,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_page_tree_cursor_get_next_value(
+		          page_tree_cursor,
+		          file_io_handle,
+		          key,
+		          data_definition,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ESEDB_TEST_ASSERT_EQUAL_SIZE(
+		 "key->data_size",
+		 key->data_size,
+		 (size_t) 1 );
+
+		ESEDB_TEST_ASSERT_EQUAL_UINT8(
+		 "key->data[ 0 ]",
+		 key->data[ 0 ],
+		 expected_keys[ seek_key_index ] );
+
+		ESEDB_TEST_ASSERT_EQUAL_UINT32(
+		 "data_definition->page_number",
+		 data_definition->page_number,
+		 expected_page_numbers[ seek_key_index ] );
+	}
+	/* Test that a key on the next leaf page is resolved without a seek from the root page,
+	 * the root page number is changed into that of a page that does not exist
+	 */
+	result = libesedb_key_set_data(
+	          key,
+	          &( seek_keys[ 1 ] ),
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_seek_forward(
+	          page_tree_cursor,
+	          file_io_handle,
+	          key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_get_next_value(
+	          page_tree_cursor,
+	          file_io_handle,
+	          key,
+	          data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	page_tree_cursor->root_page_number = 99;
+
+	result = libesedb_key_set_data(
+	          key,
+	          &( sibling_seek_key ),
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_seek_forward(
+	          page_tree_cursor,
+	          file_io_handle,
+	          key,
+	          &error );
+
+	page_tree_cursor->root_page_number = 1;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_get_next_value(
+	          page_tree_cursor,
+	          file_io_handle,
+	          key,
+	          data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "key->data[ 0 ]",
+	 key->data[ 0 ],
+	 sibling_seek_key );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "data_definition->page_number",
+	 data_definition->page_number,
+	 3 );
+
+	/* Test error cases
+	 */
+	result = libesedb_page_tree_cursor_seek_forward(
+	          NULL,
+	          file_io_handle,
+	          key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_cursor_seek_forward(
+	          page_tree_cursor,
+	          file_io_handle,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_data_definition_free(
+	          &data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "data_definition",
+	 data_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_key_free(
+	          &key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "key",
+	 key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_free(
+	          &page_tree_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "page_tree_cursor",
+	 page_tree_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_page_tree_cursor_close_page_tree(
+	          &io_handle,
+	          &file_io_handle,
+	          &pages_vector,
+	          &pages_cache,
+	          &page_tree,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &data_definition,
+		 NULL );
+	}
+	if( key != NULL )
+	{
+		libesedb_key_free(
+		 &key,
+		 NULL );
+	}
+	if( page_tree_cursor != NULL )
+	{
+		libesedb_page_tree_cursor_free(
+		 &page_tree_cursor,
+		 NULL );
+	}
+	esedb_test_page_tree_cursor_close_page_tree(
+	 &io_handle,
+	 &file_io_handle,
+	 &pages_vector,
+	 &pages_cache,
+	 &page_tree,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libesedb_page_tree_cursor_get_next_value function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_tree_cursor_get_next_value(
+     void )
+{
+	uint8_t expected_keys[ 4 ]          = { 'a', 'c', 'e', 'g' };
+	uint32_t expected_page_numbers[ 4 ] = { 2, 2, 3, 3 };
+
+	libbfio_handle_t *file_io_handle              = NULL;
+	libcerror_error_t *error                      = NULL;
+	libesedb_data_definition_t *data_definition   = NULL;
+	libesedb_io_handle_t *io_handle               = NULL;
+	libesedb_key_t *key                           = NULL;
+	libesedb_page_tree_t *page_tree               = NULL;
+	libesedb_page_tree_cursor_t *page_tree_cursor = NULL;
+	libfcache_cache_t *pages_cache                = NULL;
+	libfdata_vector_t *pages_vector               = NULL;
+	int result                                    = 0;
+	int value_index                               = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_page_tree_cursor_open_page_tree(
+	          &io_handle,
+	          &file_io_handle,
+	          &pages_vector,
+	          &pages_cache,
+	          &page_tree,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_initialize(
+	          &page_tree_cursor,
+	          page_tree,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page_tree_cursor",
+	 page_tree_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_key_initialize(
+	          &key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "key",
+	 key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_data_definition_initialize(
+	          &data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "data_definition",
+	 data_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The defunct value of the first leaf page is skipped
+	 */
+	for( value_index = 0;
+	     value_index < 4;
+	     value_index++ )
+	{
+		result = libesedb_page_tree_cursor_get_next_value(
+		          page_tree_cursor,
+		          file_io_handle,
+		          key,
+		          data_definition,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ESEDB_TEST_ASSERT_EQUAL_SIZE(
+		 "key->data_size",
+		 key->data_size,
+		 (size_t) 1 );
+
+		ESEDB_TEST_ASSERT_EQUAL_UINT8(
+		 "key->data[ 0 ]",
+		 key->data[ 0 ],
+		 expected_keys[ value_index ] );
+
+		ESEDB_TEST_ASSERT_EQUAL_UINT32(
+		 "data_definition->page_number",
+		 data_definition->page_number,
+		 expected_page_numbers[ value_index ] );
+	}
+	result = libesedb_page_tree_cursor_get_next_value(
+	          page_tree_cursor,
+	          file_io_handle,
+	          key,
+	          data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_page_tree_cursor_get_next_value(
+	          NULL,
+	          file_io_handle,
+	          key,
+	          data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_cursor_get_next_value(
+	          page_tree_cursor,
+	          file_io_handle,
+	          key,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_data_definition_free(
+	          &data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "data_definition",
+	 data_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_key_free(
+	          &key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "key",
+	 key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_free(
+	          &page_tree_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "page_tree_cursor",
+	 page_tree_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_page_tree_cursor_close_page_tree(
+	          &io_handle,
+	          &file_io_handle,
+	          &pages_vector,
+	          &pages_cache,
+	          &page_tree,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &data_definition,
+		 NULL );
+	}
+	if( key != NULL )
+	{
+		libesedb_key_free(
+		 &key,
+		 NULL );
+	}
+	if( page_tree_cursor != NULL )
+	{
+		libesedb_page_tree_cursor_free(
+		 &page_tree_cursor,
+		 NULL );
+	}
+	esedb_test_page_tree_cursor_close_page_tree(
+	 &io_handle,
+	 &file_io_handle,
+	 &pages_vector,
+	 &pages_cache,
+	 &page_tree,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libesedb_page_tree_cursor_get_previous_value function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_tree_cursor_get_previous_value(
+     void )
+{
+	uint8_t expected_keys[ 5 ]          = { 'g', 'e', 'c', 'a', 'e' };
+	uint8_t seek_key                    = 'd';
+	uint32_t expected_page_numbers[ 5 ] = { 3, 3, 2, 2, 3 };
+
+	libbfio_handle_t *file_io_handle              = NULL;
+	libcerror_error_t *error                      = NULL;
+	libesedb_data_definition_t *data_definition   = NULL;
+	libesedb_io_handle_t *io_handle               = NULL;
+	libesedb_key_t *key                           = NULL;
+	libesedb_page_tree_t *page_tree               = NULL;
+	libesedb_page_tree_cursor_t *page_tree_cursor = NULL;
+	libfcache_cache_t *pages_cache                = NULL;
+	libfdata_vector_t *pages_vector               = NULL;
+	int result                                    = 0;
+	int value_index                               = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_page_tree_cursor_open_page_tree(
+	          &io_handle,
+	          &file_io_handle,
+	          &pages_vector,
+	          &pages_cache,
+	          &page_tree,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_initialize(
+	          &page_tree_cursor,
+	          page_tree,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page_tree_cursor",
+	 page_tree_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_key_initialize(
+	          &key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "key",
+	 key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_data_definition_initialize(
+	          &data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "data_definition",
+	 data_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The values are read backwards from the last leaf page into the first leaf page
+	 */
+	for( value_index = 0;
+	     value_index < 4;
+	     value_index++ )
+	{
+		result = libesedb_page_tree_cursor_get_previous_value(
+		          page_tree_cursor,
+		          file_io_handle,
+		          key,
+		          data_definition,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ESEDB_TEST_ASSERT_EQUAL_SIZE(
+		 "key->data_size",
+		 key->data_size,
+		 (size_t) 1 );
+
+		ESEDB_TEST_ASSERT_EQUAL_UINT8(
+		 "key->data[ 0 ]",
+		 key->data[ 0 ],
+		 expected_keys[ value_index ] );
+
+		ESEDB_TEST_ASSERT_EQUAL_UINT32(
+		 "data_definition->page_number",
+		 data_definition->page_number,
+		 expected_page_numbers[ value_index ] );
+	}
+	result = libesedb_page_tree_cursor_get_previous_value(
+	          page_tree_cursor,
+	          file_io_handle,
+	          key,
+	          data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test reading backwards across the page boundary after a seek
+	 */
+	result = libesedb_key_set_data(
+	          key,
+	          &seek_key,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_seek(
+	          page_tree_cursor,
+	          file_io_handle,
+	          key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_get_next_value(
+	          page_tree_cursor,
+	          file_io_handle,
+	          key,
+	          data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "key->data_size",
+	 key->data_size,
+	 (size_t) 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "key->data[ 0 ]",
+	 key->data[ 0 ],
+	 expected_keys[ 4 ] );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "data_definition->page_number",
+	 data_definition->page_number,
+	 expected_page_numbers[ 4 ] );
+
+	result = libesedb_page_tree_cursor_get_previous_value(
+	          page_tree_cursor,
+	          file_io_handle,
+	          key,
+	          data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "key->data_size",
+	 key->data_size,
+	 (size_t) 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "key->data[ 0 ]",
+	 key->data[ 0 ],
+	 expected_keys[ 2 ] );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "data_definition->page_number",
+	 data_definition->page_number,
+	 expected_page_numbers[ 2 ] );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "data_definition->page_value_index",
+	 data_definition->page_value_index,
+	 3 );
+
+	/* Test error cases
+	 */
+	result = libesedb_page_tree_cursor_get_previous_value(
+	          NULL,
+	          file_io_handle,
+	          key,
+	          data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_cursor_get_previous_value(
+	          page_tree_cursor,
+	          file_io_handle,
+	          key,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_data_definition_free(
+	          &data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "data_definition",
+	 data_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_key_free(
+	          &key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "key",
+	 key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_free(
+	          &page_tree_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "page_tree_cursor",
+	 page_tree_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_page_tree_cursor_close_page_tree(
+	          &io_handle,
+	          &file_io_handle,
+	          &pages_vector,
+	          &pages_cache,
+	          &page_tree,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &data_definition,
+		 NULL );
+	}
+	if( key != NULL )
+	{
+		libesedb_key_free(
+		 &key,
+		 NULL );
+	}
+	if( page_tree_cursor != NULL )
+	{
+		libesedb_page_tree_cursor_free(
+		 &page_tree_cursor,
+		 NULL );
+	}
+	esedb_test_page_tree_cursor_close_page_tree(
+	 &io_handle,
+	 &file_io_handle,
+	 &pages_vector,
+	 &pages_cache,
+	 &page_tree,
+	 NULL );
+
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_tree_cursor_initialize",
+	 esedb_test_page_tree_cursor_initialize );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_tree_cursor_free",
+	 esedb_test_page_tree_cursor_free );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_tree_cursor_get_outer_leaf_page_number",
+	 esedb_test_page_tree_cursor_get_outer_leaf_page_number );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_tree_cursor_get_lower_bound_page_value_index",
+	 esedb_test_page_tree_cursor_get_lower_bound_page_value_index );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_tree_cursor_seek",
+	 esedb_test_page_tree_cursor_seek );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_tree_cursor_seek_forward",
+	 esedb_test_page_tree_cursor_seek_forward );
+
+	/* TODO: add tests for libesedb_page_tree_cursor_read_ahead_pages */
+
+	/* TODO: add tests for libesedb_page_tree_cursor_read_ahead */
+
+	/* TODO: add tests for libesedb_page_tree_cursor_get_value */
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_tree_cursor_get_next_value",
+	 esedb_test_page_tree_cursor_get_next_value );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_tree_cursor_get_previous_value",
+	 esedb_test_page_tree_cursor_get_previous_value );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -20,19 +20,24 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "esedb_test_fixtures.h"
 #include "esedb_test_libcerror.h"
 #include "esedb_test_libesedb.h"
 #include "esedb_test_macros.h"
 #include "esedb_test_memory.h"
 #include "esedb_test_unused.h"
 
+#include "../libesedb/libesedb_libcdata.h"
+#include "../libesedb/libesedb_libfvalue.h"
 #include "../libesedb/libesedb_record.h"
 
 /* Tests the libesedb_record_free function
@@ -75,6 +80,719 @@ on_error:
 
 #if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
 
+/* Tests the libesedb_record_get_record_value function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_record_get_record_value(
+     void )
+{
+	esedb_test_fixtures_table_t *fixtures_table = NULL;
+	libcerror_error_t *error                    = NULL;
+	libesedb_record_t *record                   = NULL;
+	libfvalue_value_t *array_record_value       = NULL;
+	libfvalue_value_t *record_value             = NULL;
+	libfvalue_value_t *second_record_value      = NULL;
+	uint32_t value_32bit                        = 0;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_fixtures_table_initialize(
+	          &fixtures_table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_get_record(
+	          fixtures_table->table,
+	          1,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	/* The record values are not created when the record is read
+	 */
+	result = libcdata_array_get_entry_by_index(
+	          ( (libesedb_internal_record_t *) record )->values_array,
+	          0,
+	          (intptr_t **) &array_record_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "array_record_value",
+	 array_record_value );
+
+	/* Test regular cases
+	 */
+	result = libesedb_record_get_record_value(
+	          (libesedb_internal_record_t *) record,
+	          0,
+	          &record_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "record_value",
+	 record_value );
+
+	/* The record value is stored in the values array on first access
+	 */
+	result = libcdata_array_get_entry_by_index(
+	          ( (libesedb_internal_record_t *) record )->values_array,
+	          0,
+	          (intptr_t **) &array_record_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "array_record_value == record_value",
+	 (int) ( array_record_value == record_value ),
+	 1 );
+
+	/* The other record values are not created
+	 */
+	result = libcdata_array_get_entry_by_index(
+	          ( (libesedb_internal_record_t *) record )->values_array,
+	          1,
+	          (intptr_t **) &array_record_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "array_record_value",
+	 array_record_value );
+
+	/* A subsequent access returns the same record value
+	 */
+	result = libesedb_record_get_record_value(
+	          (libesedb_internal_record_t *) record,
+	          0,
+	          &second_record_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "second_record_value == record_value",
+	 (int) ( second_record_value == record_value ),
+	 1 );
+
+	result = libesedb_record_get_value_32bit(
+	          record,
+	          0,
+	          &value_32bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 esedb_test_fixtures_table_record_values[ 1 ] );
+
+	/* Test error cases
+	 */
+	result = libesedb_record_get_record_value(
+	          NULL,
+	          0,
+	          &record_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_record_get_record_value(
+	          (libesedb_internal_record_t *) record,
+	          -1,
+	          &record_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_record_get_record_value(
+	          (libesedb_internal_record_t *) record,
+	          0,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_record_free(
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_fixtures_table_free(
+	          &fixtures_table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libesedb_record_free(
+		 &record,
+		 NULL );
+	}
+	if( fixtures_table != NULL )
+	{
+		esedb_test_fixtures_table_free(
+		 &fixtures_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_record_get_value_data_reference and
+ * libesedb_record_get_value_binary_data_reference functions
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_record_get_value_data_reference(
+     void )
+{
+	esedb_test_fixtures_table_t *fixtures_table = NULL;
+	libcerror_error_t *error                    = NULL;
+	libesedb_record_t *empty_record             = NULL;
+	libesedb_record_t *record                   = NULL;
+	const uint8_t *second_value_data            = NULL;
+	const uint8_t *value_data                   = NULL;
+	size_t second_value_data_size               = 0;
+	size_t value_data_size                      = 0;
+	uint32_t value_32bit                        = 0;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_fixtures_table_initialize(
+	          &fixtures_table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_get_record(
+	          fixtures_table->table,
+	          1,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	/* Test regular cases
+	 */
+	result = libesedb_record_get_value_data_reference(
+	          record,
+	          0,
+	          &value_data,
+	          &value_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "value_data",
+	 value_data );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "value_data_size",
+	 value_data_size,
+	 (size_t) 4 );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 value_data,
+	 value_32bit );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 esedb_test_fixtures_table_record_values[ 1 ] );
+
+	result = libesedb_record_get_value_data_reference(
+	          record,
+	          1,
+	          &value_data,
+	          &value_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "value_data_size",
+	 value_data_size,
+	 esedb_test_fixtures_table_record_binary_data_sizes[ 1 ] );
+
+	/* The value data references the record data of the record
+	 */
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "value_data in record data",
+	 (int) ( ( value_data >= ( (libesedb_internal_record_t *) record )->record_data )
+	      && ( ( value_data + value_data_size ) <= ( ( (libesedb_internal_record_t *) record )->record_data + ( (libesedb_internal_record_t *) record )->record_data_size ) ) ),
+	 1 );
+
+	result = memory_compare(
+	          value_data,
+	          esedb_test_fixtures_table_record_binary_data[ 1 ],
+	          esedb_test_fixtures_table_record_binary_data_sizes[ 1 ] );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* The value data remains valid when other values of the record are accessed
+	 */
+	result = libesedb_record_get_value_32bit(
+	          record,
+	          0,
+	          &value_32bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_record_get_value_binary_data_size(
+	          record,
+	          1,
+	          &second_value_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "second_value_data_size",
+	 second_value_data_size,
+	 value_data_size );
+
+	result = libesedb_record_get_value_binary_data_reference(
+	          record,
+	          1,
+	          &second_value_data,
+	          &second_value_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "second_value_data == value_data",
+	 (int) ( second_value_data == value_data ),
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "second_value_data_size",
+	 second_value_data_size,
+	 value_data_size );
+
+	result = memory_compare(
+	          value_data,
+	          esedb_test_fixtures_table_record_binary_data[ 1 ],
+	          esedb_test_fixtures_table_record_binary_data_sizes[ 1 ] );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* The value data remains valid when another record is read
+	 */
+	result = libesedb_table_get_record(
+	          fixtures_table->table,
+	          2,
+	          &empty_record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          value_data,
+	          esedb_test_fixtures_table_record_binary_data[ 1 ],
+	          esedb_test_fixtures_table_record_binary_data_sizes[ 1 ] );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a value without data
+	 */
+	result = libesedb_record_get_value_data_reference(
+	          empty_record,
+	          1,
+	          &second_value_data,
+	          &second_value_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_record_get_value_binary_data_reference(
+	          empty_record,
+	          1,
+	          &second_value_data,
+	          &second_value_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_record_get_value_data_reference(
+	          NULL,
+	          1,
+	          &value_data,
+	          &value_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_record_get_value_data_reference(
+	          record,
+	          -1,
+	          &value_data,
+	          &value_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_record_get_value_data_reference(
+	          record,
+	          1,
+	          NULL,
+	          &value_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_record_get_value_data_reference(
+	          record,
+	          1,
+	          &value_data,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a column that does not contain binary data
+	 */
+	result = libesedb_record_get_value_binary_data_reference(
+	          record,
+	          0,
+	          &value_data,
+	          &value_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_record_free(
+	          &empty_record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_record_free(
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_fixtures_table_free(
+	          &fixtures_table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( empty_record != NULL )
+	{
+		libesedb_record_free(
+		 &empty_record,
+		 NULL );
+	}
+	if( record != NULL )
+	{
+		libesedb_record_free(
+		 &record,
+		 NULL );
+	}
+	if( fixtures_table != NULL )
+	{
+		esedb_test_fixtures_table_free(
+		 &fixtures_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 /* The main program
@@ -104,10 +822,20 @@ int main(
 
 #if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
 
+	/* TODO: add tests for libesedb_record_set_column_projection */
+
+	/* TODO: add tests for libesedb_record_read_data_definition */
+
 	/* TODO: add tests for libesedb_record_get_number_of_values */
 
+	ESEDB_TEST_RUN(
+	 "libesedb_record_get_record_value",
+	 esedb_test_record_get_record_value );
+
 	/* TODO: add tests for libesedb_record_get_column_catalog_definition */
 
+	/* TODO: add tests for libesedb_record_get_data_type_definition */
+
 	/* TODO: add tests for libesedb_record_get_column_identifier */
 
 	/* TODO: add tests for libesedb_record_get_column_type */
@@ -126,6 +854,10 @@ int main(
 
 	/* TODO: add tests for libesedb_record_get_value_data */
 
+	ESEDB_TEST_RUN(
+	 "libesedb_record_get_value_data_reference",
+	 esedb_test_record_get_value_data_reference );
+
 	/* TODO: add tests for libesedb_record_get_value_data_flags */
 
 	/* TODO: add tests for libesedb_record_get_value_boolean */
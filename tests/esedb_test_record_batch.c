@@ -0,0 +1,960 @@
+/*
+ * Library record_batch type test program
+ *
+ * Copyright (C) 2009-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_test_fixtures.h"
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_memory.h"
+#include "esedb_test_unused.h"
+
+#include "../libesedb/libesedb_definitions.h"
+#include "../libesedb/libesedb_libcdata.h"
+#include "../libesedb/libesedb_record.h"
+#include "../libesedb/libesedb_record_batch.h"
+#include "../libesedb/libesedb_table_definition.h"
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+uint32_t esedb_test_record_batch_column_identifiers[ 4 ] = {
+	1, 2, 256, 257 };
+
+uint32_t esedb_test_record_batch_column_types[ 4 ] = {
+	LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED, LIBESEDB_COLUMN_TYPE_DATE_TIME, LIBESEDB_COLUMN_TYPE_LARGE_TEXT, LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED };
+
+/* Tests the libesedb_record_batch_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_record_batch_initialize(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libesedb_record_batch_t *record_batch         = NULL;
+	libesedb_table_definition_t *table_definition = NULL;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_fixtures_table_definition_initialize(
+	          &table_definition,
+	          esedb_test_record_batch_column_identifiers,
+	          esedb_test_record_batch_column_types,
+	          NULL,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "table_definition",
+	 table_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_record_batch_initialize(
+	          &record_batch,
+	          table_definition,
+	          NULL,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "record_batch",
+	 record_batch );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "record_batch->number_of_columns",
+	 ( (libesedb_internal_record_batch_t *) record_batch )->number_of_columns,
+	 4 );
+
+	result = libesedb_record_batch_free(
+	          &record_batch,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record_batch",
+	 record_batch );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_record_batch_initialize(
+	          NULL,
+	          table_definition,
+	          NULL,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	record_batch = (libesedb_record_batch_t *) 0x12345678UL;
+
+	result = libesedb_record_batch_initialize(
+	          &record_batch,
+	          table_definition,
+	          NULL,
+	          16,
+	          &error );
+
+	record_batch = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_record_batch_initialize(
+	          &record_batch,
+	          NULL,
+	          NULL,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_record_batch_initialize(
+	          &record_batch,
+	          table_definition,
+	          NULL,
+	          -1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_table_definition_free(
+	          &table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "table_definition",
+	 table_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_batch != NULL )
+	{
+		libesedb_record_batch_free(
+		 &record_batch,
+		 NULL );
+	}
+	if( table_definition != NULL )
+	{
+		libesedb_table_definition_free(
+		 &table_definition,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+/* Tests the libesedb_record_batch_free function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_record_batch_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_record_batch_free(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* Tests the libesedb_record_batch_append_record function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_record_batch_append_record(
+     void )
+{
+	libesedb_data_type_definition_t data_type_definitions[ 4 ];
+
+	uint8_t record_data[ 15 ] = {
+		0x78, 0x56, 0x34, 0x12, 'a', 'b', 'c', 0x04, 0x00, 0x06, 0x00, 0x01, 0x00, 0x02, 0x00 };
+
+	libesedb_internal_record_t internal_record;
+
+	libcerror_error_t *error                      = NULL;
+	libesedb_record_batch_column_t *column        = NULL;
+	libesedb_record_batch_t *record_batch         = NULL;
+	libesedb_table_definition_t *table_definition = NULL;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 &internal_record,
+	 0,
+	 sizeof( libesedb_internal_record_t ) );
+
+	result = esedb_test_fixtures_table_definition_initialize(
+	          &table_definition,
+	          esedb_test_record_batch_column_identifiers,
+	          esedb_test_record_batch_column_types,
+	          NULL,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_record_batch_initialize(
+	          &record_batch,
+	          table_definition,
+	          NULL,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The record contains a fixed-size value, a NULL value, a variable-size value
+	 * and a tagged multi value of the fixed-size column type
+	 */
+	memory_set(
+	 data_type_definitions,
+	 0,
+	 sizeof( libesedb_data_type_definition_t ) * 4 );
+
+	data_type_definitions[ 0 ].data_offset = 0;
+	data_type_definitions[ 0 ].data_size   = 4;
+	data_type_definitions[ 0 ].has_data    = 1;
+	data_type_definitions[ 2 ].data_offset = 4;
+	data_type_definitions[ 2 ].data_size   = 3;
+	data_type_definitions[ 2 ].has_data    = 1;
+	data_type_definitions[ 3 ].data_offset = 7;
+	data_type_definitions[ 3 ].data_size   = 8;
+	data_type_definitions[ 3 ].data_flags  = LIBESEDB_VALUE_FLAG_MULTI_VALUE;
+	data_type_definitions[ 3 ].has_data    = 1;
+
+	internal_record.record_data           = record_data;
+	internal_record.record_data_size      = 15;
+	internal_record.data_type_definitions = data_type_definitions;
+
+	result = libcdata_array_initialize(
+	          &( internal_record.values_array ),
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_record_batch_append_record(
+	          (libesedb_internal_record_batch_t *) record_batch,
+	          &internal_record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "record_batch->number_of_records",
+	 ( (libesedb_internal_record_batch_t *) record_batch )->number_of_records,
+	 1 );
+
+	/* The fixed-size value is stored packed
+	 */
+	column = &( ( (libesedb_internal_record_batch_t *) record_batch )->columns[ 0 ] );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "column->value_data_size",
+	 column->value_data_size,
+	 (size_t) 4 );
+
+	result = memory_compare(
+	          column->value_data,
+	          record_data,
+	          4 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "column->validity_bitmap[ 0 ]",
+	 column->validity_bitmap[ 0 ],
+	 (uint8_t) 0x01 );
+
+	/* The NULL value is stored as 0-byte values
+	 */
+	column = &( ( (libesedb_internal_record_batch_t *) record_batch )->columns[ 1 ] );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "column->value_data_size",
+	 column->value_data_size,
+	 (size_t) 8 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "column->validity_bitmap[ 0 ]",
+	 column->validity_bitmap[ 0 ],
+	 (uint8_t) 0x00 );
+
+	/* The variable-size value is stored with its offsets
+	 */
+	column = &( ( (libesedb_internal_record_batch_t *) record_batch )->columns[ 2 ] );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "column->value_offsets[ 1 ]",
+	 column->value_offsets[ 1 ],
+	 (uint32_t) 3 );
+
+	result = memory_compare(
+	          column->value_data,
+	          &( record_data[ 4 ] ),
+	          3 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* The tagged multi value is stored as in the record data with its offsets
+	 */
+	column = &( ( (libesedb_internal_record_batch_t *) record_batch )->columns[ 3 ] );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "column->value_size",
+	 column->value_size,
+	 (size_t) 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "column->value_offsets[ 1 ]",
+	 column->value_offsets[ 1 ],
+	 (uint32_t) 8 );
+
+	result = memory_compare(
+	          column->value_data,
+	          &( record_data[ 7 ] ),
+	          8 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "column->validity_bitmap[ 0 ]",
+	 column->validity_bitmap[ 0 ],
+	 (uint8_t) 0x01 );
+
+	/* Test error cases
+	 */
+	result = libesedb_record_batch_append_record(
+	          NULL,
+	          &internal_record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_record_batch_append_record(
+	          (libesedb_internal_record_batch_t *) record_batch,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a fixed-size value with a size that differs from the column type
+	 */
+	data_type_definitions[ 0 ].data_size = 3;
+
+	result = libesedb_record_batch_append_record(
+	          (libesedb_internal_record_batch_t *) record_batch,
+	          &internal_record,
+	          &error );
+
+	data_type_definitions[ 0 ].data_size = 4;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_array_free(
+	          &( internal_record.values_array ),
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_record_batch_free(
+	          &record_batch,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_definition_free(
+	          &table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( internal_record.values_array != NULL )
+	{
+		libcdata_array_free(
+		 &( internal_record.values_array ),
+		 NULL,
+		 NULL );
+	}
+	if( record_batch != NULL )
+	{
+		libesedb_record_batch_free(
+		 &record_batch,
+		 NULL );
+	}
+	if( table_definition != NULL )
+	{
+		libesedb_table_definition_free(
+		 &table_definition,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_record_batch_get_column_buffers function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_record_batch_get_column_buffers(
+     libesedb_record_batch_t *record_batch )
+{
+	const uint32_t *value_offsets  = NULL;
+	const uint8_t *validity_bitmap = NULL;
+	const uint8_t *value_data      = NULL;
+	libcerror_error_t *error       = NULL;
+	size_t value_data_size         = 0;
+	size_t value_size              = 0;
+	int result                     = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_record_batch_get_column_value_size(
+	          record_batch,
+	          1,
+	          &value_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "value_size",
+	 value_size,
+	 (size_t) 8 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_record_batch_get_column_buffers(
+	          record_batch,
+	          1,
+	          &validity_bitmap,
+	          &value_offsets,
+	          &value_data,
+	          &value_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "validity_bitmap",
+	 validity_bitmap );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "value_offsets",
+	 value_offsets );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "value_data_size",
+	 value_data_size,
+	 (size_t) 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_record_batch_get_column_value_size(
+	          record_batch,
+	          2,
+	          &value_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "value_size",
+	 value_size,
+	 (size_t) 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_record_batch_get_column_buffers(
+	          record_batch,
+	          2,
+	          &validity_bitmap,
+	          &value_offsets,
+	          &value_data,
+	          &value_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "value_offsets",
+	 value_offsets );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "value_offsets[ 0 ]",
+	 value_offsets[ 0 ],
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_record_batch_get_column_buffers(
+	          NULL,
+	          0,
+	          &validity_bitmap,
+	          &value_offsets,
+	          &value_data,
+	          &value_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_record_batch_get_column_buffers(
+	          record_batch,
+	          4,
+	          &validity_bitmap,
+	          &value_offsets,
+	          &value_data,
+	          &value_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_record_batch_get_column_buffers(
+	          record_batch,
+	          0,
+	          NULL,
+	          &value_offsets,
+	          &value_data,
+	          &value_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+	libcerror_error_t *error                      = NULL;
+	libesedb_record_batch_t *record_batch         = NULL;
+	libesedb_table_definition_t *table_definition = NULL;
+	int result                                    = 0;
+#endif
+
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_record_batch_initialize",
+	 esedb_test_record_batch_initialize );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+	ESEDB_TEST_RUN(
+	 "libesedb_record_batch_free",
+	 esedb_test_record_batch_free );
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	/* Initialize record batch for tests
+	 */
+	result = esedb_test_fixtures_table_definition_initialize(
+	          &table_definition,
+	          esedb_test_record_batch_column_identifiers,
+	          esedb_test_record_batch_column_types,
+	          NULL,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libesedb_record_batch_initialize(
+	          &record_batch,
+	          table_definition,
+	          NULL,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "record_batch",
+	 record_batch );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* TODO: add tests for libesedb_record_batch_get_column */
+
+	/* TODO: add tests for libesedb_record_batch_column_resize_value_data */
+
+	ESEDB_TEST_RUN(
+	 "libesedb_record_batch_append_record",
+	 esedb_test_record_batch_append_record );
+
+	/* TODO: add tests for libesedb_record_batch_get_number_of_records */
+
+	/* TODO: add tests for libesedb_record_batch_get_number_of_columns */
+
+	/* TODO: add tests for libesedb_record_batch_get_column_identifier */
+
+	/* TODO: add tests for libesedb_record_batch_get_column_type */
+
+	ESEDB_TEST_RUN_WITH_ARGS(
+	 "libesedb_record_batch_get_column_buffers",
+	 esedb_test_record_batch_get_column_buffers,
+	 record_batch );
+
+	/* Clean up
+	 */
+	result = libesedb_record_batch_free(
+	          &record_batch,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libesedb_table_definition_free(
+	          &table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_batch != NULL )
+	{
+		libesedb_record_batch_free(
+		 &record_batch,
+		 NULL );
+	}
+	if( table_definition != NULL )
+	{
+		libesedb_table_definition_free(
+		 &table_definition,
+		 NULL );
+	}
+#endif
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,817 @@
+/*
+ * Library record_filter type test program
+ *
+ * Copyright (C) 2009-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_test_fixtures.h"
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_memory.h"
+#include "esedb_test_unused.h"
+
+#include "../libesedb/libesedb_definitions.h"
+#include "../libesedb/libesedb_record_filter.h"
+#include "../libesedb/libesedb_table_definition.h"
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+uint32_t esedb_test_record_filter_column_identifiers[ 3 ] = {
+	1, 2, 256 };
+
+uint32_t esedb_test_record_filter_column_types[ 3 ] = {
+	LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED, LIBESEDB_COLUMN_TYPE_DATE_TIME, LIBESEDB_COLUMN_TYPE_LARGE_TEXT };
+
+uint32_t esedb_test_record_filter_column_sizes[ 3 ] = {
+	4, 8, 0 };
+
+/* Record data with: last fixed size data type 2, -2 (column 1) and 0x0102030405060708 (column 2)
+ */
+uint8_t esedb_test_record_filter_record_data[ 16 ] = {
+	0x02, 0x7f, 0x10, 0x00, 0xfe, 0xff, 0xff, 0xff, 0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01 };
+
+/* Tests the libesedb_record_filter_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_record_filter_initialize(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libesedb_record_filter_t *record_filter = NULL;
+	int result                              = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_record_filter_initialize(
+	          &record_filter,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "record_filter",
+	 record_filter );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_record_filter_free(
+	          &record_filter,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record_filter",
+	 record_filter );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_record_filter_initialize(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	record_filter = (libesedb_record_filter_t *) 0x12345678UL;
+
+	result = libesedb_record_filter_initialize(
+	          &record_filter,
+	          &error );
+
+	record_filter = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+
+	/* Test libesedb_record_filter_initialize with malloc failing
+	 */
+	esedb_test_malloc_attempts_before_fail = 0;
+
+	result = libesedb_record_filter_initialize(
+	          &record_filter,
+	          &error );
+
+	if( esedb_test_malloc_attempts_before_fail != -1 )
+	{
+		esedb_test_malloc_attempts_before_fail = -1;
+
+		if( record_filter != NULL )
+		{
+			libesedb_record_filter_free(
+			 &record_filter,
+			 NULL );
+		}
+	}
+	else
+	{
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "record_filter",
+		 record_filter );
+
+		ESEDB_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_ESEDB_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_filter != NULL )
+	{
+		libesedb_record_filter_free(
+		 &record_filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_record_filter_free function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_record_filter_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_record_filter_free(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_record_filter_append_condition function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_record_filter_append_condition(
+     libesedb_table_definition_t *table_definition )
+{
+	uint8_t value[ 8 ]                      = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+	libcerror_error_t *error                = NULL;
+	libesedb_record_filter_t *record_filter = NULL;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_record_filter_initialize(
+	          &record_filter,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "record_filter",
+	 record_filter );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_record_filter_append_condition(
+	          record_filter,
+	          table_definition,
+	          2,
+	          LIBESEDB_FILTER_OPERATOR_IN_SET,
+	          value,
+	          8,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "record_filter->number_of_conditions",
+	 record_filter->number_of_conditions,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "record_filter->conditions[ 0 ].value_offset",
+	 record_filter->conditions[ 0 ].value_offset,
+	 8 );
+
+	/* Test error cases
+	 */
+	result = libesedb_record_filter_append_condition(
+	          NULL,
+	          table_definition,
+	          1,
+	          LIBESEDB_FILTER_OPERATOR_EQUAL,
+	          value,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_record_filter_append_condition(
+	          record_filter,
+	          NULL,
+	          1,
+	          LIBESEDB_FILTER_OPERATOR_EQUAL,
+	          value,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_record_filter_append_condition(
+	          record_filter,
+	          table_definition,
+	          1,
+	          -1,
+	          value,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_record_filter_append_condition(
+	          record_filter,
+	          table_definition,
+	          1,
+	          LIBESEDB_FILTER_OPERATOR_EQUAL,
+	          NULL,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_record_filter_append_condition(
+	          record_filter,
+	          table_definition,
+	          1,
+	          LIBESEDB_FILTER_OPERATOR_EQUAL,
+	          value,
+	          8,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a column identifier that is not defined
+	 */
+	result = libesedb_record_filter_append_condition(
+	          record_filter,
+	          table_definition,
+	          3,
+	          LIBESEDB_FILTER_OPERATOR_EQUAL,
+	          value,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a column that is not fixed-size
+	 */
+	result = libesedb_record_filter_append_condition(
+	          record_filter,
+	          table_definition,
+	          256,
+	          LIBESEDB_FILTER_OPERATOR_EQUAL,
+	          value,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_record_filter_free(
+	          &record_filter,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record_filter",
+	 record_filter );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_filter != NULL )
+	{
+		libesedb_record_filter_free(
+		 &record_filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_record_filter_evaluate function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_record_filter_evaluate(
+     libesedb_table_definition_t *table_definition )
+{
+	uint8_t greater_value[ 4 ]              = { 0xff, 0xff, 0xff, 0xff };
+	uint8_t less_value[ 4 ]                 = { 0x00, 0x00, 0x00, 0x80 };
+	uint8_t set_values[ 8 ]                 = { 0x01, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xff, 0xff };
+	libcerror_error_t *error                = NULL;
+	libesedb_record_filter_t *record_filter = NULL;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_record_filter_initialize(
+	          &record_filter,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "record_filter",
+	 record_filter );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_record_filter_append_condition(
+	          record_filter,
+	          table_definition,
+	          1,
+	          LIBESEDB_FILTER_OPERATOR_GREATER,
+	          less_value,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_record_filter_append_condition(
+	          record_filter,
+	          table_definition,
+	          1,
+	          LIBESEDB_FILTER_OPERATOR_IN_SET,
+	          set_values,
+	          8,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_record_filter_evaluate(
+	          record_filter,
+	          esedb_test_record_filter_record_data,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* -2 is signed and not greater than -1
+	 */
+	result = libesedb_record_filter_append_condition(
+	          record_filter,
+	          table_definition,
+	          1,
+	          LIBESEDB_FILTER_OPERATOR_GREATER_OR_EQUAL,
+	          greater_value,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_record_filter_evaluate(
+	          record_filter,
+	          esedb_test_record_filter_record_data,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_record_filter_evaluate(
+	          NULL,
+	          esedb_test_record_filter_record_data,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_record_filter_evaluate(
+	          record_filter,
+	          NULL,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_record_filter_evaluate(
+	          record_filter,
+	          esedb_test_record_filter_record_data,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_record_filter_evaluate(
+	          record_filter,
+	          esedb_test_record_filter_record_data,
+	          6,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_record_filter_free(
+	          &record_filter,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record_filter",
+	 record_filter );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_filter != NULL )
+	{
+		libesedb_record_filter_free(
+		 &record_filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+	libcerror_error_t *error                      = NULL;
+	libesedb_table_definition_t *table_definition = NULL;
+	int result                                    = 0;
+#endif
+
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_record_filter_initialize",
+	 esedb_test_record_filter_initialize );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_record_filter_free",
+	 esedb_test_record_filter_free );
+
+	/* Initialize table definition for tests
+	 */
+	result = esedb_test_fixtures_table_definition_initialize(
+	          &table_definition,
+	          esedb_test_record_filter_column_identifiers,
+	          esedb_test_record_filter_column_types,
+	          esedb_test_record_filter_column_sizes,
+	          3,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "table_definition",
+	 table_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_RUN_WITH_ARGS(
+	 "libesedb_record_filter_append_condition",
+	 esedb_test_record_filter_append_condition,
+	 table_definition );
+
+	/* TODO: add tests for libesedb_record_filter_compare_value */
+
+	ESEDB_TEST_RUN_WITH_ARGS(
+	 "libesedb_record_filter_evaluate",
+	 esedb_test_record_filter_evaluate,
+	 table_definition );
+
+	/* TODO: add tests for libesedb_record_filter_evaluate_data_definition */
+
+	/* Clean up
+	 */
+	result = libesedb_table_definition_free(
+	          &table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( table_definition != NULL )
+	{
+		libesedb_table_definition_free(
+		 &table_definition,
+		 NULL );
+	}
+#endif
+	return( EXIT_FAILURE );
+}
+
@@ -21,18 +21,23 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "esedb_test_fixtures.h"
 #include "esedb_test_libcerror.h"
 #include "esedb_test_libesedb.h"
 #include "esedb_test_macros.h"
 #include "esedb_test_memory.h"
 #include "esedb_test_unused.h"
 
+#include "../libesedb/libesedb_libcdata.h"
+#include "../libesedb/libesedb_libfvalue.h"
+#include "../libesedb/libesedb_record.h"
 #include "../libesedb/libesedb_table.h"
 
 /* Tests the libesedb_table_free function
@@ -75,6 +80,801 @@ on_error:
 
 #if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
 
+/* Tests the libesedb_table_get_record_into function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_table_get_record_into(
+     void )
+{
+	uint8_t binary_data[ 16 ];
+
+	uint32_t binary_column_identifiers[ 1 ]     = { 128 };
+	uint32_t reversed_column_identifiers[ 2 ]   = { 128, 1 };
+	esedb_test_fixtures_table_t *fixtures_table = NULL;
+	libcerror_error_t *error                    = NULL;
+	libesedb_record_t *record                   = NULL;
+	libfvalue_value_t *array_record_value       = NULL;
+	libfvalue_value_t *record_value             = NULL;
+	size_t binary_data_size                     = 0;
+	uint32_t value_32bit                        = 0;
+	int number_of_values                        = 0;
+	int record_entry                            = 0;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_fixtures_table_initialize(
+	          &fixtures_table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_get_record(
+	          fixtures_table->table,
+	          0,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	result = libesedb_record_get_record_value(
+	          (libesedb_internal_record_t *) record,
+	          0,
+	          &record_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The binary data sizes of the successive records shrink and grow
+	 * the record data
+	 */
+	for( record_entry = 0;
+	     record_entry < ESEDB_TEST_FIXTURES_TABLE_NUMBER_OF_RECORDS;
+	     record_entry++ )
+	{
+		result = libesedb_table_get_record_into(
+		          fixtures_table->table,
+		          record_entry,
+		          record,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The record value of a previous read is refilled in place
+		 */
+		result = libcdata_array_get_entry_by_index(
+		          ( (libesedb_internal_record_t *) record )->values_array,
+		          0,
+		          (intptr_t **) &array_record_value,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "array_record_value == record_value",
+		 (int) ( array_record_value == record_value ),
+		 1 );
+
+		result = libesedb_record_get_value_32bit(
+		          record,
+		          0,
+		          &value_32bit,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ESEDB_TEST_ASSERT_EQUAL_UINT32(
+		 "value_32bit",
+		 value_32bit,
+		 esedb_test_fixtures_table_record_values[ record_entry ] );
+
+		result = libesedb_record_get_value_binary_data_size(
+		          record,
+		          1,
+		          &binary_data_size,
+		          &error );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* A record without binary data has an empty binary value
+		 */
+		if( esedb_test_fixtures_table_record_binary_data_sizes[ record_entry ] == 0 )
+		{
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+
+			continue;
+		}
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_EQUAL_SIZE(
+		 "binary_data_size",
+		 binary_data_size,
+		 esedb_test_fixtures_table_record_binary_data_sizes[ record_entry ] );
+
+		result = libesedb_record_get_value_binary_data(
+		          record,
+		          1,
+		          binary_data,
+		          16,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          binary_data,
+		          esedb_test_fixtures_table_record_binary_data[ record_entry ],
+		          binary_data_size );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test a record refilled with a different column projection
+	 */
+	result = libesedb_table_set_column_projection(
+	          fixtures_table->table,
+	          binary_column_identifiers,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_get_record_into(
+	          fixtures_table->table,
+	          1,
+	          record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_record_get_number_of_values(
+	          record,
+	          &number_of_values,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_values",
+	 number_of_values,
+	 1 );
+
+	result = libesedb_record_get_value_binary_data(
+	          record,
+	          0,
+	          binary_data,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          binary_data,
+	          esedb_test_fixtures_table_record_binary_data[ 1 ],
+	          esedb_test_fixtures_table_record_binary_data_sizes[ 1 ] );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libesedb_table_set_column_projection(
+	          fixtures_table->table,
+	          reversed_column_identifiers,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_get_record_into(
+	          fixtures_table->table,
+	          3,
+	          record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_record_get_number_of_values(
+	          record,
+	          &number_of_values,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_values",
+	 number_of_values,
+	 2 );
+
+	result = libesedb_record_get_value_binary_data(
+	          record,
+	          0,
+	          binary_data,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          binary_data,
+	          esedb_test_fixtures_table_record_binary_data[ 3 ],
+	          esedb_test_fixtures_table_record_binary_data_sizes[ 3 ] );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libesedb_record_get_value_32bit(
+	          record,
+	          1,
+	          &value_32bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 esedb_test_fixtures_table_record_values[ 3 ] );
+
+	/* Test a record refilled without a column projection
+	 */
+	result = libesedb_table_set_column_projection(
+	          fixtures_table->table,
+	          NULL,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_get_record_into(
+	          fixtures_table->table,
+	          4,
+	          record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_record_get_value_32bit(
+	          record,
+	          0,
+	          &value_32bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 esedb_test_fixtures_table_record_values[ 4 ] );
+
+	/* Test error cases
+	 */
+	result = libesedb_table_get_record_into(
+	          NULL,
+	          0,
+	          record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_record_into(
+	          fixtures_table->table,
+	          -1,
+	          record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_record_into(
+	          fixtures_table->table,
+	          ESEDB_TEST_FIXTURES_TABLE_NUMBER_OF_RECORDS,
+	          record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_record_into(
+	          fixtures_table->table,
+	          0,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_record_free(
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_fixtures_table_free(
+	          &fixtures_table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libesedb_record_free(
+		 &record,
+		 NULL );
+	}
+	if( fixtures_table != NULL )
+	{
+		esedb_test_fixtures_table_free(
+		 &fixtures_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_table_get_record_by_key function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_table_get_record_by_key(
+     void )
+{
+	uint8_t defunct_key_data[ 1 ]               = { 'b' };
+	uint8_t missing_key_data[ 1 ]               = { 'f' };
+	uint8_t trailing_key_data[ 1 ]              = { 'h' };
+	esedb_test_fixtures_table_t *fixtures_table = NULL;
+	libcerror_error_t *error                    = NULL;
+	libesedb_record_t *record                   = NULL;
+	uint32_t value_32bit                        = 0;
+	int record_entry                            = 0;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_fixtures_table_initialize(
+	          &fixtures_table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The records are stored in both leaf pages of the table page tree
+	 */
+	for( record_entry = 0;
+	     record_entry < ESEDB_TEST_FIXTURES_TABLE_NUMBER_OF_RECORDS;
+	     record_entry++ )
+	{
+		result = libesedb_table_get_record_by_key(
+		          fixtures_table->table,
+		          esedb_test_fixtures_table_record_keys[ record_entry ],
+		          esedb_test_fixtures_table_record_key_sizes[ record_entry ],
+		          &record,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ESEDB_TEST_ASSERT_IS_NOT_NULL(
+		 "record",
+		 record );
+
+		result = libesedb_record_get_value_32bit(
+		          record,
+		          0,
+		          &value_32bit,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ESEDB_TEST_ASSERT_EQUAL_UINT32(
+		 "value_32bit",
+		 value_32bit,
+		 esedb_test_fixtures_table_record_values[ record_entry ] );
+
+		result = libesedb_record_free(
+		          &record,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test a key of a defunct record
+	 */
+	result = libesedb_table_get_record_by_key(
+	          fixtures_table->table,
+	          defunct_key_data,
+	          1,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a key that sorts between records
+	 */
+	result = libesedb_table_get_record_by_key(
+	          fixtures_table->table,
+	          missing_key_data,
+	          1,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a key that sorts after the last record
+	 */
+	result = libesedb_table_get_record_by_key(
+	          fixtures_table->table,
+	          trailing_key_data,
+	          1,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_table_get_record_by_key(
+	          NULL,
+	          missing_key_data,
+	          1,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_record_by_key(
+	          fixtures_table->table,
+	          NULL,
+	          1,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_record_by_key(
+	          fixtures_table->table,
+	          missing_key_data,
+	          1,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = esedb_test_fixtures_table_free(
+	          &fixtures_table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libesedb_record_free(
+		 &record,
+		 NULL );
+	}
+	if( fixtures_table != NULL )
+	{
+		esedb_test_fixtures_table_free(
+		 &fixtures_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 /* The main program
@@ -134,6 +934,24 @@ int main(
 
 	/* TODO: add tests for libesedb_table_get_record */
 
+	ESEDB_TEST_RUN(
+	 "libesedb_table_get_record_by_key",
+	 esedb_test_table_get_record_by_key );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_table_get_record_into",
+	 esedb_test_table_get_record_into );
+
+	/* TODO: add tests for libesedb_table_read_batch */
+
+	/* TODO: add tests for libesedb_table_set_column_projection */
+
+	/* TODO: add tests for libesedb_table_append_filter_condition */
+
+	/* TODO: add tests for libesedb_table_clear_filter_conditions */
+
+	/* TODO: add tests for libesedb_table_get_cursor */
+
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -108,6 +108,12 @@ int main(
 
 	/* TODO: add tests for libesedb_table_definition_append_index_catalog_definition */
 
+	/* TODO: add tests for libesedb_table_definition_build_column_catalog_definitions_array */
+
+	/* TODO: add tests for libesedb_table_definition_get_column_catalog_definition_by_index */
+
+	/* TODO: add tests for libesedb_table_definition_get_column_index_by_identifier */
+
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -0,0 +1,151 @@
+#!/bin/bash
+# Verify tool testing script
+#
+# Version: 20181016
+
+EXIT_SUCCESS=0;
+EXIT_FAILURE=1;
+EXIT_IGNORE=77;
+
+# The exit status of esedbverify if corrupted pages were found
+EXIT_CORRUPTED_PAGES=2;
+
+OPTIONS="";
+
+INPUT_GLOB="*";
+
+if ! test -z ${SKIP_TOOLS_TESTS};
+then
+	exit ${EXIT_IGNORE};
+fi
+
+TEST_EXECUTABLE="../esedbtools/esedbverify";
+
+if ! test -x "${TEST_EXECUTABLE}";
+then
+	TEST_EXECUTABLE="../esedbtools/esedbverify.exe";
+fi
+
+if ! test -x "${TEST_EXECUTABLE}";
+then
+	echo "Missing test executable: ${TEST_EXECUTABLE}";
+
+	exit ${EXIT_FAILURE};
+fi
+
+TEST_RUNNER="tests/test_runner.sh";
+
+if ! test -f "${TEST_RUNNER}";
+then
+	TEST_RUNNER="./test_runner.sh";
+fi
+
+if ! test -f "${TEST_RUNNER}";
+then
+	echo "Missing test runner: ${TEST_RUNNER}";
+
+	exit ${EXIT_FAILURE};
+fi
+
+source ${TEST_RUNNER};
+
+# Runs esedbverify on the input file.
+#
+# Arguments:
+#   a string containing the path of the test input file
+#
+# Returns:
+#   an integer containg the exit status of the test
+#
+test_verify_input_file()
+{
+	local INPUT_FILE=$1;
+
+	run_test_with_input_and_arguments "${TEST_EXECUTABLE}" "${INPUT_FILE}" ${OPTIONS};
+	local RESULT=$?;
+
+	# Corrupted pages in the test input are not a test failure
+	if test ${RESULT} -eq ${EXIT_CORRUPTED_PAGES};
+	then
+		RESULT=${EXIT_SUCCESS};
+	fi
+
+	echo -n "esedbverify with input: ${INPUT_FILE}";
+
+	if test ${RESULT} -ne ${EXIT_SUCCESS};
+	then
+		echo " (FAIL)";
+	else
+		echo " (PASS)";
+	fi
+	return ${RESULT};
+}
+
+assert_availability_binaries;
+
+TEST_INPUT_DIRECTORY="input";
+
+if ! test -d "${TEST_INPUT_DIRECTORY}";
+then
+	echo "Test input directory: ${TEST_INPUT_DIRECTORY} not found.";
+
+	exit ${EXIT_IGNORE};
+fi
+RESULT=`ls ${TEST_INPUT_DIRECTORY}/* | tr ' ' '\n' | wc -l`;
+
+if test ${RESULT} -eq ${EXIT_SUCCESS};
+then
+	echo "No files or directories found in the test input directory: ${TEST_INPUT_DIRECTORY}";
+
+	exit ${EXIT_IGNORE};
+fi
+
+TEST_PROFILE_DIRECTORY=$(get_test_profile_directory "${TEST_INPUT_DIRECTORY}" "esedbverify");
+
+IGNORE_LIST=$(read_ignore_list "${TEST_PROFILE_DIRECTORY}");
+
+RESULT=${EXIT_SUCCESS};
+
+for TEST_SET_INPUT_DIRECTORY in ${TEST_INPUT_DIRECTORY}/*;
+do
+	if ! test -d "${TEST_SET_INPUT_DIRECTORY}";
+	then
+		continue;
+	fi
+	if check_for_directory_in_ignore_list "${TEST_SET_INPUT_DIRECTORY}" "${IGNORE_LIST}";
+	then
+		continue;
+	fi
+
+	TEST_SET_DIRECTORY=$(get_test_set_directory "${TEST_PROFILE_DIRECTORY}" "${TEST_SET_INPUT_DIRECTORY}");
+
+	if test -f "${TEST_SET_DIRECTORY}/files";
+	then
+		INPUT_FILES=`cat ${TEST_SET_DIRECTORY}/files | sed "s?^?${TEST_SET_INPUT_DIRECTORY}/?"`;
+	else
+		INPUT_FILES=`ls -1 ${TEST_SET_INPUT_DIRECTORY}/${INPUT_GLOB}`;
+	fi
+
+	while read -r INPUT_FILE;
+	do
+		if test -z "${INPUT_FILE}";
+		then
+			continue;
+		fi
+		test_verify_input_file "${INPUT_FILE}";
+		RESULT=$?;
+
+		if test ${RESULT} -ne ${EXIT_SUCCESS};
+		then
+			break;
+		fi
+	done <<< "${INPUT_FILES}";
+
+	if test ${RESULT} -ne ${EXIT_SUCCESS};
+	then
+		break;
+	fi
+done
+
+exit ${RESULT};
+
@@ -6,7 +6,7 @@ $ExitSuccess = 0
 $ExitFailure = 1
 $ExitIgnore = 77
 
-$LibraryTests = "catalog catalog_definition column column_type data_definition data_segment database error index io_handle key long_value multi_value notify page page_tree page_value record table table_definition"
+$LibraryTests = "catalog catalog_definition checksum column column_projection column_type data_definition data_segment database error index index_cursor io_handle key long_value multi_value notify page page_pool page_tree page_tree_cursor page_value record record_batch record_filter table table_cursor table_definition"
 $LibraryTestsWithInput = "file support"
 
 Function GetTestToolDirectory
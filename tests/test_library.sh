@@ -7,7 +7,7 @@ EXIT_SUCCESS=0;
 EXIT_FAILURE=1;
 EXIT_IGNORE=77;
 
-LIBRARY_TESTS="catalog catalog_definition column column_type data_definition data_segment database error index io_handle key long_value multi_value notify page page_tree page_value record table table_definition";
+LIBRARY_TESTS="catalog catalog_definition checksum column column_projection column_type data_definition data_segment database error hot_pages index index_cursor io_handle key long_value multi_value notify page page_pool page_tree page_tree_cursor page_value record record_batch record_filter table table_cursor table_definition";
 LIBRARY_TESTS_WITH_INPUT="file support";
 OPTION_SETS="";
 